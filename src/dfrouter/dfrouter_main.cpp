@@ -272,7 +272,7 @@ main(int argc, char** argv) {
             SystemFrame::close();
             return 0;
         }
-        XMLSubSys::setValidation(oc.getString("xml-validation"), oc.getString("xml-validation.net"));
+        XMLSubSys::setValidation(oc.getString("xml-validation"), oc.getString("xml-validation.net"), oc.getString("xml-parser"));
         MsgHandler::initOutputOptions();
         if (!RODFFrame::checkOptions()) {
             throw ProcessError();
@@ -237,7 +237,7 @@ main(int argc, char** argv) {
             SystemFrame::close();
             return 0;
         }
-        XMLSubSys::setValidation(oc.getString("xml-validation"), oc.getString("xml-validation.net"));
+        XMLSubSys::setValidation(oc.getString("xml-validation"), oc.getString("xml-validation.net"), oc.getString("xml-parser"));
         MsgHandler::initOutputOptions();
         if (!RODUAFrame::checkOptions()) {
             throw ProcessError();
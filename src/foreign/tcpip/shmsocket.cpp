@@ -0,0 +1,518 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    shmsocket.cpp
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// A TraCI connection via a shared memory segment
+/****************************************************************************/
+
+#include "shmsocket.h"
+
+#ifdef BUILD_TCPIP
+
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <new>
+
+
+namespace tcpip {
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+const unsigned int SharedMemorySocket::RING_SIZE = 1 << 20;
+
+
+// ===========================================================================
+// helper definitions
+// ===========================================================================
+namespace {
+typedef std::atomic<unsigned int> AtomicWord;
+
+/// @brief identifies an initialised segment ("TrSh")
+const unsigned int MAGIC = 0x54725368;
+
+/// @brief the connection states of a segment
+const unsigned int STATE_WAITING = 1;
+const unsigned int STATE_CONNECTED = 2;
+const unsigned int STATE_CLOSED = 3;
+
+/// @brief how often the ring is checked before going to sleep (if there is more than one processor)
+const int SPIN_COUNT = 4000;
+
+/// @brief the maximum time to sleep before checking whether the peer is still alive
+const long WAIT_NANOS = 100000000;
+
+/// @brief how often (every 10ms) a client tries to find a waiting server
+const int CONNECT_RETRIES = 100;
+
+
+void
+bail(const std::string& context) {
+    throw SocketException(context + ": " + strerror(errno));
+}
+
+
+#ifndef WIN32
+/// @brief spinning is useless if the peer cannot run at the same time
+const int SPINS = sysconf(_SC_NPROCESSORS_ONLN) > 1 ? SPIN_COUNT : 0;
+
+
+void
+sleepOn(AtomicWord& word, const unsigned int expected, const long nanos) {
+#ifdef __linux__
+    struct timespec timeout;
+    timeout.tv_sec = nanos / 1000000000;
+    timeout.tv_nsec = nanos % 1000000000;
+    syscall(SYS_futex, reinterpret_cast<unsigned int*>(&word), FUTEX_WAIT, expected, &timeout, 0, 0);
+#else
+    if (word.load() == expected) {
+        usleep(std::min(100L, nanos / 1000));
+    }
+#endif
+}
+
+
+void
+wakeUp(AtomicWord& word) {
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<unsigned int*>(&word), FUTEX_WAKE, INT_MAX, 0, 0, 0);
+#else
+    (void)word;
+#endif
+}
+
+
+/// @brief Locks (or unlocks) the byte at the given index of the segment file, returns whether this succeeded
+bool
+lockByte(const int fd, const int index, const short type) {
+    struct flock fl;
+    memset(&fl, 0, sizeof(fl));
+    fl.l_type = type;
+    fl.l_whence = SEEK_SET;
+    fl.l_start = index;
+    fl.l_len = 1;
+    return fcntl(fd, F_SETLK, &fl) == 0;
+}
+
+
+/// @brief Returns whether another process holds the lock on the byte at the given index
+bool
+isLocked(const int fd, const int index) {
+    struct flock fl;
+    memset(&fl, 0, sizeof(fl));
+    fl.l_type = F_WRLCK;
+    fl.l_whence = SEEK_SET;
+    fl.l_start = index;
+    fl.l_len = 1;
+    return fcntl(fd, F_GETLK, &fl) != 0 || fl.l_type != F_UNLCK;
+}
+#endif
+}
+
+
+// ===========================================================================
+// segment layout
+// ===========================================================================
+/// @brief A ring buffer, the counters count bytes modulo 2^32 and are only increased
+struct SharedMemorySocket::Ring {
+    /// @brief the number of bytes written (only changed by the writer)
+    AtomicWord head;
+    /// @brief the number of bytes read (only changed by the reader)
+    AtomicWord tail;
+    /// @brief increased on every change of head or tail, the futex word
+    AtomicWord seq;
+    /// @brief the number of processes sleeping on seq
+    AtomicWord waiters;
+};
+
+
+/// @brief The header of the segment, the data of the rings follows
+struct SharedMemorySocket::Segment {
+    AtomicWord magic;
+    AtomicWord state;
+    /// @brief the process id of the server which created the segment
+    AtomicWord owner;
+    /// @brief the ring from the client to the server and the one from the server to the client
+    Ring ring[2];
+};
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+SharedMemorySocket::SharedMemorySocket(const std::string& name) :
+    Socket(0),
+    myName(name),
+    mySegment(0),
+    myIn(0),
+    myOut(0),
+    myInData(0),
+    myOutData(0),
+    myFD(-1),
+    myPeer(0) {
+}
+
+
+SharedMemorySocket::~SharedMemorySocket() {
+    close();
+}
+
+
+std::size_t
+SharedMemorySocket::dataOffset() {
+    return (sizeof(Segment) + 63) / 64 * 64;
+}
+
+
+std::size_t
+SharedMemorySocket::segmentSize() {
+    return dataOffset() + 2 * (std::size_t)RING_SIZE;
+}
+
+
+void
+SharedMemorySocket::attach(Segment* segment, const int fd, const bool isServer) {
+    mySegment = segment;
+    myFD = fd;
+    myIn = &segment->ring[isServer ? 0 : 1];
+    myOut = &segment->ring[isServer ? 1 : 0];
+    unsigned char* const data = reinterpret_cast<unsigned char*>(segment) + dataOffset();
+    myInData = isServer ? data : data + RING_SIZE;
+    myOutData = isServer ? data + RING_SIZE : data;
+    myPeer = isServer ? 1 : 0;
+}
+
+
+#ifdef WIN32
+void
+SharedMemorySocket::connect() {
+    throw SocketException("tcpip::SharedMemorySocket::connect() Shared memory connections are not supported on Windows");
+}
+
+
+Socket*
+SharedMemorySocket::accept(const bool) {
+    throw SocketException("tcpip::SharedMemorySocket::accept() Shared memory connections are not supported on Windows");
+}
+
+
+void
+SharedMemorySocket::close() {
+}
+
+
+void
+SharedMemorySocket::write(const unsigned char*, std::size_t) {
+}
+
+
+void
+SharedMemorySocket::read(unsigned char*, std::size_t, Storage*) {
+}
+
+
+#else
+
+void
+SharedMemorySocket::connect() {
+    if (mySegment != 0) {
+        return;
+    }
+    const std::string path = "/" + myName;
+    for (int retry = 0; retry < CONNECT_RETRIES; ++retry) {
+        if (retry > 0) {
+            usleep(10000);
+        }
+        const int fd = shm_open(path.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            if (errno == ENOENT) {
+                continue;
+            }
+            bail("tcpip::SharedMemorySocket::connect() @ shm_open");
+        }
+        // the server may not have set the size yet
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < (off_t)segmentSize()) {
+            ::close(fd);
+            continue;
+        }
+        void* const mem = mmap(0, segmentSize(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mem == MAP_FAILED) {
+            ::close(fd);
+            bail("tcpip::SharedMemorySocket::connect() @ mmap");
+        }
+        Segment* const segment = static_cast<Segment*>(mem);
+        // the locks tell the peer whether we are still alive (they are released when the process dies)
+        if (segment->magic.load() == MAGIC && isLocked(fd, 0) && lockByte(fd, 1, F_WRLCK)) {
+            unsigned int expected = STATE_WAITING;
+            if (segment->state.compare_exchange_strong(expected, STATE_CONNECTED)) {
+                wakeUp(segment->state);
+                attach(segment, fd, false);
+                return;
+            }
+            lockByte(fd, 1, F_UNLCK);
+        }
+        // the segment is not initialised yet or already in use by another client
+        munmap(mem, segmentSize());
+        ::close(fd);
+    }
+    throw SocketException("tcpip::SharedMemorySocket::connect() No server is waiting on shared memory segment '" + myName + "'");
+}
+
+
+Socket*
+SharedMemorySocket::accept(const bool create) {
+    if (mySegment != 0) {
+        return 0;
+    }
+    const std::string path = "/" + myName;
+    int fd = shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0 && errno == EEXIST) {
+        if (!isStale(path)) {
+            throw SocketException("tcpip::SharedMemorySocket::accept() Shared memory segment '" + myName + "' is in use by another server");
+        }
+        // remove the segment of a server which did not exit cleanly
+        shm_unlink(path.c_str());
+        fd = shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    }
+    if (fd < 0) {
+        bail("tcpip::SharedMemorySocket::accept() @ shm_open");
+    }
+    // lock before setting the size, a segment without a locked server byte is stale
+    void* mem = MAP_FAILED;
+    if (!lockByte(fd, 0, F_WRLCK) || ftruncate(fd, (off_t)segmentSize()) != 0
+            || (mem = mmap(0, segmentSize(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED) {
+        const int error = errno;
+        ::close(fd);
+        shm_unlink(path.c_str());
+        errno = error;
+        bail("tcpip::SharedMemorySocket::accept() @ setup");
+    }
+    // the memory is zero initialised, so are the counters
+    Segment* const segment = new (mem) Segment();
+    segment->owner.store((unsigned int)getpid());
+    segment->state.store(STATE_WAITING);
+    segment->magic.store(MAGIC);
+    unsigned int state = segment->state.load();
+    while (state != STATE_CONNECTED) {
+        sleepOn(segment->state, state, WAIT_NANOS);
+        state = segment->state.load();
+    }
+    // the client has mapped the segment, the name is free for the next one
+    shm_unlink(path.c_str());
+    if (create) {
+        SharedMemorySocket* const result = new SharedMemorySocket(myName);
+        result->attach(segment, fd, true);
+        return result;
+    }
+    attach(segment, fd, true);
+    return 0;
+}
+
+
+bool
+SharedMemorySocket::isStale(const std::string& path) {
+    const int fd = shm_open(path.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        // removed meanwhile
+        return errno == ENOENT;
+    }
+    // the server holds the lock while it waits (it is released when the process dies)
+    bool stale = !isLocked(fd, 0);
+    struct stat st;
+    if (stale && fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(Segment)) {
+        void* const mem = mmap(0, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mem != MAP_FAILED) {
+            // a segment whose owner is still running is kept, the lock may just have been lost
+            const pid_t owner = (pid_t)static_cast<Segment*>(mem)->owner.load();
+            stale = owner == 0 || (kill(owner, 0) != 0 && errno == ESRCH);
+            munmap(mem, sizeof(Segment));
+        }
+    }
+    ::close(fd);
+    return stale;
+}
+
+
+void
+SharedMemorySocket::close() {
+    if (mySegment == 0) {
+        return;
+    }
+    mySegment->state.store(STATE_CLOSED);
+    notify(*myIn);
+    notify(*myOut);
+    munmap(mySegment, segmentSize());
+    ::close(myFD);
+    mySegment = 0;
+    myFD = -1;
+}
+
+
+bool
+SharedMemorySocket::isReady(const Ring& ring, const bool forData) {
+    const unsigned int used = ring.head.load() - ring.tail.load();
+    return forData ? used != 0 : used < RING_SIZE;
+}
+
+
+void
+SharedMemorySocket::notify(Ring& ring) {
+    ring.seq.fetch_add(1);
+    if (ring.waiters.load() > 0) {
+        wakeUp(ring.seq);
+    }
+}
+
+
+void
+SharedMemorySocket::wait(Ring& ring, const bool forData) const {
+    for (int i = 0; i < SPINS; ++i) {
+        if (isReady(ring, forData)) {
+            return;
+        }
+    }
+    while (true) {
+        // register as waiter before checking again, so notify cannot miss us
+        ring.waiters.fetch_add(1);
+        const unsigned int seq = ring.seq.load();
+        bool ready = isReady(ring, forData);
+        if (!ready && mySegment->state.load() != STATE_CLOSED) {
+            sleepOn(ring.seq, seq, WAIT_NANOS);
+            ready = isReady(ring, forData);
+        }
+        ring.waiters.fetch_sub(1);
+        if (ready) {
+            return;
+        }
+        if (mySegment->state.load() == STATE_CLOSED || !isLocked(myFD, myPeer)) {
+            throw SocketException("tcpip::SharedMemorySocket::wait: peer shutdown");
+        }
+    }
+}
+
+
+void
+SharedMemorySocket::write(const unsigned char* data, std::size_t len) {
+    if (mySegment->state.load() == STATE_CLOSED) {
+        throw SocketException("tcpip::SharedMemorySocket::write: peer shutdown");
+    }
+    while (len > 0) {
+        const unsigned int head = myOut->head.load();
+        const unsigned int space = RING_SIZE - (head - myOut->tail.load());
+        if (space == 0) {
+            wait(*myOut, false);
+            continue;
+        }
+        const unsigned int pos = head & (RING_SIZE - 1);
+        const std::size_t n = std::min((std::size_t)space, len);
+        const std::size_t first = std::min(n, (std::size_t)(RING_SIZE - pos));
+        memcpy(myOutData + pos, data, first);
+        memcpy(myOutData, data + first, n - first);
+        myOut->head.store(head + (unsigned int)n);
+        notify(*myOut);
+        data += n;
+        len -= n;
+    }
+}
+
+
+void
+SharedMemorySocket::read(unsigned char* buffer, std::size_t len, Storage* msg) {
+    while (len > 0) {
+        const unsigned int tail = myIn->tail.load();
+        const unsigned int available = myIn->head.load() - tail;
+        if (available == 0) {
+            wait(*myIn, true);
+            continue;
+        }
+        const unsigned int pos = tail & (RING_SIZE - 1);
+        const std::size_t n = std::min((std::size_t)available, len);
+        const std::size_t first = std::min(n, (std::size_t)(RING_SIZE - pos));
+        if (buffer == 0) {
+            // append directly to the message without an intermediate buffer
+            msg->writePacket(myInData + pos, (int)first);
+            if (n > first) {
+                msg->writePacket(myInData, (int)(n - first));
+            }
+        } else {
+            memcpy(buffer, myInData + pos, first);
+            memcpy(buffer + first, myInData, n - first);
+            buffer += n;
+        }
+        myIn->tail.store(tail + (unsigned int)n);
+        notify(*myIn);
+        len -= n;
+    }
+}
+#endif
+
+
+void
+SharedMemorySocket::sendExact(const Storage& b) {
+    if (mySegment == 0) {
+        throw SocketException("tcpip::SharedMemorySocket::sendExact: not connected");
+    }
+    const int length = static_cast<int>(b.size());
+    Storage lengthStorage;
+    lengthStorage.writeInt(lengthLen + length);
+    write(&*lengthStorage.begin(), lengthLen);
+    if (length > 0) {
+        write(&*b.begin(), length);
+    }
+}
+
+
+bool
+SharedMemorySocket::receiveExact(Storage& msg) {
+    if (mySegment == 0) {
+        throw SocketException("tcpip::SharedMemorySocket::receiveExact: not connected");
+    }
+    unsigned char lengthBuffer[4];
+    read(lengthBuffer, lengthLen, 0);
+    Storage lengthStorage(lengthBuffer, lengthLen);
+    const int totalLen = lengthStorage.readInt();
+    msg.reset();
+    msg.reserve(totalLen - lengthLen);
+    read(0, totalLen - lengthLen, &msg);
+    return true;
+}
+
+
+bool
+SharedMemorySocket::has_client_connection() const {
+    return mySegment != 0;
+}
+
+} // namespace tcpip
+
+#endif // BUILD_TCPIP
+
+/****************************************************************************/
@@ -0,0 +1,153 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    shmsocket.h
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// A TraCI connection via a shared memory segment
+/****************************************************************************/
+#ifndef shmsocket_h
+#define shmsocket_h
+
+#include "socket.h"
+
+#ifdef BUILD_TCPIP
+
+#include <string>
+#include <cstddef>
+
+
+namespace tcpip {
+
+/**
+ * @class SharedMemorySocket
+ * @brief A TraCI connection between two processes on the same host via a POSIX shared memory segment
+ *
+ * It offers the message interface of the TCP socket (sendExact / receiveExact)
+ *  but transfers the data through two ring buffers (one per direction) within
+ *  the segment. A waiting side spins shortly and then sleeps on a futex (Linux)
+ *  or polls, so a message exchange usually does not need any system call.
+ *
+ * The server creates the segment in accept() and removes its name as soon as a
+ *  client is connected, so the same name can be used to accept further clients.
+ *  accept() fails if another server waits on the same name, a segment left by
+ *  a server which did not exit cleanly is replaced.
+ *  Shared memory connections are not available on Windows.
+ */
+class SharedMemorySocket : public Socket {
+public:
+    /** @brief Constructor that prepares to connect to or to accept a connection on a segment
+     *
+     * @param[in] name The name of the segment (without the leading '/')
+     */
+    SharedMemorySocket(const std::string& name);
+
+    /// @brief Destructor
+    virtual ~SharedMemorySocket();
+
+    /// @brief Connects to the segment created by a waiting server
+    virtual void connect();
+
+    /// @brief Creates the segment and waits for a client to connect
+    virtual Socket* accept(const bool create = false);
+
+    /// @brief Sends a complete TraCI message (prepending the length)
+    virtual void sendExact(const Storage& b);
+
+    /// @brief Receives a complete TraCI message
+    virtual bool receiveExact(Storage& msg);
+
+    /// @brief Closes the connection and unmaps the segment
+    virtual void close();
+
+    /// @brief Returns whether a connection is established
+    virtual bool has_client_connection() const;
+
+    /// @brief The capacity of each of the two ring buffers in bytes (a power of two)
+    static const unsigned int RING_SIZE;
+
+private:
+    struct Ring;
+    struct Segment;
+
+    /** @brief Uses the mapped segment for the communication
+     *
+     * @param[in] segment The mapped and initialised segment
+     * @param[in] fd The file descriptor of the segment (holding our lock)
+     * @param[in] isServer Whether this is the server side (deciding which ring is read)
+     */
+    void attach(Segment* segment, const int fd, const bool isServer);
+
+    /// @brief Writes the data to the outgoing ring, waiting for free space if necessary
+    void write(const unsigned char* data, std::size_t len);
+
+    /// @brief Reads len bytes from the incoming ring into buffer or appends them to msg (if buffer is 0)
+    void read(unsigned char* buffer, std::size_t len, Storage* msg);
+
+    /// @brief Waits until the ring has data (forData) or free space, throws if the peer is gone meanwhile
+    void wait(Ring& ring, const bool forData) const;
+
+    /// @brief Returns whether the ring has data (forData) or free space
+    static bool isReady(const Ring& ring, const bool forData);
+
+    /// @brief Signals a change of the ring to a waiting peer
+    static void notify(Ring& ring);
+
+    /// @brief Returns the offset of the ring data from the start of the segment
+    static std::size_t dataOffset();
+
+    /// @brief Returns the complete size of a segment
+    static std::size_t segmentSize();
+
+    /** @brief Returns whether the existing segment was left by a server which did not exit cleanly
+     *
+     * This is the case if no server holds its lock and the process which created it is gone.
+     * @param[in] path The name of the segment (with the leading '/')
+     */
+    static bool isStale(const std::string& path);
+
+private:
+    /// @brief The name of the segment
+    const std::string myName;
+
+    /// @brief The mapped segment, 0 if not connected
+    Segment* mySegment;
+
+    /// @brief The rings read from and written to
+    Ring* myIn;
+    Ring* myOut;
+
+    /// @brief The data of the rings read from and written to
+    unsigned char* myInData;
+    unsigned char* myOutData;
+
+    /// @brief The file descriptor of the segment
+    int myFD;
+
+    /// @brief The index of the byte locked by the peer
+    int myPeer;
+
+private:
+    /// @brief Invalidated copy constructor.
+    SharedMemorySocket(const SharedMemorySocket&);
+
+    /// @brief Invalidated assignment operator.
+    SharedMemorySocket& operator=(const SharedMemorySocket&);
+
+};
+
+} // namespace tcpip
+
+#endif // BUILD_TCPIP
+
+#endif
+
+/****************************************************************************/
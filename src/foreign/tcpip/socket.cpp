@@ -407,6 +407,7 @@ namespace tcpip
 		// avoid some copying here, but both parts would have to go through the
 		// TCP/IP stack on their own which probably would cost more performance.
 		std::vector<unsigned char> msg;
+		msg.reserve(lengthLen + length);
 		msg.insert(msg.end(), length_storage.begin(), length_storage.end());
 		msg.insert(msg.end(), b.begin(), b.end());
 		send(msg);
@@ -532,6 +533,37 @@ namespace tcpip
 		return socket_ >= 0;
 	}
 
+	// ----------------------------------------------------------------------
+	std::vector<Socket*>
+		Socket::
+		wait_for_pending_data(const std::vector<Socket*>& sockets)
+	{
+		std::vector<Socket*> result;
+		fd_set fds;
+		FD_ZERO( &fds );
+		int maxSock = -1;
+		for (std::vector<Socket*>::const_iterator it = sockets.begin(); it != sockets.end(); ++it) {
+			if ((*it)->socket_ >= 0) {
+				FD_SET( (unsigned int)(*it)->socket_, &fds );
+				if ((*it)->socket_ > maxSock)
+					maxSock = (*it)->socket_;
+			}
+		}
+		if (maxSock < 0)
+			return result;
+
+		int r = select( maxSock+1, &fds, NULL, NULL, NULL);
+
+		if (r < 0)
+			sockets.front()->BailOnSocketError("tcpip::Socket::wait_for_pending_data @ select");
+
+		for (std::vector<Socket*>::const_iterator it = sockets.begin(); it != sockets.end(); ++it) {
+			if ((*it)->socket_ >= 0 && FD_ISSET( (*it)->socket_, &fds ))
+				result.push_back(*it);
+		}
+		return result;
+	}
+
 	// ----------------------------------------------------------------------
 	bool 
 		Socket::
@@ -68,25 +68,27 @@ namespace tcpip
 		Socket(int port);
 
 		/// Destructor
-		~Socket();
+		virtual ~Socket();
 
 		/// Connects to host_:port_
-		void connect();
+		virtual void connect();
 
 		/// Wait for a incoming connection to port_
-        Socket* accept(const bool create = false);
+        virtual Socket* accept(const bool create = false);
 
 		void send( const std::vector<unsigned char> &buffer);
-		void sendExact( const Storage & );
+		virtual void sendExact( const Storage & );
 		/// Receive up to \p bufSize available bytes from Socket::socket_
 		std::vector<unsigned char> receive( int bufSize = 2048 );
 		/// Receive a complete TraCI message from Socket::socket_
-		bool receiveExact( Storage &);
-		void close();
+		virtual bool receiveExact( Storage &);
+		virtual void close();
 		int port();
 		void set_blocking(bool);
 		bool is_blocking();
-		bool has_client_connection() const;
+		virtual bool has_client_connection() const;
+		/// Blocks until at least one of the \p sockets has data for reading and returns those sockets (only for TCP sockets)
+		static std::vector<Socket*> wait_for_pending_data(const std::vector<Socket*>& sockets);
 
 		// If verbose, each send and received data is written to stderr
 		bool verbose() { return verbose_; }
@@ -40,9 +40,8 @@ namespace tcpip
 	{
 		assert(length >= 0); // fixed MB, 2015-04-21
 
-		store.reserve(length);
 		// Get the content
-		for(int i = 0; i < length; ++i) store.push_back(packet[i]);
+		store.assign(packet, packet + length);
 
 		init();
 	}
@@ -330,6 +329,14 @@ namespace tcpip
 	}
 
 
+	// ----------------------------------------------------------------------
+	void Storage::reserve(StorageType::size_type size)
+	{
+		store.reserve(size);
+		iter_ = store.begin();   // reserve() invalidates iterators
+	}
+
+
 	// ----------------------------------------------------------------------
 	void Storage::writePacket(unsigned char* packet, int length)
 	{
@@ -341,7 +348,7 @@ namespace tcpip
 	// ----------------------------------------------------------------------
     void Storage::writePacket(const std::vector<unsigned char> &packet)
     {
-        std::copy(packet.begin(), packet.end(), std::back_inserter(store));
+		store.insert(store.end(), packet.begin(), packet.end());
 		iter_ = store.begin();
     }
 
@@ -393,16 +400,12 @@ namespace tcpip
 	void Storage::readByEndianess(unsigned char * array, int size)
 	{
 		checkReadSafe(size);
+		const StorageType::const_iterator end = iter_ + size;
 		if (bigEndian_)
-		{
-			for (int i = 0; i < size; ++i)
-				array[i] = readCharUnsafe();
-		}
+			std::copy(iter_, end, array);
 		else
-		{
-			for (int i = size - 1; i >= 0; --i)
-				array[i] = readCharUnsafe();
-		}
+			std::reverse_copy(iter_, end, array);
+		iter_ = end;
 	}
 
 
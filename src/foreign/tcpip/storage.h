@@ -75,6 +75,8 @@ public:
 	virtual unsigned int position() const;
 
 	void reset();
+	/// Preallocate memory for \p size bytes, invalidates the read position like any write
+	void reserve(StorageType::size_type size);
 	/// Dump storage content as series of hex values
 	std::string hexDump() const;
 
@@ -41,6 +41,7 @@
 #include <libsumo/Junction.h>
 #include <libsumo/POI.h>
 #include <libsumo/Polygon.h>
+#include <libsumo/Vehicle.h>
 #include <traci-server/TraCIConstants.h>
 #include "Helper.h"
 
@@ -217,6 +218,7 @@ Helper::cleanup() {
     myObjects.clear();
     delete myLaneTree;
     myLaneTree = 0;
+    Vehicle::cleanup();
 }
 
 
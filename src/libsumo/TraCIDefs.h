@@ -102,6 +102,21 @@ struct TraCIValue {
 };
 
 
+/** @struct TraCIColumnarResults
+    * @brief The results of a context subscription ordered by variable
+    */
+struct TraCIColumnarResults {
+    /// @brief The ids of the objects in range
+    std::vector<std::string> ids;
+    /// @brief The values of numerical variables (one per object)
+    std::map<int, std::vector<double> > scalars;
+    /// @brief The values of position variables (one per object)
+    std::map<int, std::vector<TraCIPosition> > positions;
+    /// @brief The values of all other variables (one per object)
+    std::map<int, std::vector<TraCIValue> > values;
+};
+
+
 class TraCIPhase {
 public:
     TraCIPhase(const SUMOTime _duration, const SUMOTime _duration1, const SUMOTime _duration2, const std::string& _phase)
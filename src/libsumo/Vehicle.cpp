@@ -49,6 +49,31 @@
 
 
 namespace libsumo {
+// ===========================================================================
+// class definitions
+// ===========================================================================
+class Vehicle::HandleListener : public MSNet::VehicleStateListener {
+public:
+    void vehicleStateChanged(const SUMOVehicle* const vehicle, MSNet::VehicleState to) {
+        if (to == MSNet::VEHICLE_STATE_ARRIVED) {
+            std::map<const SUMOVehicle*, int>::iterator i = myHandles.find(vehicle);
+            if (i != myHandles.end()) {
+                myHandleVehicles[i->second] = 0;
+                myHandles.erase(i);
+            }
+        }
+    }
+};
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+std::vector<const MSVehicle*> Vehicle::myHandleVehicles;
+std::map<const SUMOVehicle*, int> Vehicle::myHandles;
+Vehicle::HandleListener* Vehicle::myHandleListener = 0;
+
+
 // ===========================================================================
 // member definitions
 // ===========================================================================
@@ -625,6 +650,172 @@ Vehicle::getWidth(const std::string& vehicleID) {
 }
 
 
+void
+Vehicle::cleanup() {
+    if (myHandleListener != 0) {
+        MSNet::getInstance()->removeVehicleStateListener(myHandleListener);
+        delete myHandleListener;
+        myHandleListener = 0;
+    }
+    myHandleVehicles.clear();
+    myHandles.clear();
+}
+
+
+TraCIColumnarResults
+Vehicle::getAll(const std::vector<int>& variables) {
+    TraCIColumnarResults result;
+    std::vector<const MSVehicle*> vehicles;
+    MSVehicleControl& c = MSNet::getInstance()->getVehicleControl();
+    vehicles.reserve(c.getRunningVehicleNo());
+    result.ids.reserve(c.getRunningVehicleNo());
+    for (MSVehicleControl::constVehIt i = c.loadedVehBegin(); i != c.loadedVehEnd(); ++i) {
+        if ((*i).second->isOnRoad() || (*i).second->isParking()) {
+            const MSVehicle* const veh = dynamic_cast<const MSVehicle*>((*i).second);
+            if (veh == 0) {
+                throw TraCIException("Vehicle '" + (*i).first + "' is not a micro-simulation vehicle");
+            }
+            vehicles.push_back(veh);
+            result.ids.push_back((*i).first);
+        }
+    }
+    collectValues(vehicles, variables, result);
+    return result;
+}
+
+
+TraCIColumnarResults
+Vehicle::getValues(const std::vector<std::string>& vehicleIDs, const std::vector<int>& variables) {
+    TraCIColumnarResults result;
+    std::vector<const MSVehicle*> vehicles;
+    vehicles.reserve(vehicleIDs.size());
+    for (std::vector<std::string>::const_iterator i = vehicleIDs.begin(); i != vehicleIDs.end(); ++i) {
+        vehicles.push_back(getVehicle(*i));
+    }
+    result.ids = vehicleIDs;
+    collectValues(vehicles, variables, result);
+    return result;
+}
+
+
+int
+Vehicle::getHandle(const std::string& vehicleID) {
+    const MSVehicle* const veh = getVehicle(vehicleID);
+    if (!veh->hasDeparted()) {
+        throw TraCIException("Vehicle '" + vehicleID + "' has not departed yet");
+    }
+    std::map<const SUMOVehicle*, int>::const_iterator i = myHandles.find(veh);
+    if (i != myHandles.end()) {
+        return i->second;
+    }
+    if (myHandleListener == 0) {
+        myHandleListener = new HandleListener();
+        MSNet::getInstance()->addVehicleStateListener(myHandleListener);
+    }
+    const int handle = (int)myHandleVehicles.size();
+    myHandleVehicles.push_back(veh);
+    myHandles[veh] = handle;
+    return handle;
+}
+
+
+std::vector<int>
+Vehicle::getHandles(const std::vector<std::string>& vehicleIDs) {
+    std::vector<int> handles;
+    handles.reserve(vehicleIDs.size());
+    for (std::vector<std::string>::const_iterator i = vehicleIDs.begin(); i != vehicleIDs.end(); ++i) {
+        handles.push_back(getHandle(*i));
+    }
+    return handles;
+}
+
+
+TraCIColumnarResults
+Vehicle::getValuesByHandle(const std::vector<int>& handles, const std::vector<int>& variables) {
+    TraCIColumnarResults result;
+    std::vector<const MSVehicle*> vehicles;
+    vehicles.reserve(handles.size());
+    for (std::vector<int>::const_iterator i = handles.begin(); i != handles.end(); ++i) {
+        if (*i < 0 || *i >= (int)myHandleVehicles.size() || myHandleVehicles[*i] == 0) {
+            throw TraCIException("Vehicle handle " + toString(*i) + " is not valid");
+        }
+        vehicles.push_back(myHandleVehicles[*i]);
+    }
+    collectValues(vehicles, variables, result);
+    return result;
+}
+
+
+void
+Vehicle::collectValues(const std::vector<const MSVehicle*>& vehicles, const std::vector<int>& variables, TraCIColumnarResults& into) {
+    for (std::vector<int>::const_iterator v = variables.begin(); v != variables.end(); ++v) {
+        if (*v == VAR_POSITION || *v == VAR_POSITION3D) {
+            std::vector<TraCIPosition>& column = into.positions[*v];
+            column.reserve(vehicles.size());
+            for (std::vector<const MSVehicle*>::const_iterator i = vehicles.begin(); i != vehicles.end(); ++i) {
+                TraCIPosition pos;
+                if (isVisible(*i)) {
+                    pos = Helper::makeTraCIPosition((*i)->getPosition());
+                    if (*v == VAR_POSITION) {
+                        pos.z = 0.;
+                    }
+                } else {
+                    pos.x = INVALID_DOUBLE_VALUE;
+                    pos.y = INVALID_DOUBLE_VALUE;
+                    pos.z = INVALID_DOUBLE_VALUE;
+                }
+                column.push_back(pos);
+            }
+        } else {
+            std::vector<double>& column = into.scalars[*v];
+            column.reserve(vehicles.size());
+            for (std::vector<const MSVehicle*>::const_iterator i = vehicles.begin(); i != vehicles.end(); ++i) {
+                column.push_back(getScalar(*i, *v));
+            }
+        }
+    }
+}
+
+
+double
+Vehicle::getScalar(const MSVehicle* veh, const int variable) {
+    switch (variable) {
+        case VAR_SPEED:
+            return isVisible(veh) ? veh->getSpeed() : INVALID_DOUBLE_VALUE;
+        case VAR_SPEED_WITHOUT_TRACI:
+            return isVisible(veh) ? veh->getSpeedWithoutTraciInfluence() : INVALID_DOUBLE_VALUE;
+        case VAR_ANGLE:
+            return isVisible(veh) ? GeomHelper::naviDegree(veh->getAngle()) : INVALID_DOUBLE_VALUE;
+        case VAR_SLOPE:
+            return veh->isOnRoad() ? veh->getSlope() : INVALID_DOUBLE_VALUE;
+        case VAR_LANEPOSITION:
+            return veh->isOnRoad() ? veh->getPositionOnLane() : INVALID_DOUBLE_VALUE;
+        case VAR_LANEPOSITION_LAT:
+            return veh->isOnRoad() ? veh->getLateralPositionOnLane() : INVALID_DOUBLE_VALUE;
+        case VAR_LANE_INDEX:
+            return veh->isOnRoad() ? veh->getLane()->getIndex() : INVALID_INT_VALUE;
+        case VAR_ROUTE_INDEX:
+            return veh->hasDeparted() ? veh->getRoutePosition() : INVALID_INT_VALUE;
+        case VAR_ALLOWED_SPEED:
+            return veh->isOnRoad() ? veh->getLane()->getVehicleMaxSpeed(veh) : INVALID_DOUBLE_VALUE;
+        case VAR_WAITING_TIME:
+            return veh->getWaitingSeconds();
+        case VAR_ACCUMULATED_WAITING_TIME:
+            return veh->getAccumulatedWaitingSeconds();
+        case VAR_CO2EMISSION:
+            return isVisible(veh) ? veh->getCO2Emissions() : INVALID_DOUBLE_VALUE;
+        case VAR_NOXEMISSION:
+            return isVisible(veh) ? veh->getNOxEmissions() : INVALID_DOUBLE_VALUE;
+        case VAR_FUELCONSUMPTION:
+            return isVisible(veh) ? veh->getFuelConsumption() : INVALID_DOUBLE_VALUE;
+        case VAR_ELECTRICITYCONSUMPTION:
+            return isVisible(veh) ? veh->getElectricityConsumption() : INVALID_DOUBLE_VALUE;
+        default:
+            throw TraCIException("Variable " + toHex(variable, 2) + " can not be retrieved for multiple vehicles");
+    }
+}
+
+
 void
 Vehicle::setStop(const std::string& vehicleID,
                  const std::string& edgeID,
@@ -29,6 +29,7 @@
 #endif
 
 #include <vector>
+#include <map>
 #include <libsumo/TraCIDefs.h>
 #include <traci-server/TraCIConstants.h>
 
@@ -38,6 +39,7 @@
 // ===========================================================================
 class MSVehicle;
 class MSVehicleType;
+class SUMOVehicle;
 
 
 // ===========================================================================
@@ -124,6 +126,36 @@ public:
     static double getWidth(const std::string& vehicleID);
     /// @}
 
+    /// @name Vectorized value retrieval
+    /// @{
+
+    /** @brief Returns the given variables of all running vehicles
+     *
+     * The vehicles are collected in a single pass over the vehicle control,
+     *  the ids are ordered like in getIDList. Numerical variables (including
+     *  the lane and route index) end up in the scalars, positions in the
+     *  positions of the result, one contiguous column per variable.
+     * @param[in] variables The variables to retrieve (numerical ones, VAR_POSITION and VAR_POSITION3D)
+     * @return The ids and the values of the running vehicles
+     */
+    static TraCIColumnarResults getAll(const std::vector<int>& variables);
+
+    /// @brief Returns the given variables of the given vehicles (see getAll)
+    static TraCIColumnarResults getValues(const std::vector<std::string>& vehicleIDs, const std::vector<int>& variables);
+
+    /** @brief Returns a handle for the given running vehicle to be used with getValuesByHandle
+     *
+     * The handle stays the same until the vehicle arrives and is not reused afterwards.
+     */
+    static int getHandle(const std::string& vehicleID);
+
+    /// @brief Returns the handles of the given running vehicles (see getHandle)
+    static std::vector<int> getHandles(const std::vector<std::string>& vehicleIDs);
+
+    /// @brief Returns the given variables of the vehicles with the given handles without looking up their ids (the ids of the result stay empty)
+    static TraCIColumnarResults getValuesByHandle(const std::vector<int>& handles, const std::vector<int>& variables);
+    /// @}
+
     /// @name State Changing
     /// @{
 
@@ -188,6 +220,9 @@ public:
     static void setParameter(const std::string& vehicleID, const std::string& key, const std::string& value);
     /// @}
 
+    /// @brief invalidates all handles (called when the simulation is closed)
+    static void cleanup();
+
 private:
     static MSVehicle* getVehicle(const std::string& id);
 
@@ -195,6 +230,25 @@ private:
 
     static bool isOnInit(const std::string& vehicleID);
 
+    /// @brief Fills one column per variable with the values of the vehicles
+    static void collectValues(const std::vector<const MSVehicle*>& vehicles, const std::vector<int>& variables, TraCIColumnarResults& into);
+
+    /// @brief Returns the value of a numerical variable as it is returned by the single value getters
+    static double getScalar(const MSVehicle* veh, const int variable);
+
+private:
+    /// @brief Invalidates the handles of arriving vehicles
+    class HandleListener;
+
+    /// @brief The vehicles by handle (0 if the vehicle arrived)
+    static std::vector<const MSVehicle*> myHandleVehicles;
+
+    /// @brief The handles by vehicle
+    static std::map<const SUMOVehicle*, int> myHandles;
+
+    /// @brief The listener registered when the first handle is requested
+    static HandleListener* myHandleListener;
+
     /// @brief invalidated standard constructor
     Vehicle();
 
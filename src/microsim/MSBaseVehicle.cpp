@@ -50,6 +50,7 @@
 // static members
 // ===========================================================================
 const SUMOTime MSBaseVehicle::NOT_YET_DEPARTED = SUMOTime_MAX;
+SUMOVehicle::NumericalID MSBaseVehicle::myCurrentNumericalIndex = 0;
 #ifdef _DEBUG
 std::set<std::string> MSBaseVehicle::myShallTraceMoveReminders;
 #endif
@@ -76,7 +77,8 @@ MSBaseVehicle::MSBaseVehicle(SUMOVehicleParameter* pars, const MSRoute* route,
     myDepartPos(-1),
     myArrivalPos(-1),
     myArrivalLane(-1),
-    myNumberReroutes(0)
+    myNumberReroutes(0),
+    myNumericalID(myCurrentNumericalIndex++)
 #ifdef _DEBUG
     , myTraceMoveReminders(myShallTraceMoveReminders.count(pars->id) > 0)
 #endif
@@ -286,6 +288,12 @@ MSBaseVehicle::getSlope() const {
 }
 
 
+const PollutantsInterface::Emissions&
+MSBaseVehicle::getEmissions(const double speed) const {
+    return myEmissionsCache.get(myType->getEmissionClass(), speed, getAcceleration(), getSlope());
+}
+
+
 void
 MSBaseVehicle::onDepart() {
     myDeparture = MSNet::getInstance()->getCurrentTimeStep();
@@ -81,6 +81,11 @@ public:
     /// Returns the name of the vehicle
     const std::string& getID() const;
 
+    /// @brief Returns the vehicle's numerical id (unique per simulation run, assigned at creation)
+    NumericalID getNumericalID() const {
+        return myNumericalID;
+    }
+
     /** @brief Returns the vehicle's parameter (including departure definition)
      *
      * @return The vehicle's parameter
@@ -233,6 +238,12 @@ public:
      */
     virtual double getSlope() const;
 
+    /** @brief Returns the vehicle's emissions when driving with the given speed in its current state
+     * @param[in] speed The speed to compute the emissions for
+     * @return The amount emitted per second [mg/s]
+     */
+    const PollutantsInterface::Emissions& getEmissions(const double speed) const;
+
     /** @brief Called when the vehicle is inserted into the network
      *
      * Sets optional information about departure time, informs the vehicle
@@ -487,6 +498,15 @@ protected:
     /// @brief The number of reroutings
     int myNumberReroutes;
 
+    /// @brief The numerical id of this vehicle
+    const NumericalID myNumericalID;
+
+    /// @brief The numerical id to give to the next vehicle
+    static NumericalID myCurrentNumericalIndex;
+
+    /// @brief The last computed emissions, shared by all emission consumers
+    mutable PollutantsInterface::EmissionsCache myEmissionsCache;
+
     /* @brief magic value for undeparted vehicles
      * @note: in previous versions this was -1
      */
@@ -84,6 +84,9 @@ MSFrame::fillOptions() {
     oc.addDescription("net-file", "Input", "Load road network description from FILE");
     oc.addXMLDefault("net-file", "net");
 
+    oc.doRegister("net-file.boundary", new Option_String());
+    oc.addDescription("net-file.boundary", "Input", "Only load the junctions within the given boundary <xmin,ymin,xmax,ymax> and their edges, a junction is located by the end of the first lane reaching it");
+
     oc.doRegister("route-files", 'r', new Option_FileName());
     oc.addSynonyme("route-files", "routes");
     oc.addDescription("route-files", "Input", "Load routes descriptions from FILE(s)");
@@ -258,6 +261,9 @@ MSFrame::fillOptions() {
     oc.doRegister("route-steps", 's', new Option_String("200", "TIME"));
     oc.addDescription("route-steps", "Processing", "Load routes for the next number of seconds ahead");
 
+    oc.doRegister("route-files.parse-ahead", new Option_Bool(false));
+    oc.addDescription("route-files.parse-ahead", "Processing", "Parse each route file in a background thread ahead of the simulation");
+
     oc.doRegister("no-internal-links", new Option_Bool(false));
     oc.addDescription("no-internal-links", "Processing", "Disable (junction) internal links");
 
@@ -329,7 +335,7 @@ MSFrame::fillOptions() {
 
     // pedestrian model
     oc.doRegister("pedestrian.model", new Option_String("striping"));
-    oc.addDescription("pedestrian.model", "Processing", "Select among pedestrian models ['nonInteracting', 'striping', 'remote']");
+    oc.addDescription("pedestrian.model", "Processing", "Select among pedestrian models ['nonInteracting', 'striping', 'socialForce', 'remote']");
 
     oc.doRegister("pedestrian.striping.stripe-width", new Option_Float(0.64));
     oc.addDescription("pedestrian.striping.stripe-width", "Processing", "Width of parallel stripes for segmenting a sidewalk (meters) for use with model 'striping'");
@@ -340,6 +346,18 @@ MSFrame::fillOptions() {
     oc.doRegister("pedestrian.striping.jamtime", new Option_String("300", "TIME"));
     oc.addDescription("pedestrian.striping.jamtime", "Processing", "Time in seconds after which pedestrians start squeezing through a jam when using model 'striping' (non-positive values disable squeezing)");
 
+    oc.doRegister("pedestrian.socialforce.relaxation-time", new Option_Float(0.5));
+    oc.addDescription("pedestrian.socialforce.relaxation-time", "Processing", "Time in seconds in which pedestrians adapt to their desired velocity for use with model 'socialForce'");
+
+    oc.doRegister("pedestrian.socialforce.repulsion-strength", new Option_Float(2.1));
+    oc.addDescription("pedestrian.socialforce.repulsion-strength", "Processing", "Strength of the repulsion between pedestrians (m/s^2) for use with model 'socialForce'");
+
+    oc.doRegister("pedestrian.socialforce.repulsion-range", new Option_Float(0.3));
+    oc.addDescription("pedestrian.socialforce.repulsion-range", "Processing", "Range of the repulsion between pedestrians (meters) for use with model 'socialForce'");
+
+    oc.doRegister("pedestrian.socialforce.threads", new Option_Integer(0));
+    oc.addDescription("pedestrian.socialforce.threads", "Processing", "The number of parallel execution threads used for the force computation of model 'socialForce'");
+
     oc.doRegister("pedestrian.remote.address", new Option_String("localhost:9000"));
     oc.addDescription("pedestrian.remote.address", "Processing", "The address (host:port) of the external simulation");
 
@@ -386,8 +404,12 @@ MSFrame::fillOptions() {
     oc.addOptionSubTopic("TraCI Server");
     oc.doRegister("remote-port", new Option_Integer(0));
     oc.addDescription("remote-port", "TraCI Server", "Enables TraCI Server if set");
+    oc.doRegister("remote-shm", new Option_String());
+    oc.addDescription("remote-shm", "TraCI Server", "Enables TraCI Server using the shared memory segment with the given name instead of a port");
     oc.doRegister("num-clients", new Option_Integer(1));
     oc.addDescription("num-clients", "TraCI Server", "Expected number of connecting clients");
+    oc.doRegister("parallel-queries", new Option_Bool(false));
+    oc.addDescription("parallel-queries", "TraCI Server", "Answers read-only requests of clients waiting for their turn immediately instead of in client order");
 #ifdef HAVE_PYTHON
     oc.doRegister("python-script", new Option_String());
     oc.addDescription("python-script", "TraCI Server", "Runs TraCI script with embedded python");
@@ -514,6 +536,10 @@ MSFrame::checkOptions() {
         WRITE_ERROR("No network file (-n) specified.");
         ok = false;
     }
+    if (oc.isSet("net-file.boundary") && oc.getStringVector("net-file.boundary").size() != 4) {
+        WRITE_ERROR("The boundary of the network to load needs to be given as <xmin,ymin,xmax,ymax>.");
+        ok = false;
+    }
     if (oc.getFloat("scale") < 0.) {
         WRITE_ERROR("Invalid scaling factor.");
         ok = false;
@@ -534,6 +560,12 @@ MSFrame::checkOptions() {
         WRITE_ERROR("You can either restart or quit on end.");
         ok = false;
     }
+#ifndef HAVE_FOX
+    if (oc.getBool("route-files.parse-ahead")) {
+        WRITE_ERROR("Parsing route files in the background is only possible when compiled with Fox.");
+        ok = false;
+    }
+#endif
     if (oc.getBool("meso-junction-control.limited") && !oc.getBool("meso-junction-control")) {
         oc.set("meso-junction-control", "true");
     }
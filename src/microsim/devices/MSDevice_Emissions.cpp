@@ -71,10 +71,7 @@ MSDevice_Emissions::~MSDevice_Emissions() {
 
 bool
 MSDevice_Emissions::notifyMove(SUMOVehicle& veh, double /*oldPos*/, double /*newPos*/, double newSpeed) {
-    const SUMOEmissionClass c = veh.getVehicleType().getEmissionClass();
-    const double a = veh.getAcceleration();
-    const double slope = veh.getSlope();
-    myEmissions.addScaled(PollutantsInterface::computeAll(c, newSpeed, a, slope), TS);
+    myEmissions.addScaled(veh.getEmissions(newSpeed), TS);
     return true;
 }
 
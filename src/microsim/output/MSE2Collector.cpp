@@ -299,17 +299,16 @@ MSE2Collector::recalculateDetectorLength() {
 
 
 MSE2Collector::~MSE2Collector() {
-    // clear move notifications
-    for (std::vector<MoveNotificationInfo*>::iterator j = myMoveNotifications.begin(); j != myMoveNotifications.end(); ++j) {
-        delete *j;
-    }
-    myMoveNotifications.clear();
-
     // clear vehicle infos
-    for (VehicleInfoMap::iterator j = myVehicleInfos.begin(); j != myVehicleInfos.end(); ++j) {
-        delete j->second;
+    for (VehicleInfoCont::iterator j = myVehicleInfos.begin(); j != myVehicleInfos.end(); ++j) {
+        delete *j;
     }
     myVehicleInfos.clear();
+    myVehicleInfoIndex.clear();
+    for (VehicleInfoCont::iterator j = myVehicleInfoPool.begin(); j != myVehicleInfoPool.end(); ++j) {
+        delete *j;
+    }
+    myVehicleInfoPool.clear();
 }
 
 
@@ -602,11 +601,10 @@ MSE2Collector::getLanes() {
 bool
 MSE2Collector::notifyMove(SUMOVehicle& veh, double oldPos,
                           double newPos, double newSpeed) {
-    VehicleInfoMap::iterator vi = myVehicleInfos.find(veh.getID());
-    assert(vi != myVehicleInfos.end()); // all vehicles calling notifyMove() should have called notifyEnter() before
+    VehicleInfo* vi = getVehicleInfo(veh.getNumericalID());
+    assert(vi != 0); // all vehicles calling notifyMove() should have called notifyEnter() before
 
-    const std::string& vehID = veh.getID();
-    VehicleInfo& vehInfo = *(vi->second);
+    VehicleInfo& vehInfo = *vi;
 
     // position relative to the detector start
     double relPos = vehInfo.entryOffset + newPos;
@@ -618,7 +616,7 @@ MSE2Collector::notifyMove(SUMOVehicle& veh, double oldPos,
     if DEBUG_COND {
         std::cout << "\n" << SIMTIME
                 << " MSE2Collector::notifyMove() (detID = " << myID << "on lane '" << myLane->getID() << "')"
-                << " called by vehicle '" << vehID << "'"
+                << " called by vehicle '" << veh.getID() << "'"
                 << " at relative position " << relPos
                 << ", distToDetectorEnd = " << vehInfo.distToDetectorEnd << std::endl;
     }
@@ -664,7 +662,7 @@ MSE2Collector::notifyMove(SUMOVehicle& veh, double oldPos,
         }
 #endif
         // Vehicle is beyond the detector, unsubscribe and register removal from myVehicleInfos
-        myLeftVehicles.insert(vehID);
+        myLeftVehicles.push_back(veh.getNumericalID());
         return false;
     } else {
         // Receive further notifications
@@ -692,26 +690,25 @@ MSE2Collector::notifyLeave(SUMOVehicle& veh, double /* lastPos */, MSMoveReminde
 
         if (std::find(myLanes.begin(), myLanes.end(), enteredLane->getID()) == myLanes.end()) {
             // Entered lane is not part of the detector
-            VehicleInfoMap::iterator vi = myVehicleInfos.find(veh.getID());
+            VehicleInfo* vi = getVehicleInfo(veh.getNumericalID());
             // Determine exit offset, where vehicle left the detector
-            double exitOffset = vi->second->entryOffset - myOffsets[vi->second->currentOffsetIndex] - vi->second->currentLane->getLength();
-            vi->second->exitOffset = MAX2(vi->second->exitOffset, exitOffset);
+            double exitOffset = vi->entryOffset - myOffsets[vi->currentOffsetIndex] - vi->currentLane->getLength();
+            vi->exitOffset = MAX2(vi->exitOffset, exitOffset);
 #ifdef DEBUG_E2_NOTIFY_ENTER_AND_LEAVE
             if DEBUG_COND {
-                std::cout << SIMTIME << " Vehicle '" << veh.getID() << "' leaves the detector. Exit offset = " << vi->second->exitOffset << std::endl;
+                std::cout << SIMTIME << " Vehicle '" << veh.getID() << "' leaves the detector. Exit offset = " << vi->exitOffset << std::endl;
             }
 #endif
         }
 
         return true;
     } else {
-        VehicleInfoMap::iterator vi = myVehicleInfos.find(veh.getID());
+        VehicleInfo* vi = getVehicleInfo(veh.getNumericalID());
         // erase vehicle, which leaves in a non-longitudinal way, immediately
-        if (vi->second->hasEntered) {
+        if (vi->hasEntered) {
             myNumberOfLeftVehicles++;
         }
-        delete vi->second;
-        myVehicleInfos.erase(vi);
+        removeVehicleInfo(vi);
 #ifdef DEBUG_E2_NOTIFY_ENTER_AND_LEAVE
         if DEBUG_COND {
             std::cout << SIMTIME << " Left non-longitudinally (lanechange, teleport, parking, etc) -> discard subscription" << std::endl;
@@ -750,22 +747,21 @@ MSE2Collector::notifyEnter(SUMOVehicle& veh, MSMoveReminder::Notification /* rea
     }
 #endif
 
-    const std::string& vehID = veh.getID();
-    VehicleInfoMap::iterator vi = myVehicleInfos.find(vehID);
-    if (vi != myVehicleInfos.end()) {
+    VehicleInfo* vi = getVehicleInfo(veh.getNumericalID());
+    if (vi != 0) {
         // Register move current offset to the next lane
-        vi->second->currentOffsetIndex++;
-        vi->second->currentLane = enteredLane;
+        vi->currentOffsetIndex++;
+        vi->currentLane = enteredLane;
 
 #ifdef DEBUG_E2_NOTIFY_ENTER_AND_LEAVE
         if DEBUG_COND {
             std::cout << SIMTIME << " Vehicle '" << veh.getID() << "' on lane '" << veh.getLane()->getID()
                           << "' already known. No new VehicleInfo is created.\n"
-                          << "enteredLane = " << enteredLane->getID() << "\nmyLanes[vi->offset] = " << myLanes[vi->second->currentOffsetIndex]
+                          << "enteredLane = " << enteredLane->getID() << "\nmyLanes[vi->offset] = " << myLanes[vi->currentOffsetIndex]
                           << std::endl;
         }
 #endif
-        assert(myLanes[vi->second->currentOffsetIndex] == enteredLane->getID());
+        assert(myLanes[vi->currentOffsetIndex] == enteredLane->getID());
 
         // but don't add a second subscription for another lane
         return false;
@@ -780,13 +776,13 @@ MSE2Collector::notifyEnter(SUMOVehicle& veh, MSMoveReminder::Notification /* rea
 #endif
 
     // Add vehicle info
-    myVehicleInfos.insert(std::make_pair(vehID, makeVehicleInfo(veh, enteredLane)));
+    addVehicleInfo(makeVehicleInfo(veh, enteredLane));
     // Subscribe to vehicle's movement notifications
     return true;
 }
 
 MSE2Collector::VehicleInfo*
-MSE2Collector::makeVehicleInfo(const SUMOVehicle& veh, const MSLane* enteredLane) const {
+MSE2Collector::makeVehicleInfo(const SUMOVehicle& veh, const MSLane* enteredLane) {
     // The vehicle's distance to the detector end
     int j = (int)(std::find(myLanes.begin(), myLanes.end(), enteredLane->getID()) - myLanes.begin());
     assert(j >= 0 && j < (int)myLanes.size());
@@ -803,8 +799,57 @@ MSE2Collector::makeVehicleInfo(const SUMOVehicle& veh, const MSLane* enteredLane
                 << std::endl;
     }
 #endif
-    return new VehicleInfo(veh.getID(), veh.getVehicleType().getID(), veh.getVehicleType().getLength(), veh.getVehicleType().getMinGap(), enteredLane, entryOffset, j,
+    const VehicleInfo info(veh.getID(), veh.getNumericalID(), veh.getVehicleType().getID(), veh.getVehicleType().getLength(), veh.getVehicleType().getMinGap(), enteredLane, entryOffset, j,
                            myOffsets[j] - myDetectorLength, distToDetectorEnd, onDetector);
+    if (myVehicleInfoPool.empty()) {
+        return new VehicleInfo(info);
+    }
+    VehicleInfo* result = myVehicleInfoPool.back();
+    myVehicleInfoPool.pop_back();
+    *result = info;
+    return result;
+}
+
+
+MSE2Collector::VehicleInfo*
+MSE2Collector::getVehicleInfo(const SUMOVehicle::NumericalID id) const {
+    std::vector<std::pair<SUMOVehicle::NumericalID, VehicleInfo*> >::const_iterator i =
+        std::lower_bound(myVehicleInfoIndex.begin(), myVehicleInfoIndex.end(), id, compareNumericalID<VehicleInfo*>);
+    if (i != myVehicleInfoIndex.end() && i->first == id) {
+        return i->second;
+    }
+    return 0;
+}
+
+
+void
+MSE2Collector::addVehicleInfo(VehicleInfo* vi) {
+    myVehicleInfoIndex.insert(std::lower_bound(myVehicleInfoIndex.begin(), myVehicleInfoIndex.end(), vi->numericalID, compareNumericalID<VehicleInfo*>),
+                              std::make_pair(vi->numericalID, vi));
+    myVehicleInfos.insert(std::lower_bound(myVehicleInfos.begin(), myVehicleInfos.end(), vi, compareVehicleInfoID), vi);
+}
+
+
+void
+MSE2Collector::removeVehicleInfo(VehicleInfo* vi) {
+    std::vector<std::pair<SUMOVehicle::NumericalID, VehicleInfo*> >::iterator i =
+        std::lower_bound(myVehicleInfoIndex.begin(), myVehicleInfoIndex.end(), vi->numericalID, compareNumericalID<VehicleInfo*>);
+    assert(i != myVehicleInfoIndex.end() && i->second == vi);
+    myVehicleInfoIndex.erase(i);
+    VehicleInfoCont::iterator j = std::lower_bound(myVehicleInfos.begin(), myVehicleInfos.end(), vi, compareVehicleInfoID);
+    assert(j != myVehicleInfos.end() && *j == vi);
+    myVehicleInfos.erase(j);
+    myVehicleInfoPool.push_back(vi);
+}
+
+
+MSE2Collector::HaltingDurations::const_iterator
+MSE2Collector::findHalting(const HaltingDurations& durations, const SUMOVehicle::NumericalID id) {
+    HaltingDurations::const_iterator i = std::lower_bound(durations.begin(), durations.end(), id, compareNumericalID<SUMOTime>);
+    if (i != durations.end() && i->first == id) {
+        return i;
+    }
+    return durations.end();
 }
 
 void
@@ -832,38 +877,34 @@ MSE2Collector::detectorUpdate(const SUMOTime /* step */) {
     myCurrentStartedHalts = 0;
     myCurrentHaltingsNumber = 0;
 
-    JamInfo* currentJam = 0;
-    std::vector<JamInfo*> jams;
-    std::map<std::string, SUMOTime> haltingVehicles;
-    std::map<std::string, SUMOTime> intervalHaltingVehicles;
+    bool jamOpen = false;
+    myJams.clear();
+    myNextHaltingVehicleDurations.clear();
+    myNextIntervalHaltingVehicleDurations.clear();
 
     // go through the list of vehicles positioned on the detector
-    for (std::vector<MoveNotificationInfo*>::iterator i = myMoveNotifications.begin(); i != myMoveNotifications.end(); ++i) {
-        // The ID of the vehicle that has sent this notification in the last step
-        const std::string& vehID = (*i)->id;
-        VehicleInfoMap::iterator vi = myVehicleInfos.find(vehID);
-
-        if (vi == myVehicleInfos.end()) {
-            // The vehicle has already left the detector by lanechange, teleport, etc. (not longitudinal)
-            integrateMoveNotification(0, *i);
-        } else {
-            // Add move notification infos to detector values and VehicleInfo
-            integrateMoveNotification(vi->second, *i);
-        }
+    for (std::vector<MoveNotificationInfo>::const_iterator i = myMoveNotifications.begin(); i != myMoveNotifications.end(); ++i) {
+        // The info of the vehicle that has sent this notification in the last step
+        // (0 if the vehicle has already left the detector by lanechange, teleport, etc. (not longitudinal))
+        VehicleInfo* vi = getVehicleInfo(i->id);
+        // Add move notification infos to detector values and VehicleInfo
+        integrateMoveNotification(vi, *i);
         // construct jam structure
-        bool isInJam = checkJam(i, haltingVehicles, intervalHaltingVehicles);
-        buildJam(isInJam, i, currentJam, jams);
+        bool isInJam = checkJam(i, myNextHaltingVehicleDurations, myNextIntervalHaltingVehicleDurations);
+        buildJam(isInJam, i, jamOpen);
     }
 
     // extract some aggregated values from the jam structure
-    processJams(jams, currentJam);
+    processJams();
 
     // Aggregate and normalize values for the detector output
     aggregateOutputValues();
 
     // save information about halting vehicles
-    myHaltingVehicleDurations = haltingVehicles;
-    myIntervalHaltingVehicleDurations = intervalHaltingVehicles;
+    std::sort(myNextHaltingVehicleDurations.begin(), myNextHaltingVehicleDurations.end());
+    std::sort(myNextIntervalHaltingVehicleDurations.begin(), myNextIntervalHaltingVehicleDurations.end());
+    myHaltingVehicleDurations.swap(myNextHaltingVehicleDurations);
+    myIntervalHaltingVehicleDurations.swap(myNextIntervalHaltingVehicleDurations);
 
 #ifdef DEBUG_E2_DETECTOR_UPDATE
     if DEBUG_COND {
@@ -871,16 +912,15 @@ MSE2Collector::detectorUpdate(const SUMOTime /* step */) {
     }
 #endif
     // update current and entered lanes for remaining vehicles
-    VehicleInfoMap::iterator iv;
-    for (iv = myVehicleInfos.begin(); iv != myVehicleInfos.end(); ++iv) {
 #ifdef DEBUG_E2_DETECTOR_UPDATE
+    for (VehicleInfoCont::const_iterator iv = myVehicleInfos.begin(); iv != myVehicleInfos.end(); ++iv) {
         if DEBUG_COND {
-            std::cout << " Vehicle '" << iv->second->id << "'" << ": '"
-                    << iv->second->currentLane->getID() << "'"
+            std::cout << " Vehicle '" << (*iv)->id << "'" << ": '"
+                    << (*iv)->currentLane->getID() << "'"
                     << std::endl;
         }
-#endif
     }
+#endif
 
 #ifdef DEBUG_E2_DETECTOR_UPDATE
     if DEBUG_COND {
@@ -888,24 +928,20 @@ MSE2Collector::detectorUpdate(const SUMOTime /* step */) {
     }
 #endif
     // Remove the vehicles that have left the detector
-    std::set<std::string>::const_iterator i;
-    for (i = myLeftVehicles.begin(); i != myLeftVehicles.end(); ++i) {
-        VehicleInfoMap::iterator j = myVehicleInfos.find(*i);
-        delete j->second;
-        myVehicleInfos.erase(*i);
-        myNumberOfLeftVehicles++;
+    for (std::vector<SUMOVehicle::NumericalID>::const_iterator i = myLeftVehicles.begin(); i != myLeftVehicles.end(); ++i) {
+        VehicleInfo* vi = getVehicleInfo(*i);
+        assert(vi != 0);
 #ifdef DEBUG_E2_DETECTOR_UPDATE
         if DEBUG_COND {
-            std::cout << "Erased vehicle '" << *i << "'" << std::endl;
+            std::cout << "Erased vehicle '" << vi->id << "'" << std::endl;
         }
 #endif
+        removeVehicleInfo(vi);
+        myNumberOfLeftVehicles++;
     }
     myLeftVehicles.clear();
 
-    // reset move notifications
-    for (std::vector<MoveNotificationInfo*>::iterator j = myMoveNotifications.begin(); j != myMoveNotifications.end(); ++j) {
-        delete *j;
-    }
+    // reset move notifications (keeping the allocated storage)
     myMoveNotifications.clear();
 }
 
@@ -935,42 +971,42 @@ MSE2Collector::aggregateOutputValues() {
 
 
 void
-MSE2Collector::integrateMoveNotification(VehicleInfo* vi, const MoveNotificationInfo* mni) {
+MSE2Collector::integrateMoveNotification(VehicleInfo* vi, const MoveNotificationInfo& mni) {
 
 #ifdef DEBUG_E2_DETECTOR_UPDATE
     if DEBUG_COND {
-        std::cout << SIMTIME << " integrateMoveNotification() for vehicle '" << mni->id << "'"
-                << "\ntimeOnDetector = " << mni->timeOnDetector
-                << "\nlengthOnDetector = " << mni->lengthOnDetector
-                << "\ntimeLoss = " << mni->timeLoss
-                << "\nspeed = " << mni->speed
+        std::cout << SIMTIME << " integrateMoveNotification() for vehicle #" << mni.id
+                << "\ntimeOnDetector = " << mni.timeOnDetector
+                << "\nlengthOnDetector = " << mni.lengthOnDetector
+                << "\ntimeLoss = " << mni.timeLoss
+                << "\nspeed = " << mni.speed
                 << std::endl;
     }
 #endif
 
     // Accumulate detector values
-    myVehicleSamples += mni->timeOnDetector;
-    myTotalTimeLoss += mni->timeLoss;
-    mySpeedSum += mni->speed * mni->timeOnDetector;
-    myCurrentMeanSpeed += mni->speed * mni->timeOnDetector;
-    myCurrentMeanLength += mni->lengthOnDetector;
+    myVehicleSamples += mni.timeOnDetector;
+    myTotalTimeLoss += mni.timeLoss;
+    mySpeedSum += mni.speed * mni.timeOnDetector;
+    myCurrentMeanSpeed += mni.speed * mni.timeOnDetector;
+    myCurrentMeanLength += mni.lengthOnDetector;
 
     if (vi != 0) {
         // Accumulate individual values for the vehicle.
         // @note vi==0 occurs, if the vehicle info has been erased at
         //       notifyLeave() in case of a non-longitudinal exit (lanechange, teleport, etc.)
-        vi->totalTimeOnDetector += mni->timeOnDetector;
-        vi->accumulatedTimeLoss += mni->timeLoss;
-        vi->lastAccel = mni->accel;
-        vi->lastSpeed = mni->speed;
-        vi->lastPos = myStartPos + vi->entryOffset + mni->newPos;
-        vi->onDetector = mni->onDetector;
+        vi->totalTimeOnDetector += mni.timeOnDetector;
+        vi->accumulatedTimeLoss += mni.timeLoss;
+        vi->lastAccel = mni.accel;
+        vi->lastSpeed = mni.speed;
+        vi->lastPos = myStartPos + vi->entryOffset + mni.newPos;
+        vi->onDetector = mni.onDetector;
     }
 }
 
 
 
-MSE2Collector::MoveNotificationInfo*
+MSE2Collector::MoveNotificationInfo
 MSE2Collector::makeMoveNotification(const SUMOVehicle& veh, double oldPos, double newPos, double newSpeed, const VehicleInfo& vehInfo) const {
 #ifdef DEBUG_E2_NOTIFY_MOVE
     if DEBUG_COND {
@@ -1011,114 +1047,113 @@ MSE2Collector::makeMoveNotification(const SUMOVehicle& veh, double oldPos, doubl
 #endif
 
     /* Store new infos */
-    return new MoveNotificationInfo(veh.getID(), oldPos, newPos, newSpeed, veh.getAcceleration(), myDetectorLength - (vehInfo.entryOffset + newPos), timeOnDetector, lengthOnDetector, timeLoss, stillOnDetector);
+    return MoveNotificationInfo(veh.getNumericalID(), oldPos, newPos, newSpeed, veh.getAcceleration(), myDetectorLength - (vehInfo.entryOffset + newPos), timeOnDetector, lengthOnDetector, timeLoss, stillOnDetector);
 }
 
 void
-MSE2Collector::buildJam(bool isInJam, std::vector<MoveNotificationInfo*>::const_iterator mni, JamInfo*& currentJam, std::vector<JamInfo*>& jams) {
+MSE2Collector::buildJam(bool isInJam, std::vector<MoveNotificationInfo>::const_iterator mni, bool& jamOpen) {
 #ifdef DEBUG_E2_JAMS
     if DEBUG_COND {
-        std::cout << SIMTIME << " buildJam() for vehicle '" << (*mni)->id << "'" << std::endl;
+        std::cout << SIMTIME << " buildJam() for vehicle #" << mni->id << std::endl;
     }
 #endif
     if (isInJam) {
         // The vehicle is in a jam;
         //  it may be a new one or already an existing one
-        if (currentJam == 0) {
+        if (!jamOpen) {
 #ifdef DEBUG_E2_JAMS
             if DEBUG_COND {
-                std::cout << SIMTIME << " vehicle '" << (*mni)->id << "' forms the start of the first jam" << std::endl;
+                std::cout << SIMTIME << " vehicle #" << mni->id << " forms the start of the first jam" << std::endl;
             }
 #endif
             // the vehicle is the first vehicle in a jam
-            currentJam = new JamInfo();
-            currentJam->firstStandingVehicle = mni;
+            myJams.push_back(JamInfo());
+            myJams.back().firstStandingVehicle = mni;
+            jamOpen = true;
         } else {
             // ok, we have a jam already. But - maybe it is too far away
             //  ... honestly, I can hardly find a reason for doing this,
             //  but jams were defined this way in an earlier version...
-            MoveNotificationInfo* lastVeh = *currentJam->lastStandingVehicle;
-            MoveNotificationInfo* currVeh = *mni;
-            if (lastVeh->distToDetectorEnd - currVeh->distToDetectorEnd > myJamDistanceThreshold) {
+            const MoveNotificationInfo& lastVeh = *myJams.back().lastStandingVehicle;
+            const MoveNotificationInfo& currVeh = *mni;
+            if (lastVeh.distToDetectorEnd - currVeh.distToDetectorEnd > myJamDistanceThreshold) {
 #ifdef DEBUG_E2_JAMS
                 if DEBUG_COND {
-                    std::cout << SIMTIME << " vehicle '" << (*mni)->id << "' forms the start of a new jam" << std::endl;
+                    std::cout << SIMTIME << " vehicle #" << mni->id << " forms the start of a new jam" << std::endl;
                 }
 #endif
                 // yep, yep, yep - it's a new one...
                 //  close the frist, build a new
-                jams.push_back(currentJam);
-                currentJam = new JamInfo();
-                currentJam->firstStandingVehicle = mni;
+                myJams.push_back(JamInfo());
+                myJams.back().firstStandingVehicle = mni;
             }
         }
-        currentJam->lastStandingVehicle = mni;
+        myJams.back().lastStandingVehicle = mni;
     } else {
         // the vehicle is not part of a jam...
         //  maybe we have to close an already computed jam
-        if (currentJam != 0) {
+        if (jamOpen) {
 #ifdef DEBUG_E2_JAMS
             if DEBUG_COND {
                 std::cout << SIMTIME << " Closing current jam." << std::endl;
             }
 #endif
-            jams.push_back(currentJam);
-            currentJam = 0;
+            jamOpen = false;
         }
     }
 }
 
 
 bool
-MSE2Collector::checkJam(std::vector<MoveNotificationInfo*>::const_iterator mni, std::map<std::string, SUMOTime>& haltingVehicles, std::map<std::string, SUMOTime>& intervalHaltingVehicles) {
+MSE2Collector::checkJam(std::vector<MoveNotificationInfo>::const_iterator mni, HaltingDurations& haltingVehicles, HaltingDurations& intervalHaltingVehicles) {
 #ifdef DEBUG_E2_JAMS
     if DEBUG_COND {
-        std::cout << SIMTIME << " CheckJam() for vehicle '" << (*mni)->id << "'" << std::endl;
+        std::cout << SIMTIME << " CheckJam() for vehicle #" << mni->id << std::endl;
     }
 #endif
     // jam-checking begins
     bool isInJam = false;
+    const HaltingDurations::const_iterator halting = findHalting(myHaltingVehicleDurations, mni->id);
+    const HaltingDurations::const_iterator intervalHalting = findHalting(myIntervalHaltingVehicleDurations, mni->id);
     // first, check whether the vehicle is slow enough to be counted as halting
-    if ((*mni)->speed < myJamHaltingSpeedThreshold) {
+    if (mni->speed < myJamHaltingSpeedThreshold) {
         myCurrentHaltingsNumber++;
         // we have to track the time it was halting;
         // so let's look up whether it was halting before and compute the overall halting time
-        bool wasHalting = myHaltingVehicleDurations.count((*mni)->id) > 0;
+        bool wasHalting = halting != myHaltingVehicleDurations.end();
         if (wasHalting) {
-            haltingVehicles[(*mni)->id] = myHaltingVehicleDurations[(*mni)->id] + DELTA_T;
-            intervalHaltingVehicles[(*mni)->id] = myIntervalHaltingVehicleDurations[(*mni)->id] + DELTA_T;
+            haltingVehicles.push_back(std::make_pair(mni->id, halting->second + DELTA_T));
+            const SUMOTime intervalDuration = intervalHalting != myIntervalHaltingVehicleDurations.end() ? intervalHalting->second : 0;
+            intervalHaltingVehicles.push_back(std::make_pair(mni->id, intervalDuration + DELTA_T));
         } else {
 #ifdef DEBUG_E2_JAMS
             if DEBUG_COND {
-                std::cout << SIMTIME << " vehicle '" << (*mni)->id << "' starts halting." << std::endl;
+                std::cout << SIMTIME << " vehicle #" << mni->id << " starts halting." << std::endl;
             }
 #endif
-            haltingVehicles[(*mni)->id] = DELTA_T;
-            intervalHaltingVehicles[(*mni)->id] = DELTA_T;
+            haltingVehicles.push_back(std::make_pair(mni->id, DELTA_T));
+            intervalHaltingVehicles.push_back(std::make_pair(mni->id, DELTA_T));
             myCurrentStartedHalts++;
             myStartedHalts++;
         }
         // we now check whether the halting time is large enough
-        if (haltingVehicles[(*mni)->id] > myJamHaltingTimeThreshold) {
+        if (haltingVehicles.back().second > myJamHaltingTimeThreshold) {
             // yep --> the vehicle is a part of a jam
             isInJam = true;
         }
     } else {
         // is not standing anymore; keep duration information
-        std::map<std::string, SUMOTime>::iterator v = myHaltingVehicleDurations.find((*mni)->id);
-        if (v != myHaltingVehicleDurations.end()) {
-            myPastStandingDurations.push_back(v->second);
-            myHaltingVehicleDurations.erase(v);
+        // (the durations of the last step are replaced in detectorUpdate())
+        if (halting != myHaltingVehicleDurations.end()) {
+            myPastStandingDurations.push_back(halting->second);
         }
-        v = myIntervalHaltingVehicleDurations.find((*mni)->id);
-        if (v != myIntervalHaltingVehicleDurations.end()) {
-            myPastIntervalStandingDurations.push_back((*v).second);
-            myIntervalHaltingVehicleDurations.erase(v);
+        if (intervalHalting != myIntervalHaltingVehicleDurations.end()) {
+            myPastIntervalStandingDurations.push_back(intervalHalting->second);
         }
     }
 #ifdef DEBUG_E2_JAMS
     if DEBUG_COND {
-        std::cout << SIMTIME << " vehicle '" << (*mni)->id << "'" << (isInJam ? "is jammed." : "is not jammed.") << std::endl;
+        std::cout << SIMTIME << " vehicle #" << mni->id << (isInJam ? " is jammed." : " is not jammed.") << std::endl;
     }
 #endif
     return isInJam;
@@ -1126,17 +1161,11 @@ MSE2Collector::checkJam(std::vector<MoveNotificationInfo*>::const_iterator mni,
 
 
 void
-MSE2Collector::processJams(std::vector<JamInfo*>& jams, JamInfo* currentJam) {
-    // push last jam
-    if (currentJam != 0) {
-        jams.push_back(currentJam);
-        currentJam = 0;
-    }
-
+MSE2Collector::processJams() {
 #ifdef DEBUG_E2_JAMS
     if DEBUG_COND {
         std::cout << "\n" << SIMTIME << " processJams()"
-                  << "\nNumber of jams: " << jams.size() << std::endl;
+                  << "\nNumber of jams: " << myJams.size() << std::endl;
     }
 #endif
 
@@ -1145,14 +1174,14 @@ MSE2Collector::processJams(std::vector<JamInfo*>& jams, JamInfo* currentJam) {
     myCurrentMaxJamLengthInVehicles = 0;
     myCurrentJamLengthInMeters = 0;
     myCurrentJamLengthInVehicles = 0;
-    for (std::vector<JamInfo*>::const_iterator i = jams.begin(); i != jams.end(); ++i) {
+    for (std::vector<JamInfo>::const_iterator i = myJams.begin(); i != myJams.end(); ++i) {
         // compute current jam's values
-        MoveNotificationInfo* lastVeh = *((*i)->lastStandingVehicle);
-        MoveNotificationInfo* firstVeh = *((*i)->firstStandingVehicle);
-        const double jamLengthInMeters = lastVeh->distToDetectorEnd
-                                         - firstVeh->distToDetectorEnd
-                                         + lastVeh->lengthOnDetector;
-        const int jamLengthInVehicles = (int) distance((*i)->firstStandingVehicle, (*i)->lastStandingVehicle) + 1;
+        const MoveNotificationInfo& lastVeh = *(i->lastStandingVehicle);
+        const MoveNotificationInfo& firstVeh = *(i->firstStandingVehicle);
+        const double jamLengthInMeters = lastVeh.distToDetectorEnd
+                                         - firstVeh.distToDetectorEnd
+                                         + lastVeh.lengthOnDetector;
+        const int jamLengthInVehicles = (int) distance(i->firstStandingVehicle, i->lastStandingVehicle) + 1;
         // apply them to the statistics
         myCurrentMaxJamLengthInMeters = MAX2(myCurrentMaxJamLengthInMeters, jamLengthInMeters);
         myCurrentMaxJamLengthInVehicles = MAX2(myCurrentMaxJamLengthInVehicles, jamLengthInVehicles);
@@ -1162,19 +1191,14 @@ MSE2Collector::processJams(std::vector<JamInfo*>& jams, JamInfo* currentJam) {
         myCurrentJamLengthInVehicles += jamLengthInVehicles;
 #ifdef DEBUG_E2_JAMS
         if DEBUG_COND {
-            std::cout << SIMTIME << " processing jam nr." << ((int) distance((std::vector<JamInfo*>::const_iterator) jams.begin(), i) + 1)
+            std::cout << SIMTIME << " processing jam nr." << ((int) distance((std::vector<JamInfo>::const_iterator) myJams.begin(), i) + 1)
                           << "\njamLengthInMeters = " << jamLengthInMeters
                           << " jamLengthInVehicles = " << jamLengthInVehicles
                           << std::endl;
         }
 #endif
     }
-    myCurrentJamNo = (int) jams.size();
-
-    // clean up jam structure
-    for (std::vector<JamInfo*>::iterator i = jams.begin(); i != jams.end(); ++i) {
-        delete *i;
-    }
+    myCurrentJamNo = (int) myJams.size();
 }
 
 void
@@ -1261,7 +1285,7 @@ MSE2Collector::writeXMLOutput(OutputDevice& dev, SUMOTime startTime, SUMOTime st
         maxHaltingDuration = MAX2(maxHaltingDuration, (*i));
         haltingNo++;
     }
-    for (std::map<std::string, SUMOTime> ::iterator i = myHaltingVehicleDurations.begin(); i != myHaltingVehicleDurations.end(); ++i) {
+    for (HaltingDurations::const_iterator i = myHaltingVehicleDurations.begin(); i != myHaltingVehicleDurations.end(); ++i) {
         haltingDurationSum += (*i).second;
         maxHaltingDuration = MAX2(maxHaltingDuration, (*i).second);
         haltingNo++;
@@ -1276,7 +1300,7 @@ MSE2Collector::writeXMLOutput(OutputDevice& dev, SUMOTime startTime, SUMOTime st
         intervalMaxHaltingDuration = MAX2(intervalMaxHaltingDuration, (*i));
         intervalHaltingNo++;
     }
-    for (std::map<std::string, SUMOTime> ::iterator i = myIntervalHaltingVehicleDurations.begin(); i != myIntervalHaltingVehicleDurations.end(); ++i) {
+    for (HaltingDurations::const_iterator i = myIntervalHaltingVehicleDurations.begin(); i != myIntervalHaltingVehicleDurations.end(); ++i) {
         intervalHaltingDurationSum += (*i).second;
         intervalMaxHaltingDuration = MAX2(intervalMaxHaltingDuration, (*i).second);
         intervalHaltingNo++;
@@ -1346,7 +1370,7 @@ MSE2Collector::reset() {
     myMaxJamInMeters = 0;
     myTimeSamples = 0;
     myMeanVehicleNumber = 0;
-    for (std::map<std::string, SUMOTime>::iterator i = myIntervalHaltingVehicleDurations.begin(); i != myIntervalHaltingVehicleDurations.end(); ++i) {
+    for (HaltingDurations::iterator i = myIntervalHaltingVehicleDurations.begin(); i != myIntervalHaltingVehicleDurations.end(); ++i) {
         (*i).second = 0;
     }
     myPastStandingDurations.clear();
@@ -1357,8 +1381,8 @@ MSE2Collector::reset() {
 int
 MSE2Collector::getCurrentVehicleNumber() const {
     int result = 0;
-    for (VehicleInfoMap::const_iterator it = myVehicleInfos.begin(); it != myVehicleInfos.end(); it++) {
-        if (it->second->onDetector) {
+    for (VehicleInfoCont::const_iterator it = myVehicleInfos.begin(); it != myVehicleInfos.end(); it++) {
+        if ((*it)->onDetector) {
             result++;
         }
     }
@@ -1370,9 +1394,9 @@ MSE2Collector::getCurrentVehicleNumber() const {
 std::vector<std::string>
 MSE2Collector::getCurrentVehicleIDs() const {
     std::vector<std::string> ret;
-    for (VehicleInfoMap::const_iterator i = myVehicleInfos.begin(); i != myVehicleInfos.end(); ++i) {
-        if (i->second->onDetector) {
-            ret.push_back(i->second->id);
+    for (VehicleInfoCont::const_iterator i = myVehicleInfos.begin(); i != myVehicleInfos.end(); ++i) {
+        if ((*i)->onDetector) {
+            ret.push_back((*i)->id);
         }
     }
     std::sort(ret.begin(), ret.end());
@@ -1383,10 +1407,10 @@ MSE2Collector::getCurrentVehicleIDs() const {
 std::vector<MSE2Collector::VehicleInfo*>
 MSE2Collector::getCurrentVehicles() const {
     std::vector<VehicleInfo*> res;
-    VehicleInfoMap::const_iterator i;
+    VehicleInfoCont::const_iterator i;
     for (i = myVehicleInfos.begin(); i != myVehicleInfos.end(); ++i) {
-        if (i->second->onDetector) {
-            res.push_back(i->second);
+        if ((*i)->onDetector) {
+            res.push_back(*i);
         }
     }
     return res;
@@ -1401,16 +1425,16 @@ MSE2Collector::getEstimatedCurrentVehicleNumber(double speedThreshold) const {
     double thresholdSpeed = myLane->getSpeedLimit() / speedThreshold;
 
     int count = 0;
-    for (VehicleInfoMap::const_iterator it = myVehicleInfos.begin();
+    for (VehicleInfoCont::const_iterator it = myVehicleInfos.begin();
             it != myVehicleInfos.end(); it++) {
-        if (it->second->onDetector) {
+        if ((*it)->onDetector) {
 //            if (it->position < distance) {
 //                distance = it->position;
 //            }
 //            const double realDistance = myLane->getLength() - distance; // the closer vehicle get to the light the greater is the distance
-            const double realDistance = it->second->distToDetectorEnd;
-            if (it->second->lastSpeed <= thresholdSpeed || it->second->lastAccel > 0) { //TODO speed less half of the maximum speed for the lane NEED TUNING
-                count = (int)(realDistance / (it->second->length + it->second->minGap)) + 1;
+            const double realDistance = (*it)->distToDetectorEnd;
+            if ((*it)->lastSpeed <= thresholdSpeed || (*it)->lastAccel > 0) { //TODO speed less half of the maximum speed for the lane NEED TUNING
+                count = (int)(realDistance / ((*it)->length + (*it)->minGap)) + 1;
             }
         }
     }
@@ -1428,13 +1452,13 @@ MSE2Collector::getEstimateQueueLength() const {
     double distance = std::numeric_limits<double>::max();
     double realDistance = 0;
     bool flowing =  true;
-    for (VehicleInfoMap::const_iterator it = myVehicleInfos.begin();
+    for (VehicleInfoCont::const_iterator it = myVehicleInfos.begin();
             it != myVehicleInfos.end(); it++) {
-        if (it->second->onDetector) {
-            distance = MIN2(it->second->lastPos, distance);
+        if ((*it)->onDetector) {
+            distance = MIN2((*it)->lastPos, distance);
             //  double distanceTemp = myLane->getLength() - distance;
-            if (it->second->lastSpeed <= 0.5) {
-                realDistance = distance - it->second->length + it->second->minGap;
+            if ((*it)->lastSpeed <= 0.5) {
+                realDistance = distance - (*it)->length + (*it)->minGap;
                 flowing = false;
             }
 //            DBG(
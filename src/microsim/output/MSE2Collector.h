@@ -71,12 +71,15 @@ class OutputDevice;
  *        notifications sent by vehicles on the detector are temporarily stored
  *        in myMoveNotifications, see notifyMove(). Finally they are integrated
  *        into myVehicleInfos when updateDetector is called.
+ * @note VehicleInfos are looked up by the vehicles' numerical ids and are reused
+ *        after the vehicle left, move notifications are stored by value. Once the
+ *        containers have grown to the number of vehicles on the detector, no
+ *        allocations take place in the per-step processing.
  * @note When subclassing this detector, it is probably sufficient to adapt the
- *        definition of the structs VehicleInfo and the MoveNotification, as well as
- *        the methods that define and create those structs, i.e., makeVehicleInfo()
- *        and makeMoveNotification(). Further the integration of new movement
- *        notifications of the last time step into the vehicle infos is done
- *        in updateVehicleInfos().
+ *        definition of the struct VehicleInfo as well as the methods that define
+ *        and create the structs, i.e., makeVehicleInfo() and makeMoveNotification().
+ *        Further the integration of new movement notifications of the last time
+ *        step into the vehicle infos is done in integrateMoveNotification().
  *
  */
 
@@ -90,9 +93,10 @@ public:
     struct VehicleInfo {
         /** @note Constructor expects an entryLane argument corresponding to a lane, which is part of the detector.
         */
-        VehicleInfo(std::string id, std::string type, double length, double minGap, const MSLane* entryLane, double entryOffset,
+        VehicleInfo(std::string id, SUMOVehicle::NumericalID numericalID, std::string type, double length, double minGap, const MSLane* entryLane, double entryOffset,
                     std::size_t currentOffsetIndex, double exitOffset, double distToDetectorEnd, bool onDetector) :
             id(id),
+            numericalID(numericalID),
             type(type),
             length(length),
             minGap(minGap),
@@ -114,6 +118,8 @@ public:
         virtual ~VehicleInfo() {};
         /// vehicle's ID
         std::string id;
+        /// vehicle's numerical ID
+        SUMOVehicle::NumericalID numericalID;
         /// vehicle's type
         std::string type;
         /// vehicle's length
@@ -153,7 +159,8 @@ public:
         double lastPos;
     };
 
-    typedef std::map<std::string, VehicleInfo*> VehicleInfoMap;
+    /// @brief VehicleInfos sorted by vehicle id
+    typedef std::vector<VehicleInfo*> VehicleInfoCont;
 
 
 private:
@@ -162,7 +169,7 @@ private:
      *          temporarily stored in myMoveNotifications for each step.
     */
     struct MoveNotificationInfo {
-        MoveNotificationInfo(std::string _vehID, double _oldPos, double _newPos, double _speed, double _accel, double _distToDetectorEnd, double _timeOnDetector, double _lengthOnDetector, double _timeLoss, bool _onDetector) :
+        MoveNotificationInfo(SUMOVehicle::NumericalID _vehID, double _oldPos, double _newPos, double _speed, double _accel, double _distToDetectorEnd, double _timeOnDetector, double _lengthOnDetector, double _timeLoss, bool _onDetector) :
             id(_vehID),
             oldPos(_oldPos),
             newPos(_newPos),
@@ -174,10 +181,8 @@ private:
             timeLoss(_timeLoss),
             onDetector(_onDetector) {}
 
-        virtual ~MoveNotificationInfo() {};
-
-        /// Vehicle's id
-        std::string id;
+        /// Vehicle's numerical id
+        SUMOVehicle::NumericalID id;
         /// Position before the last integration step (relative to the vehicle's entry lane on the detector)
         double oldPos;
         /// Position after the last integration step (relative to the vehicle's entry lane on the detector)
@@ -207,12 +212,15 @@ private:
      */
     struct JamInfo {
         /// @brief The first standing vehicle
-        std::vector<MoveNotificationInfo*>::const_iterator firstStandingVehicle;
+        std::vector<MoveNotificationInfo>::const_iterator firstStandingVehicle;
 
         /// @brief The last standing vehicle
-        std::vector<MoveNotificationInfo*>::const_iterator lastStandingVehicle;
+        std::vector<MoveNotificationInfo>::const_iterator lastStandingVehicle;
     };
 
+    /// @brief Halting durations of vehicles, sorted by the vehicles' numerical ids
+    typedef std::vector<std::pair<SUMOVehicle::NumericalID, SUMOTime> > HaltingDurations;
+
 
 public:
 
@@ -527,24 +535,22 @@ private:
      * @param[in/out] intervalHaltingVehicles
      * @return Whether vehicle is in a jam.
      */
-    bool checkJam(std::vector<MoveNotificationInfo*>::const_iterator mni, std::map<std::string, SUMOTime>& haltingVehicles, std::map<std::string, SUMOTime>& intervalHaltingVehicles);
+    bool checkJam(std::vector<MoveNotificationInfo>::const_iterator mni, HaltingDurations& haltingVehicles, HaltingDurations& intervalHaltingVehicles);
 
 
     /** @brief Either adds the vehicle to the end of an existing jam, or closes the last jam, and/or creates a new jam
      *
+     * The jams are collected in myJams.
      * @param isInJam
      * @param mni
-     * @param[in/out] currentJam
-     * @param[in/out] jams
+     * @param[in/out] jamOpen whether the last jam in myJams may still be extended
      */
-    void buildJam(bool isInJam, std::vector<MoveNotificationInfo*>::const_iterator mni, JamInfo*& currentJam, std::vector<JamInfo*>& jams);
+    void buildJam(bool isInJam, std::vector<MoveNotificationInfo>::const_iterator mni, bool& jamOpen);
 
 
-    /** @brief Calculates aggregated values from the given jam structure, deletes all jam-pointers
-     *
-     * @param jams
+    /** @brief Calculates aggregated values from the jams in myJams
      */
-    void processJams(std::vector<JamInfo*>& jams, JamInfo* currentJam);
+    void processJams();
 
     /** @brief Calculates the time spent on the detector in the last step and the timeloss suffered in the last step for the given vehicle
      *
@@ -606,7 +612,7 @@ private:
      * @param[in/out] vi VehicleInfo corresponding to the notifying vehicle
      * @param[in] mni MoveNotification for the vehicle
      */
-    void integrateMoveNotification(VehicleInfo* vi, const MoveNotificationInfo* mni);
+    void integrateMoveNotification(VehicleInfo* vi, const MoveNotificationInfo& mni);
 
     /** @brief Creates and returns a MoveNotificationInfo containing detector specific information on the vehicle's last movement
      *
@@ -617,15 +623,38 @@ private:
      * @param vehInfo Info on the detector's memory of the vehicle
      * @return A MoveNotificationInfo containing quantities of interest for the detector
      */
-    MoveNotificationInfo* makeMoveNotification(const SUMOVehicle& veh, double oldPos, double newPos, double newSpeed, const VehicleInfo& vehInfo) const;
+    MoveNotificationInfo makeMoveNotification(const SUMOVehicle& veh, double oldPos, double newPos, double newSpeed, const VehicleInfo& vehInfo) const;
 
     /** @brief Creates and returns a VehicleInfo (called at the vehicle's entry)
+     *
+     * A VehicleInfo of a vehicle which has left the detector is reused if available.
      *
      * @param veh The entering vehicle
      * @param enteredLane The entry lane
      * @return A vehicle info which can be used to store information about the vehicle's stay on the detector
      */
-    VehicleInfo* makeVehicleInfo(const SUMOVehicle& veh, const MSLane* enteredLane) const;
+    VehicleInfo* makeVehicleInfo(const SUMOVehicle& veh, const MSLane* enteredLane);
+
+    /** @brief Returns the VehicleInfo of the vehicle with the given numerical id
+     *
+     * @param[in] id The numerical id of the vehicle
+     * @return The vehicle's info, 0 if the vehicle is not known
+     */
+    VehicleInfo* getVehicleInfo(const SUMOVehicle::NumericalID id) const;
+
+    /// @brief Adds the given VehicleInfo to the lookup structures
+    void addVehicleInfo(VehicleInfo* vi);
+
+    /// @brief Removes the given VehicleInfo from the lookup structures and keeps it for reuse
+    void removeVehicleInfo(VehicleInfo* vi);
+
+    /** @brief Returns the position of the given vehicle in the given halting durations
+     *
+     * @param[in] durations The halting durations to search
+     * @param[in] id The numerical id of the vehicle
+     * @return The entry for the vehicle, durations.end() if there is none
+     */
+    static HaltingDurations::const_iterator findHalting(const HaltingDurations& durations, const SUMOVehicle::NumericalID id);
 
     /** @brief Calculates the time loss for a segment with constant vmax
      *
@@ -639,8 +668,19 @@ private:
 
     /** brief returns true if the vehicle corresponding to mni1 is closer to the detector end than the vehicle corresponding to mni2
      */
-    static bool compareMoveNotification(MoveNotificationInfo* mni1, MoveNotificationInfo* mni2) {
-        return mni1->distToDetectorEnd < mni2->distToDetectorEnd;
+    static bool compareMoveNotification(const MoveNotificationInfo& mni1, const MoveNotificationInfo& mni2) {
+        return mni1.distToDetectorEnd < mni2.distToDetectorEnd;
+    }
+
+    /// @brief returns true if vi1 belongs to a vehicle with a smaller id than the one of vi2
+    static bool compareVehicleInfoID(const VehicleInfo* const vi1, const VehicleInfo* const vi2) {
+        return vi1->id < vi2->id;
+    }
+
+    /// @brief returns true if the index entry belongs to a vehicle with a smaller numerical id than the given one
+    template<class T>
+    static bool compareNumericalID(const std::pair<SUMOVehicle::NumericalID, T>& entry, const SUMOVehicle::NumericalID id) {
+        return entry.first < id;
     }
 
 
@@ -677,23 +717,38 @@ private:
 
     /// @name Container
     /// @{
-    /// @brief List of informations about the vehicles currently on the detector
-    VehicleInfoMap myVehicleInfos;
+    /// @brief List of informations about the vehicles currently on the detector (sorted by vehicle id)
+    VehicleInfoCont myVehicleInfos;
+
+    /// @brief Index of myVehicleInfos by the vehicles' numerical ids (sorted by numerical id)
+    std::vector<std::pair<SUMOVehicle::NumericalID, VehicleInfo*> > myVehicleInfoIndex;
+
+    /// @brief VehicleInfos of vehicles which have left the detector, kept for reuse
+    std::vector<VehicleInfo*> myVehicleInfoPool;
 
     /// @brief Temporal storage for notifications from vehicles that did call the
     ///        detector's notifyMove() in the last time step.
-    std::vector<MoveNotificationInfo*> myMoveNotifications;
+    std::vector<MoveNotificationInfo> myMoveNotifications;
 
     /// @brief Keep track of vehicles that left the detector by a regular move along a junction (not lanechange, teleport, etc.)
     ///        and should be removed from myVehicleInfos after taking into account their movement. Non-longitudinal exits
     ///        are processed immediately in notifyLeave()
-    std::set<std::string> myLeftVehicles;
+    std::vector<SUMOVehicle::NumericalID> myLeftVehicles;
 
     /// @brief Storage for halting durations of known vehicles (for halting vehicles)
-    std::map<std::string, SUMOTime> myHaltingVehicleDurations;
+    HaltingDurations myHaltingVehicleDurations;
 
     /// @brief Storage for halting durations of known vehicles (current interval)
-    std::map<std::string, SUMOTime> myIntervalHaltingVehicleDurations;
+    HaltingDurations myIntervalHaltingVehicleDurations;
+
+    /// @brief Halting durations being collected during detectorUpdate() (swapped with myHaltingVehicleDurations)
+    HaltingDurations myNextHaltingVehicleDurations;
+
+    /// @brief Interval halting durations being collected during detectorUpdate() (swapped with myIntervalHaltingVehicleDurations)
+    HaltingDurations myNextIntervalHaltingVehicleDurations;
+
+    /// @brief The jams found during detectorUpdate() (cleared in every step)
+    std::vector<JamInfo> myJams;
 
     /// @brief Halting durations of ended halts [s]
     std::vector<SUMOTime> myPastStandingDurations;
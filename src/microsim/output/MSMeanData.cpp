@@ -87,6 +87,25 @@ MSMeanData::MeanDataValues::notifyEnter(SUMOVehicle& veh, MSMoveReminder::Notifi
 
 bool
 MSMeanData::MeanDataValues::notifyMove(SUMOVehicle& veh, double oldPos, double newPos, double newSpeed) {
+    MoveOnLane move;
+    if (computeMoveOnLane(veh, myLane, myLaneLength, oldPos, newPos, newSpeed, move)) {
+        notifyMoveInternal(veh, move.frontOnLane, move.timeOnLane, move.meanSpeedFrontOnLane, move.meanSpeedVehicleOnLane,
+                           move.travelledDistanceFrontOnLane, move.travelledDistanceVehicleOnLane, move.meanLengthOnLane);
+    }
+    return move.keep;
+}
+
+
+bool
+MSMeanData::MeanDataValues::vehicleApplies(const SUMOVehicle& veh) const {
+    return myParent == 0 || myParent->vehicleApplies(veh);
+}
+
+
+bool
+MSMeanData::MeanDataValues::computeMoveOnLane(SUMOVehicle& veh, const MSLane* const lane, const double laneLength,
+        const double oldPos, const double newPos, const double newSpeed,
+        MoveOnLane& into) {
     // if the vehicle has arrived, the reminder must be kept so it can be
     // notified of the arrival subsequently
     const double oldSpeed = veh.getPreviousSpeed();
@@ -95,13 +114,13 @@ MSMeanData::MeanDataValues::notifyMove(SUMOVehicle& veh, double oldPos, double n
 
     // These values will be further decreased below
     double timeOnLane = TS;
-    double frontOnLane = oldPos > myLaneLength ? 0. : TS;
+    double frontOnLane = oldPos > laneLength ? 0. : TS;
     bool ret = true;
 
     // entry and exit times (will be modified below)
     double timeBeforeEnter = 0.;
     double timeBeforeEnterBack = 0.;
-    double timeBeforeLeaveFront = newPos < myLaneLength ? TS : 0.;
+    double timeBeforeLeaveFront = newPos < laneLength ? TS : 0.;
     double timeBeforeLeave = TS;
 
     // Treat the case that the vehicle entered the lane in the last step
@@ -126,11 +145,11 @@ MSMeanData::MeanDataValues::notifyMove(SUMOVehicle& veh, double oldPos, double n
     }
 
     // Treat the case that the vehicle's back left the lane in the last step
-    if (newBackPos > myLaneLength // vehicle's back has left the lane
-            && oldBackPos <= myLaneLength) { // and hasn't left the lane before
+    if (newBackPos > laneLength // vehicle's back has left the lane
+            && oldBackPos <= laneLength) { // and hasn't left the lane before
         assert(!MSGlobals::gSemiImplicitEulerUpdate || newSpeed != 0); // how could it move across the lane boundary otherwise
         // (Leo) vehicle left this lane (it can also have skipped over it in one time step -> therefore we use "timeOnLane -= ..." and ( ... - timeOnLane) below)
-        timeBeforeLeave = MSCFModel::passingTime(oldBackPos, myLaneLength, newBackPos, oldSpeed, newSpeed);
+        timeBeforeLeave = MSCFModel::passingTime(oldBackPos, laneLength, newBackPos, oldSpeed, newSpeed);
         const double timeAfterLeave = TS - timeBeforeLeave;
         timeOnLane -= timeAfterLeave;
         leaveSpeed = MSCFModel::speedAfterTime(timeBeforeLeave, oldSpeed, newPos - oldPos);
@@ -142,10 +161,10 @@ MSMeanData::MeanDataValues::notifyMove(SUMOVehicle& veh, double oldPos, double n
     }
 
     // Treat the case that the vehicle's front left the lane in the last step
-    if (newPos > myLaneLength && oldPos <= myLaneLength) {
+    if (newPos > laneLength && oldPos <= laneLength) {
         // vehicle's front has left the lane and has not left before
         assert(!MSGlobals::gSemiImplicitEulerUpdate || newSpeed != 0);
-        timeBeforeLeaveFront = MSCFModel::passingTime(oldPos, myLaneLength, newPos, oldSpeed, newSpeed);
+        timeBeforeLeaveFront = MSCFModel::passingTime(oldPos, laneLength, newPos, oldSpeed, newSpeed);
         const double timeAfterLeave = TS - timeBeforeLeaveFront;
         frontOnLane -= timeAfterLeave;
         // XXX: Do we really need this? Why would this "reduce rounding errors"? (Leo) Refs. #2579
@@ -159,17 +178,19 @@ MSMeanData::MeanDataValues::notifyMove(SUMOVehicle& veh, double oldPos, double n
     assert(timeOnLane <= TS);
 
     if (timeOnLane < 0) {
-        WRITE_ERROR("Negative vehicle step fraction for '" + veh.getID() + "' on lane '" + getLane()->getID() + "'.");
-        return veh.hasArrived();
+        WRITE_ERROR("Negative vehicle step fraction for '" + veh.getID() + "' on lane '" + lane->getID() + "'.");
+        into.keep = veh.hasArrived();
+        return false;
     }
     if (timeOnLane == 0) {
-        return veh.hasArrived();
+        into.keep = veh.hasArrived();
+        return false;
     }
 
 #ifdef DEBUG_NOTIFY_MOVE
     std::stringstream ss;
     ss << "\n"
-       << "lane length: " << myLaneLength
+       << "lane length: " << laneLength
        << "\noldPos: " << oldPos
        << "\nnewPos: " << newPos
        << "\noldPosBack: " << oldBackPos
@@ -192,12 +213,12 @@ MSMeanData::MeanDataValues::notifyMove(SUMOVehicle& veh, double oldPos, double n
     // compute average vehicle length on lane in last step
     double vehLength = veh.getVehicleType().getLength();
     // occupied lane length at timeBeforeEnter (resp. stepStart if already on lane)
-    double lengthOnLaneAtStepStart = MAX2(0., MIN4(myLaneLength, vehLength, vehLength - (oldPos - myLaneLength), oldPos));
+    double lengthOnLaneAtStepStart = MAX2(0., MIN4(laneLength, vehLength, vehLength - (oldPos - laneLength), oldPos));
     // occupied lane length at timeBeforeLeave (resp. stepEnd if still on lane)
-    double lengthOnLaneAtStepEnd = MAX2(0., MIN4(myLaneLength, vehLength, vehLength - (newPos - myLaneLength), newPos));
+    double lengthOnLaneAtStepEnd = MAX2(0., MIN4(laneLength, vehLength, vehLength - (newPos - laneLength), newPos));
     double integratedLengthOnLane = 0.;
     if (timeBeforeEnterBack < timeBeforeLeaveFront) {
-        // => timeBeforeLeaveFront>0, myLaneLength>vehLength
+        // => timeBeforeLeaveFront>0, laneLength>vehLength
         // vehicle length on detector at timeBeforeEnterBack
         double lengthOnLaneAtBackEnter = MIN2(veh.getVehicleType().getLength(), newPos);
         // linear quadrature of occupancy between timeBeforeEnter and timeBeforeEnterBack
@@ -208,7 +229,7 @@ MSMeanData::MeanDataValues::notifyMove(SUMOVehicle& veh, double oldPos, double n
         // and until vehicle leaves/stepEnd
         integratedLengthOnLane += (timeBeforeLeave - timeBeforeLeaveFront) * (vehLength + lengthOnLaneAtStepEnd) * 0.5;
     } else if (timeBeforeEnterBack >= timeBeforeLeaveFront) {
-        // => myLaneLength <= vehLength or (timeBeforeLeaveFront == timeBeforeEnterBack == 0)
+        // => laneLength <= vehLength or (timeBeforeLeaveFront == timeBeforeEnterBack == 0)
         // vehicle length on detector at timeBeforeLeaveFront
         double lengthOnLaneAtLeaveFront;
         if (timeBeforeLeaveFront == timeBeforeEnter) {
@@ -218,7 +239,7 @@ MSMeanData::MeanDataValues::notifyMove(SUMOVehicle& veh, double oldPos, double n
             // for the case that front doesn't leave in this step
             lengthOnLaneAtLeaveFront = lengthOnLaneAtStepEnd;
         } else {
-            lengthOnLaneAtLeaveFront = myLaneLength;
+            lengthOnLaneAtLeaveFront = laneLength;
         }
 #ifdef DEBUG_NOTIFY_MOVE
         std::cout << "lengthOnLaneAtLeaveFront=" << lengthOnLaneAtLeaveFront << std::endl;
@@ -233,25 +254,32 @@ MSMeanData::MeanDataValues::notifyMove(SUMOVehicle& veh, double oldPos, double n
 
     double meanLengthOnLane = integratedLengthOnLane / TS;
 #ifdef DEBUG_NOTIFY_MOVE
-    std::cout << "Calculated mean length on lane '" << myLane->getID() << "' in last step as " << meanLengthOnLane
+    std::cout << "Calculated mean length on lane '" << lane->getID() << "' in last step as " << meanLengthOnLane
               << "\nlengthOnLaneAtStepStart=" << lengthOnLaneAtStepStart << ", lengthOnLaneAtStepEnd=" << lengthOnLaneAtStepEnd << ", integratedLengthOnLane=" << integratedLengthOnLane
               << std::endl;
 #endif
 
 //    // XXX: use this, when #2556 is fixed! Refs. #2575
-//    const double travelledDistanceFrontOnLane = MAX2(0., MIN2(newPos, myLaneLength) - MAX2(oldPos, 0.));
-//    const double travelledDistanceVehicleOnLane = MIN2(newPos, myLaneLength) - MAX2(oldPos, 0.) + MIN2(MAX2(0., newPos - myLaneLength), veh.getVehicleType().getLength());
+//    const double travelledDistanceFrontOnLane = MAX2(0., MIN2(newPos, laneLength) - MAX2(oldPos, 0.));
+//    const double travelledDistanceVehicleOnLane = MIN2(newPos, laneLength) - MAX2(oldPos, 0.) + MIN2(MAX2(0., newPos - laneLength), veh.getVehicleType().getLength());
 //    // XXX: #2556 fixed for ballistic update
     const double travelledDistanceFrontOnLane = MSGlobals::gSemiImplicitEulerUpdate ? frontOnLane * newSpeed
-            : MAX2(0., MIN2(newPos, myLaneLength) - MAX2(oldPos, 0.));
+            : MAX2(0., MIN2(newPos, laneLength) - MAX2(oldPos, 0.));
     const double travelledDistanceVehicleOnLane = MSGlobals::gSemiImplicitEulerUpdate ? timeOnLane * newSpeed
-            : MIN2(newPos, myLaneLength) - MAX2(oldPos, 0.) + MIN2(MAX2(0., newPos - myLaneLength), veh.getVehicleType().getLength());
+            : MIN2(newPos, laneLength) - MAX2(oldPos, 0.) + MIN2(MAX2(0., newPos - laneLength), veh.getVehicleType().getLength());
 //    // XXX: no fix
 //    const double travelledDistanceFrontOnLane = frontOnLane*newSpeed;
 //    const double travelledDistanceVehicleOnLane = timeOnLane*newSpeed;
 
-    notifyMoveInternal(veh, frontOnLane, timeOnLane, (enterSpeed + leaveSpeedFront) / 2., (enterSpeed + leaveSpeed) / 2., travelledDistanceFrontOnLane, travelledDistanceVehicleOnLane, meanLengthOnLane);
-    return ret;
+    into.frontOnLane = frontOnLane;
+    into.timeOnLane = timeOnLane;
+    into.meanSpeedFrontOnLane = (enterSpeed + leaveSpeedFront) / 2.;
+    into.meanSpeedVehicleOnLane = (enterSpeed + leaveSpeed) / 2.;
+    into.travelledDistanceFrontOnLane = travelledDistanceFrontOnLane;
+    into.travelledDistanceVehicleOnLane = travelledDistanceVehicleOnLane;
+    into.meanLengthOnLane = meanLengthOnLane;
+    into.keep = ret;
+    return true;
 }
 
 
@@ -403,9 +431,82 @@ MSMeanData::MeanDataValueTracker::getSamples() const {
 }
 
 
+// ---------------------------------------------------------------------------
+// MSMeanData::MeanDataAggregator - methods
+// ---------------------------------------------------------------------------
+MSMeanData::MeanDataAggregator::MeanDataAggregator(MSLane* const lane, const SUMOTime created) :
+    MSMoveReminder("meandata_" + lane->getID(), lane, true),
+    myLaneLength(lane->getLength()),
+    myCreationTime(created) {}
+
+
+MSMeanData::MeanDataAggregator::~MeanDataAggregator() {}
+
+
+void
+MSMeanData::MeanDataAggregator::addValues(MeanDataValues* values) {
+    myValues.push_back(values);
+}
+
+
+bool
+MSMeanData::MeanDataAggregator::removeValues(const MSMeanData* const parent) {
+    for (std::vector<MeanDataValues*>::iterator i = myValues.begin(); i != myValues.end();) {
+        if ((*i)->getParent() == parent) {
+            i = myValues.erase(i);
+        } else {
+            ++i;
+        }
+    }
+    return !myValues.empty();
+}
+
+
+bool
+MSMeanData::MeanDataAggregator::notifyEnter(SUMOVehicle& veh, MSMoveReminder::Notification reason, const MSLane* enteredLane) {
+    bool result = false;
+    for (std::vector<MeanDataValues*>::const_iterator i = myValues.begin(); i != myValues.end(); ++i) {
+        if ((*i)->notifyEnter(veh, reason, enteredLane)) {
+            result = true;
+        }
+    }
+    return result;
+}
+
+
+bool
+MSMeanData::MeanDataAggregator::notifyMove(SUMOVehicle& veh, double oldPos, double newPos, double newSpeed) {
+    MeanDataValues::MoveOnLane move;
+    if (MeanDataValues::computeMoveOnLane(veh, myLane, myLaneLength, oldPos, newPos, newSpeed, move)) {
+        for (std::vector<MeanDataValues*>::const_iterator i = myValues.begin(); i != myValues.end(); ++i) {
+            if ((*i)->vehicleApplies(veh)) {
+                (*i)->notifyMoveInternal(veh, move.frontOnLane, move.timeOnLane, move.meanSpeedFrontOnLane, move.meanSpeedVehicleOnLane,
+                                         move.travelledDistanceFrontOnLane, move.travelledDistanceVehicleOnLane, move.meanLengthOnLane);
+            }
+        }
+    }
+    return move.keep;
+}
+
+
+bool
+MSMeanData::MeanDataAggregator::notifyLeave(SUMOVehicle& veh, double lastPos, MSMoveReminder::Notification reason, const MSLane* enteredLane) {
+    bool result = false;
+    for (std::vector<MeanDataValues*>::const_iterator i = myValues.begin(); i != myValues.end(); ++i) {
+        if ((*i)->vehicleApplies(veh) && (*i)->notifyLeave(veh, lastPos, reason, enteredLane)) {
+            result = true;
+        }
+    }
+    return result;
+}
+
+
 // ---------------------------------------------------------------------------
 // MSMeanData - methods
 // ---------------------------------------------------------------------------
+std::vector<MSMeanData::MeanDataAggregator*> MSMeanData::myLaneAggregators;
+
+
 MSMeanData::MSMeanData(const std::string& id,
                        const SUMOTime dumpBegin, const SUMOTime dumpEnd,
                        const bool useLanes, const bool withEmpty,
@@ -464,7 +565,9 @@ MSMeanData::init() {
                         myMeasures.back().push_back(new MeanDataValueTracker(*lane, (*lane)->getLength(), this));
                     }
                 } else {
-                    myMeasures.back().push_back(createValues(*lane, (*lane)->getLength(), true));
+                    MeanDataValues* data = createValues(*lane, (*lane)->getLength(), false);
+                    getAggregator(*lane)->addValues(data);
+                    myMeasures.back().push_back(data);
                 }
             }
         }
@@ -473,6 +576,15 @@ MSMeanData::init() {
 
 
 MSMeanData::~MSMeanData() {
+    for (std::vector<MeanDataAggregator*>::const_iterator i = myAggregators.begin(); i != myAggregators.end(); ++i) {
+        if (!(*i)->removeValues(this)) {
+            const int index = (*i)->getLane()->getNumericalID();
+            if (myLaneAggregators[index] == *i) {
+                myLaneAggregators[index] = 0;
+            }
+            delete *i;
+        }
+    }
     for (std::vector<std::vector<MeanDataValues*> >::const_iterator i = myMeasures.begin(); i != myMeasures.end(); ++i) {
         for (std::vector<MeanDataValues*>::const_iterator j = (*i).begin(); j != (*i).end(); ++j) {
             delete *j;
@@ -481,6 +593,22 @@ MSMeanData::~MSMeanData() {
 }
 
 
+MSMeanData::MeanDataAggregator*
+MSMeanData::getAggregator(MSLane* const lane) {
+    const int index = lane->getNumericalID();
+    if ((int)myLaneAggregators.size() <= index) {
+        myLaneAggregators.resize(index + 1, 0);
+    }
+    MeanDataAggregator*& agg = myLaneAggregators[index];
+    const SUMOTime now = MSNet::getInstance()->getCurrentTimeStep();
+    if (agg == 0 || agg->getCreationTime() != now) {
+        agg = new MeanDataAggregator(lane, now);
+    }
+    myAggregators.push_back(agg);
+    return agg;
+}
+
+
 void
 MSMeanData::resetOnly(SUMOTime stopTime) {
     UNUSED_PARAMETER(stopTime);
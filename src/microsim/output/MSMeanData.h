@@ -118,6 +118,14 @@ public:
                         double newPos, double newSpeed);
 
 
+        /** @brief Checks whether the given vehicle is measured by this collector
+         *
+         * @param[in] veh The vehicle to check
+         * @return whether the vehicle's type is of interest for the parent
+         */
+        bool vehicleApplies(const SUMOVehicle& veh) const;
+
+
         /** @brief Called if the vehicle leaves the reminder's lane
          *
          * @param veh The leaving vehicle.
@@ -164,6 +172,46 @@ public:
             return travelledDistance;
         }
 
+        /// @brief Returns the mean data definition the values belong to
+        const MSMeanData* getParent() const {
+            return myParent;
+        }
+
+        /// @brief The kinematic values of a single vehicle move with respect to a lane
+        struct MoveOnLane {
+            /// @brief time the front of the vehicle spent on the lane
+            double frontOnLane;
+            /// @brief time some part of the vehicle spent on the lane
+            double timeOnLane;
+            /// @brief average speed while the front was on the lane
+            double meanSpeedFrontOnLane;
+            /// @brief average speed while some part of the vehicle was on the lane
+            double meanSpeedVehicleOnLane;
+            /// @brief distance travelled while the front was on the lane
+            double travelledDistanceFrontOnLane;
+            /// @brief distance travelled while some part of the vehicle was on the lane
+            double travelledDistanceVehicleOnLane;
+            /// @brief the average length of the vehicle's part on the lane
+            double meanLengthOnLane;
+            /// @brief whether the vehicle still needs to be notified about this lane
+            bool keep;
+        };
+
+        /** @brief Computes the time and distance a vehicle spent on a lane during the last step
+         *
+         * @param[in] veh The moving vehicle
+         * @param[in] lane The lane to compute the values for (only used for error messages)
+         * @param[in] laneLength The length of the lane
+         * @param[in] oldPos Position before move.
+         * @param[in] newPos Position after move with newSpeed.
+         * @param[in] newSpeed Moving speed.
+         * @param[out] into The computed values
+         * @return whether the vehicle spent any time on the lane (and the values should be collected)
+         */
+        static bool computeMoveOnLane(SUMOVehicle& veh, const MSLane* const lane, const double laneLength,
+                                      const double oldPos, const double newPos, const double newSpeed,
+                                      MoveOnLane& into);
+
     protected:
         /// @brief The meandata parent
         const MSMeanData* const myParent;
@@ -291,6 +339,72 @@ public:
     };
 
 
+    /**
+     * @class MeanDataAggregator
+     * @brief A single move reminder per lane serving the values of all (non-tracking) mean data definitions
+     *
+     * Instead of adding one reminder per edgeData/laneData definition to each lane
+     *  (which each vehicle has to notify in every step), the values are collected here.
+     *  The kinematic values of a move are computed once per vehicle and step and
+     *  handed to all registered values.
+     * Only values of definitions which start at the same time share an aggregator,
+     *  so that vehicles already on the lane are not counted by collectors added later.
+     */
+    class MeanDataAggregator : public MSMoveReminder {
+    public:
+        /** @brief Constructor
+         *
+         * @param[in] lane The lane to collect data on
+         * @param[in] created The time step at which the aggregator was built
+         */
+        MeanDataAggregator(MSLane* const lane, const SUMOTime created);
+
+        /// @brief Destructor
+        ~MeanDataAggregator();
+
+        /// @brief Adds the values which shall be informed about vehicle movements
+        void addValues(MeanDataValues* values);
+
+        /** @brief Removes all values belonging to the given parent
+         *
+         * @param[in] parent The mean data definition which is deleted
+         * @return whether other values are still registered
+         */
+        bool removeValues(const MSMeanData* const parent);
+
+        /// @brief Returns the time step at which the aggregator was built
+        SUMOTime getCreationTime() const {
+            return myCreationTime;
+        }
+
+        /// @name Methods inherited from MSMoveReminder
+        /// @{
+        bool notifyEnter(SUMOVehicle& veh, MSMoveReminder::Notification reason, const MSLane* enteredLane = 0);
+
+        bool notifyMove(SUMOVehicle& veh, double oldPos, double newPos, double newSpeed);
+
+        bool notifyLeave(SUMOVehicle& veh, double lastPos, MSMoveReminder::Notification reason, const MSLane* enteredLane = 0);
+        /// @}
+
+    private:
+        /// @brief The length of the lane
+        const double myLaneLength;
+
+        /// @brief The time step at which the aggregator was built
+        const SUMOTime myCreationTime;
+
+        /// @brief The values to inform
+        std::vector<MeanDataValues*> myValues;
+
+    private:
+        /// @brief Invalidated copy constructor.
+        MeanDataAggregator(const MeanDataAggregator&);
+
+        /// @brief Invalidated assignment operator.
+        MeanDataAggregator& operator=(const MeanDataAggregator&);
+    };
+
+
 public:
     /** @brief Constructor
      *
@@ -378,6 +492,14 @@ protected:
      */
     void resetOnly(SUMOTime stopTime);
 
+    /** @brief Returns the aggregator to add new values for the given lane to
+     *
+     * Builds a new aggregator if there is none for the lane or the existing one
+     *  was built in an earlier time step.
+     * @param[in] lane The lane to retrieve the aggregator for
+     */
+    MeanDataAggregator* getAggregator(MSLane* const lane);
+
     /** @brief Return the relevant edge id
      *
      * @param[in] edge The edge to retrieve the id for
@@ -456,6 +578,12 @@ private:
     /// @brief The intervals for which output still has to be generated (only in the tracking case)
     std::list< std::pair<SUMOTime, SUMOTime> > myPendingIntervals;
 
+    /// @brief The aggregators the values of this definition were added to
+    std::vector<MeanDataAggregator*> myAggregators;
+
+    /// @brief The most recently built aggregator for each lane (indexed by the lane's numerical id)
+    static std::vector<MeanDataAggregator*> myLaneAggregators;
+
 private:
     /// @brief Invalidated copy constructor.
     MSMeanData(const MSMeanData&);
@@ -76,10 +76,8 @@ void
 MSMeanData_Emissions::MSLaneMeanDataValues::notifyMoveInternal(const SUMOVehicle& veh, const double /* frontOnLane */, const double timeOnLane, const double /*meanSpeedFrontOnLane*/, const double meanSpeedVehicleOnLane, const double /*travelledDistanceFrontOnLane*/, const double travelledDistanceVehicleOnLane, const double /* meanLengthOnLane */) {
     sampleSeconds += timeOnLane;
     travelledDistance += travelledDistanceVehicleOnLane;
-    const double a = veh.getAcceleration();
-    myEmissions.addScaled(PollutantsInterface::computeAll(veh.getVehicleType().getEmissionClass(),
-                          // XXX: recheck, which value to use here for the speed. (Leo) Refs. #2579
-                          meanSpeedVehicleOnLane, a, veh.getSlope()), timeOnLane);
+    // XXX: recheck, which value to use here for the speed. (Leo) Refs. #2579
+    myEmissions.addScaled(veh.getEmissions(meanSpeedVehicleOnLane), timeOnLane);
 }
 
 
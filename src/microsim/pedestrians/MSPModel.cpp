@@ -33,6 +33,7 @@
 #include <microsim/MSLane.h>
 #include "MSPModel_Striping.h"
 #include "MSPModel_NonInteracting.h"
+#include "MSPModel_SocialForce.h"
 #include "MSPModel.h"
 #ifdef BUILD_GRPC
 #include "MSPModel_Remote.h"
@@ -69,6 +70,8 @@ MSPModel::getModel() {
             myModel = new MSPModel_Striping(oc, net);
         } else if (model == "nonInteracting") {
             myModel = new MSPModel_NonInteracting(oc, net);
+        } else if (model == "socialForce") {
+            myModel = new MSPModel_SocialForce(oc, net);
 #ifdef BUILD_GRPC
         } else if (model == "remote") {
             myModel = new MSPModel_Remote(oc, net);
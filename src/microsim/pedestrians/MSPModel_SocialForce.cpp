@@ -0,0 +1,640 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    MSPModel_SocialForce.cpp
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// A continuous space pedestrian model based on social forces
+/****************************************************************************/
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cmath>
+#include <algorithm>
+#include <utils/common/RandHelper.h>
+#include <utils/geom/GeomHelper.h>
+#include <utils/options/OptionsCont.h>
+#include <utils/vehicle/IntermodalEdge.h>
+#include <microsim/MSNet.h>
+#include <microsim/MSEdge.h>
+#include <microsim/MSGlobals.h>
+#include <microsim/MSLane.h>
+#include <microsim/MSLink.h>
+#include <microsim/MSLinkCont.h>
+#include <microsim/MSJunction.h>
+#include <microsim/MSEventControl.h>
+#include <microsim/MSVehicle.h>
+#include <microsim/MSVehicleType.h>
+#include "MSPModel_SocialForce.h"
+
+
+// ===========================================================================
+// named (internal) constants
+// ===========================================================================
+
+
+// ===========================================================================
+// static members
+// ===========================================================================
+MSPModel_SocialForce::Pedestrians MSPModel_SocialForce::noPedestrians;
+
+// model parameters (static to simplify access from class PState
+double MSPModel_SocialForce::relaxationTime;
+double MSPModel_SocialForce::repulsionStrength;
+double MSPModel_SocialForce::repulsionRange;
+const double MSPModel_SocialForce::ANISOTROPY(0.3);
+const double MSPModel_SocialForce::INTERACTION_RANGE(2.0); // meters
+const double MSPModel_SocialForce::BORDER_STRENGTH(5.0); // m/s^2
+const double MSPModel_SocialForce::KEEP_RIGHT_STRENGTH(3.0); // m/s^2
+const double MSPModel_SocialForce::MAX_SPEED_FACTOR(1.3);
+const double MSPModel_SocialForce::WAITING_SPEED(0.1); // m/s
+
+
+// ===========================================================================
+// MSPModel_SocialForce method definitions
+// ===========================================================================
+
+MSPModel_SocialForce::MSPModel_SocialForce(const OptionsCont& oc, MSNet* net) :
+    myNumActivePedestrians(0) {
+    myCommand = new MovePedestrians(this);
+    net->getBeginOfTimestepEvents()->addEvent(myCommand, net->getCurrentTimeStep() + DELTA_T);
+    // configurable parameters
+    relaxationTime = oc.getFloat("pedestrian.socialforce.relaxation-time");
+    repulsionStrength = oc.getFloat("pedestrian.socialforce.repulsion-strength");
+    repulsionRange = oc.getFloat("pedestrian.socialforce.repulsion-range");
+    if (relaxationTime <= 0 || repulsionRange <= 0) {
+        throw ProcessError("The relaxation time and repulsion range of the social force model must be positive.");
+    }
+#ifdef HAVE_FOX
+    const int numThreads = oc.getInt("pedestrian.socialforce.threads");
+    while (numThreads > 1 && myThreadPool.size() < numThreads) {
+        new FXWorkerThread(myThreadPool);
+    }
+#endif
+}
+
+
+MSPModel_SocialForce::~MSPModel_SocialForce() {
+}
+
+
+PedestrianState*
+MSPModel_SocialForce::add(MSPerson* person, MSPerson::MSPersonStage_Walking* stage, SUMOTime) {
+    assert(person->getCurrentStageType() == MSTransportable::MOVING_WITHOUT_VEHICLE);
+    const MSLane* lane = getLane(person, person->getEdge());
+    if (lane == 0) {
+        return 0;
+    }
+    PState* ped = new PState(person, stage, lane);
+    myActiveLanes[lane].peds.push_back(ped);
+    myNumActivePedestrians++;
+    return ped;
+}
+
+
+void
+MSPModel_SocialForce::remove(PedestrianState* state) {
+    PState* const ped = dynamic_cast<PState*>(state);
+    ActiveLanes::iterator it = myActiveLanes.find(ped->myLane);
+    if (it != myActiveLanes.end()) {
+        Pedestrians& pedestrians = it->second.peds;
+        Pedestrians::iterator it_ped = std::find(pedestrians.begin(), pedestrians.end(), ped);
+        if (it_ped != pedestrians.end()) {
+            pedestrians.erase(it_ped);
+            myNumActivePedestrians--;
+        }
+    }
+}
+
+
+bool
+MSPModel_SocialForce::blockedAtDist(const MSLane* lane, double vehSide, double vehWidth,
+                                    double oncomingGap, std::vector<const MSPerson*>* collectBlockers) {
+    const Pedestrians& pedestrians = getPedestrians(lane);
+    for (Pedestrians::const_iterator it_ped = pedestrians.begin(); it_ped != pedestrians.end(); ++it_ped) {
+        const PState& ped = **it_ped;
+        const double leaderFrontDist = (ped.myDir == FORWARD ? vehSide - ped.myX : ped.myX - vehSide);
+        const double leaderBackDist = leaderFrontDist + ped.myPerson->getVehicleType().getLength();
+        if (leaderBackDist >= -vehWidth
+                && (leaderFrontDist < 0
+                    // give right of way to (close) approaching pedestrians unless they are standing
+                    || (leaderFrontDist <= oncomingGap && ped.myWaitingTime < TIME2STEPS(2.0)))) {
+            if (collectBlockers == 0) {
+                return true;
+            } else {
+                collectBlockers->push_back(ped.myPerson);
+            }
+        }
+    }
+    if (collectBlockers == 0) {
+        return false;
+    } else {
+        return collectBlockers->size() > 0;
+    }
+}
+
+
+bool
+MSPModel_SocialForce::usingInternalLanes() {
+    return MSGlobals::gUsingInternalLanes && MSNet::getInstance()->hasInternalLinks();
+}
+
+
+bool
+MSPModel_SocialForce::hasPedestrians(const MSLane* lane) {
+    return getPedestrians(lane).size() > 0;
+}
+
+
+PersonDist
+MSPModel_SocialForce::nextBlocking(const MSLane* lane, double minPos, double minRight, double maxLeft, double stopTime) {
+    PersonDist result((const MSPerson*)0, -1);
+    double closest = std::numeric_limits<double>::max();
+    const Pedestrians& pedestrians = getPedestrians(lane);
+    for (Pedestrians::const_iterator it_ped = pedestrians.begin(); it_ped != pedestrians.end(); ++it_ped) {
+        const PState& ped = **it_ped;
+        // account for distance covered by oncoming pedestrians
+        const double relX2 = ped.myX - (ped.myDir == FORWARD ? 0 : stopTime * ped.myPerson->getVehicleType().getMaxSpeed());
+        if (ped.myX > minPos && (result.first == 0 || closest > relX2)) {
+            const double center = 0.5 * lane->getWidth() - ped.myY;
+            const double halfWidth = ped.getRadius();
+            if (center + halfWidth > minRight && center - halfWidth < maxLeft) {
+                closest = relX2;
+                result.first = ped.myPerson;
+                result.second = relX2 - minPos - (ped.myDir == FORWARD ? ped.myPerson->getVehicleType().getLength() : 0);
+            }
+        }
+    }
+    return result;
+}
+
+
+void
+MSPModel_SocialForce::cleanupHelper() {
+#ifdef HAVE_FOX
+    myThreadPool.clear();
+#endif
+    myActiveLanes.clear();
+    myNumActivePedestrians = 0;
+}
+
+
+const MSLane*
+MSPModel_SocialForce::getLane(const MSPerson* person, const MSEdge* edge) {
+    const MSLane* lane = getSidewalk<MSEdge, MSLane>(edge);
+    if (lane == 0) {
+        std::string error = "Person '" + person->getID() + "' could not find sidewalk on edge '" + edge->getID() + "', time="
+                            + time2string(MSNet::getInstance()->getCurrentTimeStep()) + ".";
+        if (OptionsCont::getOptions().getBool("ignore-route-errors")) {
+            WRITE_WARNING(error);
+            return 0;
+        } else {
+            throw ProcessError(error);
+        }
+    }
+    return lane;
+}
+
+
+const MSPModel_SocialForce::Pedestrians&
+MSPModel_SocialForce::getPedestrians(const MSLane* lane) {
+    ActiveLanes::const_iterator it = myActiveLanes.find(lane);
+    if (it != myActiveLanes.end()) {
+        return it->second.peds;
+    }
+    return noPedestrians;
+}
+
+
+int
+MSPModel_SocialForce::cellIndex(double x, int numCells) {
+    return MAX2(0, MIN2(numCells - 1, (int)floor(x / INTERACTION_RANGE)));
+}
+
+
+void
+MSPModel_SocialForce::prepareLane(const MSLane* lane, LaneState& state) {
+    Pedestrians& peds = state.peds;
+    std::sort(peds.begin(), peds.end(), by_pos_sorter());
+    const int n = (int)peds.size();
+    state.x.resize(n);
+    state.y.resize(n);
+    state.vx.resize(n);
+    state.vy.resize(n);
+    state.radius.resize(n);
+    for (int i = 0; i < n; ++i) {
+        const PState& p = *peds[i];
+        state.x[i] = p.myX;
+        state.y[i] = p.myY;
+        state.vx[i] = p.myVX;
+        state.vy[i] = p.myVY;
+        state.radius[i] = p.getRadius();
+    }
+    // the pedestrians are sorted by position, so each cell is a contiguous index range
+    const int numCells = MAX2(1, (int)ceil(lane->getLength() / INTERACTION_RANGE));
+    state.cellStart.assign(numCells + 1, n);
+    for (int i = n - 1; i >= 0; --i) {
+        state.cellStart[cellIndex(state.x[i], numCells)] = i;
+    }
+    for (int c = numCells - 1; c >= 0; --c) {
+        state.cellStart[c] = MIN2(state.cellStart[c], state.cellStart[c + 1]);
+    }
+}
+
+
+void
+MSPModel_SocialForce::computeForces(const MSLane* lane, LaneState& state) {
+    prepareLane(lane, state);
+    const int n = (int)state.peds.size();
+    const int numCells = (int)state.cellStart.size() - 1;
+    const double halfWidth = 0.5 * lane->getWidth();
+    const double* const x = &state.x[0];
+    const double* const y = &state.y[0];
+    const double* const radius = &state.radius[0];
+    for (int i = 0; i < n; ++i) {
+        PState& p = *state.peds[i];
+        const double dir = p.myDir;
+        const double desiredSpeed = p.myStage->getMaxSpeed(p.myPerson);
+        // the forces besides the adaption to the desired velocity (which is integrated implicitly below)
+        double fx = 0;
+        double fy = 0;
+        // repulsion by the pedestrians in the neighboring cells
+        const int cell = cellIndex(x[i], numCells);
+        const int jEnd = state.cellStart[MIN2(numCells, cell + 2)];
+        for (int j = state.cellStart[MAX2(0, cell - 1)]; j < jEnd; ++j) {
+            const double dx = x[i] - x[j];
+            const double dy = y[i] - y[j];
+            const double dist = sqrt(dx * dx + dy * dy);
+            if (j == i || dist >= INTERACTION_RANGE) {
+                continue;
+            }
+            double nx = 0;
+            // resolve exact overlaps deterministically by the sort order
+            double ny = i < j ? -1 : 1;
+            if (dist > NUMERICAL_EPS) {
+                nx = dx / dist;
+                ny = dy / dist;
+            }
+            // pedestrians ahead (cosPhi = 1) matter more than those behind (cosPhi = -1)
+            const double cosPhi = -dir * nx;
+            const double weight = ANISOTROPY + (1 - ANISOTROPY) * 0.5 * (1 + cosPhi);
+            const double strength = weight * repulsionStrength * exp((radius[i] + radius[j] - dist) / repulsionRange);
+            fx += strength * nx;
+            fy += strength * ny;
+        }
+        // keep right so that oncoming pedestrians can pass (positive y is right of the lane direction)
+        fy += dir * KEEP_RIGHT_STRENGTH;
+        // repulsion by the lane borders
+        const double leftBorder = BORDER_STRENGTH * exp((radius[i] - (halfWidth - y[i])) / repulsionRange);
+        const double rightBorder = BORDER_STRENGTH * exp((radius[i] - (halfWidth + y[i])) / repulsionRange);
+        fy += rightBorder - leftBorder;
+        // semi-implicit integration of the relaxation towards the desired velocity and of the
+        // border repulsion (with its stiffness), explicit steps overshoot with the usual step lengths
+        const double relaxation = TS / relaxationTime;
+        const double borderStiffness = (leftBorder + rightBorder) / repulsionRange;
+        double vx = (state.vx[i] + relaxation * dir * desiredSpeed + fx * TS) / (1 + relaxation);
+        const double vy = (state.vy[i] + fy * TS) / (1 + relaxation + borderStiffness * TS * TS);
+        // pedestrians do not get pushed backwards
+        if (vx * dir < 0) {
+            vx = 0;
+        }
+        const double speed = sqrt(vx * vx + vy * vy);
+        const double maxSpeed = desiredSpeed * MAX_SPEED_FACTOR;
+        const double scale = speed > maxSpeed ? maxSpeed / speed : 1.;
+        p.myNextVX = vx * scale;
+        p.myNextVY = vy * scale;
+    }
+}
+
+
+void
+MSPModel_SocialForce::moveAll(SUMOTime currentTime) {
+    // compute the new velocities from the state of the last step
+#ifdef HAVE_FOX
+    if (myThreadPool.size() > 0) {
+        for (ActiveLanes::iterator it = myActiveLanes.begin(); it != myActiveLanes.end(); ++it) {
+            if (!it->second.peds.empty()) {
+                myThreadPool.add(new ForceTask(it->first, it->second));
+            }
+        }
+        myThreadPool.waitAll();
+    } else {
+#endif
+        for (ActiveLanes::iterator it = myActiveLanes.begin(); it != myActiveLanes.end(); ++it) {
+            if (!it->second.peds.empty()) {
+                computeForces(it->first, it->second);
+            }
+        }
+#ifdef HAVE_FOX
+    }
+#endif
+    // move all pedestrians and collect those which reached the end of their edge
+    Pedestrians toAdvance;
+    for (ActiveLanes::iterator it = myActiveLanes.begin(); it != myActiveLanes.end(); ++it) {
+        const double maxY = 0.5 * it->first->getWidth();
+        Pedestrians& pedestrians = it->second.peds;
+        for (Pedestrians::iterator it_ped = pedestrians.begin(); it_ped != pedestrians.end();) {
+            PState* const p = *it_ped;
+            p->myVX = p->myNextVX;
+            p->myVY = p->myNextVY;
+            p->myX += p->myVX * TS;
+            const double maxOffset = MAX2(0., maxY - p->getRadius());
+            const double y = p->myY + p->myVY * TS;
+            p->myY = MAX2(-maxOffset, MIN2(maxOffset, y));
+            if (p->myY != y) {
+                // stopped by the lane border
+                p->myVY = 0;
+            }
+            if (fabs(p->myVX) < WAITING_SPEED) {
+                p->myWaitingTime += DELTA_T;
+            } else {
+                p->myWaitingTime = 0;
+            }
+            if (p->distToEnd() <= 0) {
+                toAdvance.push_back(p);
+                it_ped = pedestrians.erase(it_ped);
+            } else {
+                ++it_ped;
+            }
+        }
+    }
+    // advancing may insert pedestrians (for consecutive walks) so it is done after the loop
+    for (Pedestrians::iterator it = toAdvance.begin(); it != toAdvance.end(); ++it) {
+        advance(*it, currentTime);
+    }
+}
+
+
+void
+MSPModel_SocialForce::advance(PState* ped, SUMOTime currentTime) {
+    MSPerson::MSPersonStage_Walking* const stage = ped->myStage;
+    if (stage->getNextRouteEdge() == 0) {
+        ped->myX = ped->myEndPos;
+        ped->myLane = 0;
+        myNumActivePedestrians--;
+        // the state may be deleted when the person proceeds to the next stage
+        stage->moveToNextEdge(ped->myPerson, currentTime);
+        return;
+    }
+    int nextDir = UNDEFINED_DIRECTION;
+    const MSLink* link = 0;
+    const MSLane* nextLane = 0;
+    if (ped->myWaitingCrossing != 0) {
+        // still waiting at the end of the same lane, the route across the junction did not change
+        nextLane = ped->myWaitingCrossing;
+        nextDir = ped->myWaitingCrossingDir;
+        link = ped->myWaitingCrossingLink;
+    } else if (usingInternalLanes()) {
+        nextLane = getNextLane(*ped, nextDir, link);
+    }
+    const MSLane* lane = nextLane;
+    if (nextLane != 0 && nextLane->getEdge().isCrossing()) {
+        const double speed = MAX2(fabs(ped->myVX), WAITING_SPEED);
+        const MSVehicleType& type = ped->myPerson->getVehicleType();
+        if (link != 0 && !link->opened(currentTime, speed, speed, type.getLength(), type.getImpatience(), speed, 0)) {
+            // wait in front of the crossing
+            ped->myX = ped->myEndPos;
+            ped->myVX = 0;
+            ped->myVY = 0;
+            ped->myWaitingCrossing = nextLane;
+            ped->myWaitingCrossingDir = nextDir;
+            ped->myWaitingCrossingLink = link;
+            myActiveLanes[ped->myLane].peds.push_back(ped);
+            return;
+        }
+        stage->moveToNextEdge(ped->myPerson, currentTime, &nextLane->getEdge());
+        ped->enterLane(nextLane, nextDir);
+    } else {
+        const MSEdge* const prev = stage->getEdge();
+        stage->moveToNextEdge(ped->myPerson, currentTime);
+        lane = getLane(ped->myPerson, stage->getEdge());
+        if (lane == 0) {
+            lane = stage->getEdge()->getLanes().front();
+        }
+        if (lane == nextLane && nextDir != UNDEFINED_DIRECTION) {
+            ped->enterLane(lane, nextDir);
+        } else {
+            ped->enterEdge(prev, lane);
+        }
+    }
+    myActiveLanes[lane].peds.push_back(ped);
+}
+
+
+const MSLane*
+MSPModel_SocialForce::getNextLane(const PState& ped, int& nextDir, const MSLink*& link) {
+    const MSLane* const current = ped.myLane;
+    const MSEdge* const nextRouteEdge = ped.myStage->getNextRouteEdge();
+    if (getSidewalk<MSEdge, MSLane>(nextRouteEdge) == 0) {
+        return 0;
+    }
+    // find the walking area at the end of the current lane
+    const MSLane* walkingArea = 0;
+    if (current->getEdge().isCrossing()) {
+        walkingArea = ped.myDir == FORWARD ? current->getLinkCont()[0]->getLane() : current->getLogicalPredecessorLane();
+    } else if (&current->getEdge() != nextRouteEdge) {
+        MSLink* dummy = 0;
+        walkingArea = MSPModel_Striping::getNextWalkingArea(current, ped.myDir, dummy);
+    }
+    if (walkingArea == 0 || !walkingArea->getEdge().isWalkingArea()) {
+        return 0;
+    }
+    // route across the junction without going back to the current lane
+    const MSEdge* const walkingAreaEdge = &walkingArea->getEdge();
+    const MSJunction* const junction = walkingAreaEdge->getToJunction();
+    const double arrivalPos = (nextRouteEdge == ped.myStage->getRoute().back()
+                               ? ped.myStage->getArrivalPos()
+                               : (nextRouteEdge->getFromJunction() == junction ? 0 : nextRouteEdge->getLength()));
+    MSEdgeVector prohibited;
+    prohibited.push_back(&current->getEdge());
+    ConstMSEdgeVector crossingRoute;
+    MSNet::getInstance()->getPedestrianRouter(prohibited).compute(walkingAreaEdge, nextRouteEdge, 0, arrivalPos, ped.myStage->getMaxSpeed(ped.myPerson), 0, junction, crossingRoute, true);
+    if (crossingRoute.size() < 2) {
+        WRITE_WARNING("Person '" + ped.myPerson->getID() + "' could not find route across junction '" + junction->getID() + "', time=" +
+                      time2string(MSNet::getInstance()->getCurrentTimeStep()) + ".");
+        return 0;
+    }
+    const MSLane* const nextLane = getSidewalk<MSEdge, MSLane>(crossingRoute[1]);
+    nextDir = MSPModel_Striping::connectedDirection(walkingArea, nextLane);
+    if (nextDir == FORWARD) {
+        link = MSLinkContHelper::getConnectingLink(*walkingArea, *nextLane);
+    } else if (nextDir == BACKWARD) {
+        link = MSLinkContHelper::getConnectingLink(*nextLane, *walkingArea);
+        if (link != 0 && nextLane->getEdge().isCrossing() && link->getTLLogic() == 0) {
+            // the link leaving an unsignalized crossing has no right of way information
+            link = MSLinkContHelper::getConnectingLink(*nextLane->getLogicalPredecessorLane(), *nextLane);
+        }
+    }
+    return nextLane;
+}
+
+
+// ===========================================================================
+// MSPModel_SocialForce::PState method definitions
+// ===========================================================================
+
+MSPModel_SocialForce::PState::PState(MSPerson* person, MSPerson::MSPersonStage_Walking* stage, const MSLane* lane) :
+    myPerson(person),
+    myStage(stage),
+    myLane(0),
+    myDir(FORWARD),
+    myX(0),
+    myY(0),
+    myVX(0),
+    myVY(0),
+    myNextVX(0),
+    myNextVY(0),
+    myEndPos(0),
+    myWaitingTime(0),
+    myWaitingCrossing(0),
+    myWaitingCrossingDir(UNDEFINED_DIRECTION),
+    myWaitingCrossingLink(0) {
+    enterEdge(0, lane);
+    // spread pedestrians laterally to avoid symmetric deadlocks
+    const double maxOffset = MAX2(0., 0.5 * lane->getWidth() - getRadius());
+    myY = RandHelper::rand(-maxOffset, maxOffset);
+}
+
+
+void
+MSPModel_SocialForce::PState::enterEdge(const MSEdge* prev, const MSLane* lane) {
+    myLane = lane;
+    myWaitingCrossing = 0;
+    const MSEdge* edge = &lane->getEdge();
+    const MSEdge* next = myStage->getNextRouteEdge();
+    const double speed = fabs(myVX);
+    int dir = UNDEFINED_DIRECTION;
+    double beginPos;
+    if (prev == 0) {
+        beginPos = myStage->getDepartPos();
+    } else {
+        // default to FORWARD if not connected
+        dir = (edge->getToJunction() == prev->getToJunction() || edge->getToJunction() == prev->getFromJunction()) ? BACKWARD : FORWARD;
+        beginPos = dir == FORWARD ? 0 : edge->getLength();
+    }
+    if (next == 0) {
+        myEndPos = myStage->getArrivalPos();
+    } else {
+        if (dir == UNDEFINED_DIRECTION) {
+            // default to FORWARD if not connected
+            dir = (edge->getFromJunction() == next->getFromJunction() || edge->getFromJunction() == next->getToJunction()) ? BACKWARD : FORWARD;
+        }
+        myEndPos = dir == FORWARD ? edge->getLength() : 0;
+    }
+    if (dir == UNDEFINED_DIRECTION) {
+        dir = myEndPos >= beginPos ? FORWARD : BACKWARD;
+    }
+    myDir = dir;
+    myX = beginPos;
+    myVX = myDir * speed;
+}
+
+
+void
+MSPModel_SocialForce::PState::enterLane(const MSLane* lane, int dir) {
+    myLane = lane;
+    myWaitingCrossing = 0;
+    myDir = dir == UNDEFINED_DIRECTION ? FORWARD : dir;
+    myX = myDir == FORWARD ? 0 : lane->getLength();
+    if (!lane->getEdge().isCrossing() && myStage->getNextRouteEdge() == 0) {
+        myEndPos = myStage->getArrivalPos();
+    } else {
+        myEndPos = myDir == FORWARD ? lane->getLength() : 0;
+    }
+    myVX = myDir * fabs(myVX);
+}
+
+
+double
+MSPModel_SocialForce::PState::getRadius() const {
+    return 0.5 * myPerson->getVehicleType().getWidth();
+}
+
+
+double
+MSPModel_SocialForce::PState::getEdgePos(const MSPerson::MSPersonStage_Walking&, SUMOTime) const {
+    return myX;
+}
+
+
+Position
+MSPModel_SocialForce::PState::getPosition(const MSPerson::MSPersonStage_Walking& stage, SUMOTime) const {
+    if (myLane == 0) {
+        // pedestrian has already finished
+        return Position::INVALID;
+    }
+    return stage.getLanePosition(myLane, myX, myY);
+}
+
+
+double
+MSPModel_SocialForce::PState::getAngle(const MSPerson::MSPersonStage_Walking&, SUMOTime) const {
+    if (myLane == 0) {
+        // pedestrian has already finished
+        return 0;
+    }
+    double angle = myLane->getShape().rotationAtOffset(myX) + (myDir == MSPModel::BACKWARD ? M_PI : 0);
+    if (angle > M_PI) {
+        angle -= 2 * M_PI;
+    }
+    return angle;
+}
+
+
+SUMOTime
+MSPModel_SocialForce::PState::getWaitingTime(const MSPerson::MSPersonStage_Walking&, SUMOTime) const {
+    return myWaitingTime;
+}
+
+
+double
+MSPModel_SocialForce::PState::getSpeed(const MSPerson::MSPersonStage_Walking&) const {
+    return sqrt(myVX * myVX + myVY * myVY);
+}
+
+
+const MSEdge*
+MSPModel_SocialForce::PState::getNextEdge(const MSPerson::MSPersonStage_Walking& stage) const {
+    return stage.getNextRouteEdge();
+}
+
+
+// ===========================================================================
+// MSPModel_SocialForce::MovePedestrians method definitions
+// ===========================================================================
+
+SUMOTime
+MSPModel_SocialForce::MovePedestrians::execute(SUMOTime currentTime) {
+    myModel->moveAll(currentTime);
+    return DELTA_T;
+}
+
+
+#ifdef HAVE_FOX
+// ===========================================================================
+// MSPModel_SocialForce::ForceTask method definitions
+// ===========================================================================
+
+void
+MSPModel_SocialForce::ForceTask::run(FXWorkerThread* /* context */) {
+    computeForces(myLane, myState);
+}
+#endif
+
+
+/****************************************************************************/
@@ -0,0 +1,327 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    MSPModel_SocialForce.h
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// A continuous space pedestrian model based on social forces
+/****************************************************************************/
+#ifndef MSPModel_SocialForce_h
+#define MSPModel_SocialForce_h
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <limits>
+#include <vector>
+#include <map>
+#include <utils/common/SUMOTime.h>
+#include <utils/common/Command.h>
+#include <utils/options/OptionsCont.h>
+#include <microsim/MSLane.h>
+#include "MSPerson.h"
+#include "MSPModel.h"
+#include "MSPModel_Striping.h"
+
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
+
+
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class MSNet;
+class MSLink;
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class MSPModel_SocialForce
+ * @brief A continuous space pedestrian model based on social forces
+ *
+ * Pedestrians move on the sidewalk of their current edge in continuous
+ *  lane coordinates (longitudinal and lateral offset). Each step they are
+ *  accelerated towards their desired speed and repelled exponentially by
+ *  the pedestrians around them and by the lane borders (Helbing / Molnar).
+ *
+ * Neighbors are found using a cell list per lane: pedestrians are sorted by
+ *  position and the lane is split into cells of the interaction range so
+ *  that all candidates of a pedestrian form one contiguous range of the
+ *  per lane state arrays.
+ *
+ * The forces for all pedestrians are computed from the state of the
+ *  previous step before any pedestrian moves, so the lanes can be processed
+ *  in parallel (see pedestrian.socialforce.threads) without changing results.
+ *
+ * If the network has walking areas, pedestrians walk over the crossings
+ *  on their way like on a sidewalk and wait in front of a crossing whose
+ *  link is closed. Walking areas themselves are passed immediately. At
+ *  junctions without walking areas pedestrians continue on the next edge
+ *  of their route immediately (like in the nonInteracting model).
+ */
+class MSPModel_SocialForce : public MSPModel {
+public:
+
+    /// @brief Constructor (it should not be necessary to construct more than one instance)
+    MSPModel_SocialForce(const OptionsCont& oc, MSNet* net);
+
+    ~MSPModel_SocialForce();
+
+    /// @brief register the given person as a pedestrian
+    PedestrianState* add(MSPerson* person, MSPerson::MSPersonStage_Walking* stage, SUMOTime now);
+
+    /// @brief remove the specified person from the pedestrian simulation
+    void remove(PedestrianState* state);
+
+    /** @brief whether a pedestrian is blocking the crossing of lane for the given vehicle bondaries
+     * @param[in] lane The crossing to check
+     * @param[in] vehSide The offset to the vehicle side near the start of the crossing
+     * @param[in] vehWidth The width of the vehicle
+     * @param[in] oncomingGap The distance which the vehicle wants to keep from oncoming pedestrians
+     * @param[in] collectBlockers The list of persons blocking the crossing
+     * @return Whether the vehicle must wait
+     */
+    bool blockedAtDist(const MSLane* lane, double vehSide, double vehWidth,
+                       double oncomingGap, std::vector<const MSPerson*>* collectBlockers);
+
+    /// @brief whether the given lane has pedestrians on it
+    bool hasPedestrians(const MSLane* lane);
+
+    /// @brief returns the next pedestrian beyond minPos that is laterally between minRight and maxLeft or 0
+    PersonDist nextBlocking(const MSLane* lane, double minPos, double minRight, double maxLeft, double stopTime = 0);
+
+    /// @brief whether movements on intersections are modelled
+    bool usingInternalLanes();
+
+    /// @brief remove state at simulation end
+    void cleanupHelper();
+
+    /// @brief model parameters
+    ///@{
+
+    // @brief the time in which a pedestrian adapts to the desired velocity
+    static double relaxationTime;
+
+    // @brief the strength of the repulsion between pedestrians (m/s^2)
+    static double repulsionStrength;
+
+    // @brief the range of the repulsion between pedestrians (m)
+    static double repulsionRange;
+
+    // @brief the weight of the repulsion from pedestrians behind (anisotropy)
+    static const double ANISOTROPY;
+
+    // @brief the distance beyond which pedestrians do not interact (m)
+    static const double INTERACTION_RANGE;
+
+    // @brief the strength of the repulsion from the lane borders (m/s^2)
+    static const double BORDER_STRENGTH;
+
+    // @brief the lateral acceleration towards the right side of the walking direction (m/s^2)
+    static const double KEEP_RIGHT_STRENGTH;
+
+    // @brief the factor by which the desired speed may be exceeded when pushed
+    static const double MAX_SPEED_FACTOR;
+
+    // @brief the speed below which a pedestrian counts as waiting
+    static const double WAITING_SPEED;
+
+    ///@}
+
+protected:
+    class PState;
+
+    typedef std::vector<PState*> Pedestrians;
+
+    /**
+     * @struct LaneState
+     * @brief The pedestrians on one lane together with the flat arrays used for the force computation
+     */
+    struct LaneState {
+        /// @brief the pedestrians sorted by longitudinal position
+        Pedestrians peds;
+        /// @brief longitudinal and lateral positions and velocities and the body radius (index as in peds)
+        std::vector<double> x, y, vx, vy, radius;
+        /// @brief index of the first pedestrian of each cell (one more entry than cells)
+        std::vector<int> cellStart;
+    };
+
+    typedef std::map<const MSLane*, LaneState, MSPModel_Striping::lane_by_numid_sorter> ActiveLanes;
+
+    /**
+     * @class PState
+     * @brief Container for pedestrian state and individual position update function
+     */
+    class PState : public PedestrianState {
+    public:
+        PState(MSPerson* person, MSPerson::MSPersonStage_Walking* stage, const MSLane* lane);
+        ~PState() {};
+
+        /// @brief abstract methods inherited from PedestrianState
+        /// @{
+        double getEdgePos(const MSPerson::MSPersonStage_Walking& stage, SUMOTime now) const;
+        Position getPosition(const MSPerson::MSPersonStage_Walking& stage, SUMOTime now) const;
+        double getAngle(const MSPerson::MSPersonStage_Walking& stage, SUMOTime now) const;
+        SUMOTime getWaitingTime(const MSPerson::MSPersonStage_Walking& stage, SUMOTime now) const;
+        double getSpeed(const MSPerson::MSPersonStage_Walking& stage) const;
+        const MSEdge* getNextEdge(const MSPerson::MSPersonStage_Walking& stage) const;
+        /// @}
+
+        /// @brief set direction, start and end position for the current edge (prev is 0 on the first edge)
+        void enterEdge(const MSEdge* prev, const MSLane* lane);
+
+        /// @brief set start and end position for the given lane which is entered from a junction in the given direction
+        void enterLane(const MSLane* lane, int dir);
+
+        /// @brief return the remaining distance to the end of the current edge (or the arrival position)
+        double distToEnd() const {
+            return myDir * (myEndPos - myX);
+        }
+
+        /// @brief return the body radius
+        double getRadius() const;
+
+        /// @brief the person
+        MSPerson* myPerson;
+        /// @brief the current walking stage
+        MSPerson::MSPersonStage_Walking* myStage;
+        /// @brief the current lane
+        const MSLane* myLane;
+        /// @brief the walking direction on the current lane
+        int myDir;
+        /// @brief the longitudinal position on the current lane
+        double myX;
+        /// @brief the lateral offset from the lane center
+        double myY;
+        /// @brief the longitudinal speed (positive along the lane direction)
+        double myVX;
+        /// @brief the lateral speed
+        double myVY;
+        /// @brief the velocity computed for the next step
+        double myNextVX, myNextVY;
+        /// @brief the position at which the current edge is left
+        double myEndPos;
+        /// @brief the consecutive time spent without moving
+        SUMOTime myWaitingTime;
+        /// @brief the closed crossing in front of which the pedestrian waits (0 if not waiting)
+        const MSLane* myWaitingCrossing;
+        /// @brief the walking direction on the crossing waited for
+        int myWaitingCrossingDir;
+        /// @brief the link which has to open before entering the crossing waited for
+        const MSLink* myWaitingCrossingLink;
+    };
+
+    class MovePedestrians : public Command {
+    public:
+        MovePedestrians(MSPModel_SocialForce* model) : myModel(model) {};
+        ~MovePedestrians() {};
+        SUMOTime execute(SUMOTime currentTime);
+    private:
+        MSPModel_SocialForce* const myModel;
+    private:
+        /// @brief Invalidated assignment operator.
+        MovePedestrians& operator=(const MovePedestrians&);
+    };
+
+    /// @brief sorts the persons by position on the lane (ascending, ties broken by id)
+    class by_pos_sorter {
+    public:
+        /// comparing operation
+        bool operator()(const PState* p1, const PState* p2) const {
+            if (p1->myX != p2->myX) {
+                return p1->myX < p2->myX;
+            }
+            return p1->myPerson->getID() < p2->myPerson->getID();
+        }
+    };
+
+#ifdef HAVE_FOX
+    /**
+     * @class ForceTask
+     * @brief Computes the forces for the pedestrians of one lane in a worker thread
+     */
+    class ForceTask : public FXWorkerThread::Task {
+    public:
+        ForceTask(const MSLane* lane, LaneState& state) : myLane(lane), myState(state) {}
+        void run(FXWorkerThread* context);
+    private:
+        const MSLane* const myLane;
+        LaneState& myState;
+    private:
+        /// @brief Invalidated assignment operator.
+        ForceTask& operator=(const ForceTask&);
+    };
+#endif
+
+    /// @brief perform one simulation step for all pedestrians
+    void moveAll(SUMOTime currentTime);
+
+    /// @brief sort the pedestrians of the lane and fill the flat state arrays and cells
+    static void prepareLane(const MSLane* lane, LaneState& state);
+
+    /// @brief compute the velocities for the next step of all pedestrians on the lane
+    static void computeForces(const MSLane* lane, LaneState& state);
+
+    /// @brief move the given pedestrian to the next crossing or edge of its route or let it arrive
+    void advance(PState* ped, SUMOTime currentTime);
+
+    /** @brief return the crossing or sidewalk which follows the current lane via the next walking area
+     * @param[in] ped The pedestrian at the end of its lane
+     * @param[out] nextDir The walking direction on the returned lane
+     * @param[out] link The link which has to be open before entering a crossing
+     * @return The next lane or 0 if there is no walking area ahead
+     */
+    static const MSLane* getNextLane(const PState& ped, int& nextDir, const MSLink*& link);
+
+    /// @brief return the sidewalk to use on the given edge (or 0 after reporting the error)
+    static const MSLane* getLane(const MSPerson* person, const MSEdge* edge);
+
+    /// @brief return the pedestrians on the given lane
+    const Pedestrians& getPedestrians(const MSLane* lane);
+
+    /// @brief the cell index for the given position
+    static int cellIndex(double x, int numCells);
+
+private:
+    /// @brief the MovePedestrians command that is registered
+    MovePedestrians* myCommand;
+
+    /// @brief the pedestrians per lane (sorted by numerical lane id for determinism)
+    ActiveLanes myActiveLanes;
+
+    /// @brief the total number of active pedestrians
+    int myNumActivePedestrians;
+
+#ifdef HAVE_FOX
+    /// @brief the pool for the parallel force computation
+    FXWorkerThread::Pool myThreadPool;
+#endif
+
+    /// @brief empty pedestrian vector
+    static Pedestrians noPedestrians;
+
+};
+
+
+#endif /* MSPModel_SocialForce_h */
+
+/****************************************************************************/
+
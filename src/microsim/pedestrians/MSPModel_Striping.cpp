@@ -548,11 +548,11 @@ MSPModel_Striping::getNextWalkingArea(const MSLane* currentLane, const int dir,
 }
 
 
-MSPModel_Striping::Obstacles
-MSPModel_Striping::getNeighboringObstacles(const Pedestrians& pedestrians, int egoIndex, int stripes) {
+void
+MSPModel_Striping::getNeighboringObstacles(const Pedestrians& pedestrians, int egoIndex, int stripes, Obstacles& obs, std::vector<bool>& haveBlocker) {
     const PState& ego = *pedestrians[egoIndex];
-    Obstacles obs(stripes, Obstacle(ego.myDir));
-    std::vector<bool> haveBlocker(stripes, false);
+    obs.assign(stripes, Obstacle(ego.myDir));
+    haveBlocker.assign(stripes, false);
     for (int index = egoIndex + 1; index < (int)pedestrians.size(); index++) {
         const PState& p = *pedestrians[index];
         if DEBUGCOND(ego) {
@@ -584,7 +584,6 @@ MSPModel_Striping::getNeighboringObstacles(const Pedestrians& pedestrians, int e
         std::cout << SIMTIME << " ped=" << ego.myPerson->getID() << "  neighObs=";
         DEBUG_PRINT(obs);
     }
-    return obs;
 }
 
 
@@ -602,12 +601,14 @@ const MSPModel_Striping::Obstacles&
 MSPModel_Striping::getNextLaneObstacles(NextLanesObstacles& nextLanesObs, const
                                         MSLane* lane, const MSLane* nextLane, int stripes, int nextDir,
                                         double currentLength, int currentDir) {
-    if (nextLanesObs.count(nextLane) == 0) {
+    NextLanesObstacles::iterator it = nextLanesObs.find(nextLane);
+    if (it == nextLanesObs.end()) {
         const double nextLength = nextLane->getEdge().isWalkingArea() ? myMinNextLengths[nextLane] : nextLane->getLength();
         // figure out the which pedestrians are ahead on the next lane
         const int nextStripes = numStripes(nextLane);
         // do not move past the end of the next lane in a single step
-        Obstacles obs(stripes, Obstacle(nextDir == FORWARD ? nextLength : 0, 0, OBSTACLE_NEXTEND, "nextEnd", 0));
+        it = nextLanesObs.insert(std::make_pair(nextLane, Obstacles(stripes, Obstacle(nextDir == FORWARD ? nextLength : 0, 0, OBSTACLE_NEXTEND, "nextEnd", 0)))).first;
+        Obstacles& obs = it->second;
 
         const int offset = getStripeOffset(nextStripes, stripes, currentDir != nextDir && nextStripes > stripes);
         //std::cout << SIMTIME << " getNextLaneObstacles"
@@ -684,9 +685,8 @@ MSPModel_Striping::getNextLaneObstacles(NextLanesObstacles& nextLanesObs, const
             }
             transformToCurrentLanePositions(obs, currentDir, nextDir, currentLength, nextLength);
         }
-        nextLanesObs[nextLane] = obs;
     }
-    return nextLanesObs[nextLane];
+    return it->second;
 }
 
 void
@@ -742,6 +742,8 @@ MSPModel_Striping::moveInDirection(SUMOTime currentTime, std::set<MSPerson*>& ch
             // need to handle each walkingAreaPath seperately and transform
             // coordinates beforehand
             std::set<const WalkingAreaPath*, walkingarea_path_sorter> paths;
+            Pedestrians toDelete;
+            Pedestrians transformedPeds;
             for (Pedestrians::iterator it = pedestrians.begin(); it != pedestrians.end(); ++it) {
                 const PState* p = *it;
                 assert(p->myWalkingAreaPath != 0);
@@ -755,8 +757,8 @@ MSPModel_Striping::moveInDirection(SUMOTime currentTime, std::set<MSPerson*>& ch
             }
             for (std::set<const WalkingAreaPath*, walkingarea_path_sorter>::iterator it = paths.begin(); it != paths.end(); ++it) {
                 const WalkingAreaPath* path = *it;
-                Pedestrians toDelete;
-                Pedestrians transformedPeds;
+                toDelete.clear();
+                transformedPeds.clear();
                 transformedPeds.reserve(pedestrians.size());
                 for (Pedestrians::iterator it_p = pedestrians.begin(); it_p != pedestrians.end(); ++it_p) {
                     PState* p = *it_p;
@@ -837,6 +839,11 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
 
     Obstacles crossingVehs(stripes, Obstacle(dir));
     bool hasCrossingVehObs = false;
+    // buffers which are reused for all pedestrians on this lane
+    Obstacles currentObs;
+    Obstacles neighObs;
+    Obstacles vehObs;
+    std::vector<bool> haveBlocker;
     if (lane->getEdge().isCrossing()) {
         hasCrossingVehObs = addCrossingVehs(lane, stripes, 0, dir, crossingVehs);
     }
@@ -844,7 +851,7 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
     for (int ii = 0; ii < (int)pedestrians.size(); ++ii) {
         PState& p = *pedestrians[ii];
         //std::cout << SIMTIME << "CHECKING" << p.myPerson->getID() << "\n";
-        Obstacles currentObs = obs;
+        currentObs.assign(obs.begin(), obs.end());
         if (p.myDir != dir || changedLane.count(p.myPerson) != 0) {
             if (!p.myWaitingToEnter) {
                 //if DEBUGCOND(p) {
@@ -885,7 +892,8 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
             std::cout << SIMTIME << " ped=" << p.myPerson->getID() << "  obsWithNext=";
             DEBUG_PRINT(currentObs);
         }
-        p.mergeObstacles(currentObs, getNeighboringObstacles(pedestrians, ii, stripes));
+        getNeighboringObstacles(pedestrians, ii, stripes, neighObs, haveBlocker);
+        p.mergeObstacles(currentObs, neighObs);
         if DEBUGCOND(p) {
             std::cout << SIMTIME << " ped=" << p.myPerson->getID() << "  obsWithNeigh=";
             DEBUG_PRINT(currentObs);
@@ -897,8 +905,7 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
                 && dist - p.getMinGap() < LOOKAHEAD_SAMEDIR * speed
                 && !link->opened(currentTime, speed, speed, p.getLength(), p.getImpatience(currentTime), speed, 0, 0, 0, p.ignoreRed(link))) {
             // prevent movement passed a closed link
-            Obstacles closedLink(stripes, Obstacle(p.myRelX + dir * (dist + NUMERICAL_EPS), 0, OBSTACLE_LINKCLOSED, "closedLink_" + link->getViaLaneOrLane()->getID(), 0));
-            p.mergeObstacles(currentObs, closedLink);
+            p.mergeObstacles(currentObs, Obstacle(p.myRelX + dir * (dist + NUMERICAL_EPS), 0, OBSTACLE_LINKCLOSED, "closedLink_" + link->getViaLaneOrLane()->getID(), 0));
             if DEBUGCOND(p) {
                 std::cout << SIMTIME << " ped=" << p.myPerson->getID() << "  obsWitTLS=";
                 DEBUG_PRINT(currentObs);
@@ -911,14 +918,13 @@ MSPModel_Striping::moveInDirectionOnLane(Pedestrians& pedestrians, const MSLane*
         }
         gDebugFlag1 = false;
         if (&lane->getEdge() == &p.myStage->getDestination() && p.myStage->getDestinationStop() != 0) {
-            Obstacles arrival(stripes, Obstacle(p.myStage->getArrivalPos() + dir * p.getMinGap(), 0, OBSTACLE_ARRIVALPOS, "arrival", 0));
-            p.mergeObstacles(currentObs, arrival);
+            p.mergeObstacles(currentObs, Obstacle(p.myStage->getArrivalPos() + dir * p.getMinGap(), 0, OBSTACLE_ARRIVALPOS, "arrival", 0));
         }
 
         if (lane->getVehicleNumberWithPartials() > 0) {
             // react to vehicles on the same lane
             // @todo: improve efficiency by using the same iterator for all pedestrians on this lane
-            Obstacles vehObs(stripes, Obstacle(dir));
+            vehObs.assign(stripes, Obstacle(dir));
             const int current = p.stripe();
             MSLane::AnyVehicleIterator begin = (dir == FORWARD ? lane->anyVehiclesUpstreamBegin() : lane->anyVehiclesBegin());
             MSLane::AnyVehicleIterator end = (dir == FORWARD ? lane->anyVehiclesUpstreamEnd() : lane->anyVehiclesEnd());
@@ -1687,6 +1693,20 @@ MSPModel_Striping::PState::mergeObstacles(Obstacles& into, const Obstacles& obs2
 }
 
 
+void
+MSPModel_Striping::PState::mergeObstacles(Obstacles& into, const Obstacle& obs2) {
+    const double dist2 = distanceTo(obs2);
+    for (int i = 0; i < (int)into.size(); ++i) {
+        if (gDebugFlag1) {
+            std::cout << "     i=" << i << " intoDist=" << distanceTo(into[i]) << " obs2Dist=" << dist2 << "\n";
+        }
+        if (dist2 < distanceTo(into[i])) {
+            into[i] = obs2;
+        }
+    }
+}
+
+
 bool
 MSPModel_Striping::PState::ignoreRed(const MSLink* link) const {
     if (link->haveRed()) {
@@ -144,12 +144,10 @@ public:
 
     ///@}
 
+    /// @name helpers which are shared with the other pedestrian models
+    ///@{
 
-protected:
-    static const double DIST_FAR_AWAY;
-    static const double DIST_BEHIND;
-    static const double DIST_OVERLAP;
-
+    /// @brief sorts lanes by their numerical id
     class lane_by_numid_sorter {
     public:
         /// comparing operation
@@ -158,6 +156,20 @@ protected:
         }
     };
 
+    /// @brief returns the direction in which these lanes are connectioned or 0 if they are not
+    static int connectedDirection(const MSLane* from, const MSLane* to);
+
+    /// @brief return the next walkingArea in the given direction
+    static const MSLane* getNextWalkingArea(const MSLane* currentLane, const int dir, MSLink*& link);
+
+    ///@}
+
+
+protected:
+    static const double DIST_FAR_AWAY;
+    static const double DIST_BEHIND;
+    static const double DIST_OVERLAP;
+
     struct Obstacle;
     struct WalkingAreaPath;
     class PState;
@@ -345,6 +357,9 @@ protected:
         /// @brief replace obstacles in the first vector with obstacles from the second if they are closer to me
         void mergeObstacles(Obstacles& into, const Obstacles& obs2);
 
+        /// @brief replace obstacles in the vector with the given obstacle (which spans all stripes) if it is closer to me
+        void mergeObstacles(Obstacles& into, const Obstacle& obs2);
+
         /// @brief whether the pedestrian may ignore a red light
         bool ignoreRed(const MSLink* link) const;
     };
@@ -401,9 +416,6 @@ protected:
 private:
     static void DEBUG_PRINT(const Obstacles& obs);
 
-    /// @brief returns the direction in which these lanes are connectioned or 0 if they are not
-    static int connectedDirection(const MSLane* from, const MSLane* to);
-
     /** @brief computes the successor lane for the given pedestrian and sets the
      * link as well as the direction to use on the succesor lane
      * @param[in] currentLane The lane the pedestrian is currently on
@@ -411,9 +423,6 @@ private:
      */
     static NextLaneInfo getNextLane(const PState& ped, const MSLane* currentLane, const MSLane* prevLane);
 
-    /// @brief return the next walkingArea in the given direction
-    static const MSLane* getNextWalkingArea(const MSLane* currentLane, const int dir, MSLink*& link);
-
     static void initWalkingAreaPaths(const MSNet* net);
 
     /// @brief return an arbitrary path across the given walkingArea
@@ -422,7 +431,11 @@ private:
     /// @brief return the maximum number of pedestrians walking side by side
     static int numStripes(const MSLane* lane);
 
-    static Obstacles getNeighboringObstacles(const Pedestrians& pedestrians, int egoIndex, int stripes);
+    /** @brief collect the closest pedestrians ahead of ego into the given buffer
+     * @param[out] obs The obstacles per stripe (resized to the number of stripes)
+     * @param[out] haveBlocker Helper buffer for overlapping pedestrians (reused between calls)
+     */
+    static void getNeighboringObstacles(const Pedestrians& pedestrians, int egoIndex, int stripes, Obstacles& obs, std::vector<bool>& haveBlocker);
 
     const Obstacles& getNextLaneObstacles(NextLanesObstacles& nextLanesObs, const MSLane* lane, const MSLane* nextLane, int stripes,
                                           int nextDir, double currentLength, int currentDir);
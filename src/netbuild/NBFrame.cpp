@@ -98,6 +98,9 @@ NBFrame::fillOptions(bool forNetgen) {
     if (!forNetgen) {
         oc.doRegister("dismiss-vclasses", new Option_Bool(false));
         oc.addDescription("dismiss-vclasses", "Processing", "Removes vehicle class restrictions from imported edges");
+
+        oc.doRegister("threads", new Option_Integer(0));
+        oc.addDescription("threads", "Processing", "The number of parallel execution threads used for computing and writing the network");
     }
 
     oc.doRegister("no-turnarounds", new Option_Bool(false));
@@ -29,6 +29,7 @@
 
 #include <string>
 #include <utils/common/MsgHandler.h>
+#include <utils/common/StdDefs.h>
 #include <utils/common/ToString.h>
 #include <utils/common/StringUtils.h>
 #include <utils/options/OptionsCont.h>
@@ -54,6 +55,8 @@
 // static members
 // ===========================================================================
 NBHeightMapper NBHeightMapper::Singleton;
+const int NBHeightMapper::TILE_SIZE = 256;
+const int NBHeightMapper::MAX_CACHED_TILES = 256;
 
 // ===========================================================================
 // method definitions
@@ -61,7 +64,7 @@ NBHeightMapper NBHeightMapper::Singleton;
 
 
 NBHeightMapper::NBHeightMapper():
-    myRTree(&Triangle::addSelf), myRaster(0) {
+    myRTree(&Triangle::addSelf) {
 }
 
 
@@ -78,7 +81,7 @@ NBHeightMapper::get() {
 
 bool
 NBHeightMapper::ready() const {
-    return myRaster != 0 || myTriangles.size() > 0;
+    return myRasters.size() > 0 || myTriangles.size() > 0;
 }
 
 
@@ -88,28 +91,29 @@ NBHeightMapper::getZ(const Position& geo) const {
         WRITE_WARNING("Cannot supply height since no height data was loaded");
         return 0;
     }
-    if (myRaster != 0) {
-        double result = -1e6;
-        if (myBoundary.around(geo)) {
-            const int xSize = int((myBoundary.xmax() - myBoundary.xmin()) / mySizeOfPixel.x() + .5);
-            const double normX = (geo.x() - myBoundary.xmin()) / mySizeOfPixel.x();
-            const double normY = (geo.y() - myBoundary.ymax()) / mySizeOfPixel.y();
+    for (int i = 0; i < (int)myRasters.size(); i++) {
+        const Raster& raster = myRasters[i];
+        if (raster.boundary.around(geo)) {
+            const double normX = (geo.x() - raster.boundary.xmin()) / raster.sizeOfPixel.x();
+            const double normY = (geo.y() - raster.boundary.ymax()) / raster.sizeOfPixel.y();
+            const int x = (int)normX;
+            const int y = (int)normY;
             PositionVector corners;
-            corners.push_back(Position(floor(normX) + 0.5, floor(normY) + 0.5, myRaster[(int)normY * xSize + (int)normX]));
+            corners.push_back(Position(floor(normX) + 0.5, floor(normY) + 0.5, getPixel(i, x, y)));
             if (normX - floor(normX) > 0.5) {
-                corners.push_back(Position(floor(normX) + 1.5, floor(normY) + 0.5, myRaster[(int)normY * xSize + (int)normX + 1]));
+                corners.push_back(Position(floor(normX) + 1.5, floor(normY) + 0.5, getPixel(i, x + 1, y)));
             } else {
-                corners.push_back(Position(floor(normX) - 0.5, floor(normY) + 0.5, myRaster[(int)normY * xSize + (int)normX - 1]));
+                corners.push_back(Position(floor(normX) - 0.5, floor(normY) + 0.5, getPixel(i, x - 1, y)));
             }
             if (normY - floor(normY) > 0.5) {
-                corners.push_back(Position(floor(normX) + 0.5, floor(normY) + 1.5, myRaster[((int)normY + 1) * xSize + (int)normX]));
+                corners.push_back(Position(floor(normX) + 0.5, floor(normY) + 1.5, getPixel(i, x, y + 1)));
             } else {
-                corners.push_back(Position(floor(normX) + 0.5, floor(normY) - 0.5, myRaster[((int)normY - 1) * xSize + (int)normX]));
+                corners.push_back(Position(floor(normX) + 0.5, floor(normY) - 0.5, getPixel(i, x, y - 1)));
+            }
+            const double result = Triangle(corners).getZ(Position(normX, normY));
+            if (result > -1e5 && result < 1e5) {
+                return result;
             }
-            result = Triangle(corners).getZ(Position(normX, normY));
-        }
-        if (result > -1e5 && result < 1e5) {
-            return result;
         }
     }
     // coordinates in degrees hence a small search window
@@ -282,43 +286,48 @@ NBHeightMapper::loadTiff(const std::string& file) {
         WRITE_ERROR("Cannot load GeoTIFF file.");
         return 0;
     }
-    const int xSize = poDataset->GetRasterXSize();
-    const int ySize = poDataset->GetRasterYSize();
+    Raster raster;
+    raster.dataset = poDataset;
+    raster.band = 0;
+    raster.xSize = poDataset->GetRasterXSize();
+    raster.ySize = poDataset->GetRasterYSize();
     double adfGeoTransform[6];
     if (poDataset->GetGeoTransform(adfGeoTransform) == CE_None) {
         Position topLeft(adfGeoTransform[0], adfGeoTransform[3]);
-        mySizeOfPixel.set(adfGeoTransform[1], adfGeoTransform[5]);
-        const double horizontalSize = xSize * mySizeOfPixel.x();
-        const double verticalSize = ySize * mySizeOfPixel.y();
-        myBoundary.add(topLeft);
-        myBoundary.add(topLeft.x() + horizontalSize, topLeft.y() + verticalSize);
+        raster.sizeOfPixel.set(adfGeoTransform[1], adfGeoTransform[5]);
+        const double horizontalSize = raster.xSize * raster.sizeOfPixel.x();
+        const double verticalSize = raster.ySize * raster.sizeOfPixel.y();
+        raster.boundary.add(topLeft);
+        raster.boundary.add(topLeft.x() + horizontalSize, topLeft.y() + verticalSize);
     } else {
         WRITE_ERROR("Could not parse geo information from " + file + ".");
+        GDALClose(poDataset);
         return 0;
     }
-    const int picSize = xSize * ySize;
-    myRaster = (int16_t*)CPLMalloc(sizeof(int16_t) * picSize);
     for (int i = 1; i <= poDataset->GetRasterCount(); i++) {
         GDALRasterBand* poBand = poDataset->GetRasterBand(i);
         if (poBand->GetColorInterpretation() != GCI_GrayIndex) {
             WRITE_ERROR("Unknown color band in " + file + ".");
-            clearData();
-            break;
+            GDALClose(poDataset);
+            return 0;
         }
         if (poBand->GetRasterDataType() != GDT_Int16) {
             WRITE_ERROR("Unknown data type in " + file + ".");
-            clearData();
-            break;
-        }
-        assert(xSize == poBand->GetXSize() && ySize == poBand->GetYSize());
-        if (poBand->RasterIO(GF_Read, 0, 0, xSize, ySize, myRaster, xSize, ySize, GDT_Int16, 0, 0) == CE_Failure) {
-            WRITE_ERROR("Failure in reading " + file + ".");
-            clearData();
-            break;
+            GDALClose(poDataset);
+            return 0;
         }
+        assert(raster.xSize == poBand->GetXSize() && raster.ySize == poBand->GetYSize());
+        raster.band = poBand;
+    }
+    if (raster.band == 0) {
+        WRITE_ERROR("No height information in " + file + ".");
+        GDALClose(poDataset);
+        return 0;
     }
-    GDALClose(poDataset);
-    return picSize;
+    // the pixels are read on demand, see getPixel
+    myBoundary.add(raster.boundary);
+    myRasters.push_back(raster);
+    return raster.xSize * raster.ySize;
 #else
     WRITE_ERROR("Cannot load GeoTIFF file since SUMO was compiled without GDAL support.");
     return 0;
@@ -332,16 +341,61 @@ NBHeightMapper::clearData() {
         delete *it;
     }
     myTriangles.clear();
+    myRTree.RemoveAll();
 #ifdef HAVE_GDAL
-    if (myRaster != 0) {
-        CPLFree(myRaster);
-        myRaster = 0;
+    for (std::vector<Raster>::iterator it = myRasters.begin(); it != myRasters.end(); ++it) {
+        GDALClose(it->dataset);
     }
 #endif
+    myRasters.clear();
+    myTiles.clear();
+    myTileIndex.clear();
     myBoundary.reset();
 }
 
 
+int16_t
+NBHeightMapper::getPixel(int raster, int x, int y) const {
+#ifdef HAVE_GDAL
+    const Raster& r = myRasters[raster];
+    x = MAX2(0, MIN2(x, r.xSize - 1));
+    y = MAX2(0, MIN2(y, r.ySize - 1));
+    const int tilesPerRow = (r.xSize + TILE_SIZE - 1) / TILE_SIZE;
+    const std::pair<int, int> key(raster, (y / TILE_SIZE) * tilesPerRow + x / TILE_SIZE);
+    std::map<std::pair<int, int>, std::list<Tile>::iterator>::const_iterator it = myTileIndex.find(key);
+    if (it != myTileIndex.end()) {
+        // mark as most recently used
+        myTiles.splice(myTiles.begin(), myTiles, it->second);
+    } else {
+        if ((int)myTiles.size() >= MAX_CACHED_TILES) {
+            myTileIndex.erase(myTiles.back().key);
+            myTiles.pop_back();
+        }
+        const int x0 = x - x % TILE_SIZE;
+        const int y0 = y - y % TILE_SIZE;
+        const int height = MIN2(TILE_SIZE, r.ySize - y0);
+        myTiles.push_front(Tile());
+        Tile& tile = myTiles.front();
+        tile.key = key;
+        tile.width = MIN2(TILE_SIZE, r.xSize - x0);
+        tile.data.resize(tile.width * height);
+        if (r.band->RasterIO(GF_Read, x0, y0, tile.width, height, &tile.data[0], tile.width, height, GDT_Int16, 0, 0) == CE_Failure) {
+            myTiles.pop_front();
+            throw ProcessError("Failure in reading " + std::string(r.dataset->GetDescription()) + ".");
+        }
+        myTileIndex[key] = myTiles.begin();
+    }
+    const Tile& tile = myTiles.front();
+    return tile.data[(y % TILE_SIZE) * tile.width + x % TILE_SIZE];
+#else
+    UNUSED_PARAMETER(raster);
+    UNUSED_PARAMETER(x);
+    UNUSED_PARAMETER(y);
+    return 0;
+#endif
+}
+
+
 // ===========================================================================
 // Triangle member methods
 // ===========================================================================
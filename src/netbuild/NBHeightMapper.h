@@ -36,6 +36,9 @@ typedef __int16 int16_t;
 #endif
 
 #include <string>
+#include <list>
+#include <map>
+#include <vector>
 #include <foreign/rtree/RTree.h>
 #include <utils/geom/PositionVector.h>
 #include <utils/geom/Boundary.h>
@@ -47,6 +50,8 @@ typedef __int16 int16_t;
 // class declarations
 // ===========================================================================
 class OptionsCont;
+class GDALDataset;
+class GDALRasterBand;
 
 
 // ===========================================================================
@@ -58,6 +63,11 @@ class OptionsCont;
  *
  * Importing data from '.shp'-files works only if SUMO was compiled with GDAL-support.
  *  If not, an error message is generated.
+ *
+ * GeoTIFF files are kept open and read in square tiles when a position within
+ *  the tile is queried. Only a limited number of tiles is kept in memory
+ *  (dropping the least recently used), so large or many raster files may be
+ *  given without loading them completely.
  */
 class NBHeightMapper {
 
@@ -129,19 +139,53 @@ public:
     };
 
 private:
+    /// @brief a loaded GeoTIFF file whose height information is read on demand
+    struct Raster {
+        /// @brief the opened file
+        GDALDataset* dataset;
+        /// @brief the band holding the height information in m
+        GDALRasterBand* band;
+        /// @brief the geo boundary of the raster
+        Boundary boundary;
+        /// @brief dimensions of one pixel
+        Position sizeOfPixel;
+        /// @brief the number of pixels per row and per column
+        int xSize;
+        int ySize;
+    };
+
+    /// @brief a tile of raster height information
+    struct Tile {
+        /// @brief the index of the raster and of the tile within the raster
+        std::pair<int, int> key;
+        /// @brief the number of pixels per row
+        int width;
+        /// @brief the heights of the tile in row major order
+        std::vector<int16_t> data;
+    };
+
     /// @brief the singleton instance
     static NBHeightMapper Singleton;
 
+    /// @brief the edge length of a tile in pixels
+    static const int TILE_SIZE;
+
+    /// @brief the maximum number of tiles kept in memory
+    static const int MAX_CACHED_TILES;
+
     Triangles myTriangles;
 
     /// @brief The RTree for spatial queries
     TRIANGLE_RTREE_QUAL myRTree;
 
-    /// @brief raster height information in m
-    int16_t* myRaster;
+    /// @brief the loaded GeoTIFF files
+    std::vector<Raster> myRasters;
+
+    /// @brief the tiles in memory, most recently used first
+    mutable std::list<Tile> myTiles;
 
-    /// @brief dimensions of one pixel in raster data
-    Position mySizeOfPixel;
+    /// @brief the positions of the tiles in memory
+    mutable std::map<std::pair<int, int>, std::list<Tile>::iterator> myTileIndex;
 
     /// @brief convex boundary of all known triangles;
     Boundary myBoundary;
@@ -166,6 +210,17 @@ private:
      */
     int loadTiff(const std::string& file);
 
+    /** @brief returns the height of the pixel, reading its tile if necessary
+     *
+     * Pixel coordinates outside the raster are moved to the nearest border pixel.
+     *
+     * @param[in] raster The index of the raster
+     * @param[in] x The pixel column
+     * @param[in] y The pixel row
+     * @return The height in m
+     */
+    int16_t getPixel(int raster, int x, int y) const;
+
     /// @brief clears loaded data
     void clearData();
 
@@ -32,6 +32,7 @@
 
 #include <string>
 #include <fstream>
+#include <algorithm>
 #include "NBNetBuilder.h"
 #include "NBNodeCont.h"
 #include "NBEdgeCont.h"
@@ -52,6 +53,9 @@
 #include "NBAlgorithms_Ramps.h"
 #include "NBHeightMapper.h"
 
+// the minimum number of coordinates to transform in parallel
+#define PROJECTION_MIN_PARALLEL 10000
+
 
 // ===========================================================================
 // method definitions
@@ -79,9 +83,20 @@ NBNetBuilder::applyOptions(OptionsCont& oc) {
 
 
 void
-NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurnarounds, bool mayAddOrRemove) {
+NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurnarounds, bool mayAddOrRemove, bool incremental) {
     GeoConvHelper& geoConvHelper = GeoConvHelper::getProcessing();
 
+    // the per-node computations may be restricted to the surroundings of the changed nodes
+    //  as long as no nodes are added or removed by the processing
+    //  (without any marked node the changes are unknown and everything is recomputed)
+    std::set<NBNode*> changedRegion;
+    const std::set<NBNode*>* region = 0;
+    if (incremental && !mayAddOrRemove && myNodeCont.hasChanged()) {
+        changedRegion = myNodeCont.getChangedRegion();
+        region = &changedRegion;
+    }
+    myNodeCont.clearChanged();
+
     const bool lefthand = oc.getBool("lefthand");
     if (lefthand) {
         mirrorX();
@@ -156,7 +171,7 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
         NBTurningDirectionsComputer::computeTurnDirections(myNodeCont, false);
         NBNodesEdgesSorter::sortNodesEdges(myNodeCont);
         myEdgeCont.computeLaneShapes();
-        myNodeCont.computeNodeShapes();
+        myNodeCont.computeNodeShapes(-1, region);
         myEdgeCont.computeEdgeShapes();
         if (oc.getBool("roundabouts.guess")) {
             myEdgeCont.guessRoundabouts();
@@ -187,6 +202,8 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
         myEdgeCont.computeLaneShapes();
     }
     if (numJoined > 0) {
+        // the joined nodes are new so everything needs to be recomputed
+        region = 0;
         // bit of a misnomer since we're already done
         WRITE_MESSAGE(" Joined " + toString(numJoined) + " junction cluster(s).");
     }
@@ -215,6 +232,10 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     geoConvHelper.setConvBoundary(boundary);
 
     if (!oc.getBool("offset.disable-normalization") && oc.isDefault("offset.x") && oc.isDefault("offset.y")) {
+        if (boundary.xmin() != 0 || (lefthand ? boundary.ymax() : boundary.ymin()) != 0) {
+            // the shapes of the internal lanes are not moved
+            region = 0;
+        }
         moveToOrigin(geoConvHelper, lefthand);
     }
     geoConvHelper.computeFinal(lefthand); // information needed for location element fixed at this point
@@ -319,9 +340,9 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     before = SysUtils::getCurrentMillis();
     PROGRESS_BEGIN_MESSAGE("Computing node shapes");
     if (oc.exists("geometry.junction-mismatch-threshold")) {
-        myNodeCont.computeNodeShapes(oc.getFloat("geometry.junction-mismatch-threshold"));
+        myNodeCont.computeNodeShapes(oc.getFloat("geometry.junction-mismatch-threshold"), region);
     } else {
-        myNodeCont.computeNodeShapes();
+        myNodeCont.computeNodeShapes(-1, region);
     }
     PROGRESS_TIME_MESSAGE(before);
     //
@@ -455,12 +476,12 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
     //
     before = SysUtils::getCurrentMillis();
     PROGRESS_BEGIN_MESSAGE("Computing node logics");
-    myNodeCont.computeLogics(myEdgeCont, oc);
+    myNodeCont.computeLogics(myEdgeCont, oc, region);
     PROGRESS_TIME_MESSAGE(before);
     //
     before = SysUtils::getCurrentMillis();
     PROGRESS_BEGIN_MESSAGE("Computing traffic light logics");
-    std::pair<int, int> numbers = myTLLCont.computeLogics(oc);
+    std::pair<int, int> numbers = myTLLCont.computeLogics(oc, region);
     PROGRESS_TIME_MESSAGE(before);
     std::string progCount = "";
     if (numbers.first != numbers.second) {
@@ -484,7 +505,9 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
         PROGRESS_BEGIN_MESSAGE("Building inner edges");
         // walking areas shall only be built if crossings are wished as well
         for (std::map<std::string, NBNode*>::const_iterator i = myNodeCont.begin(); i != myNodeCont.end(); ++i) {
-            (*i).second->buildInnerEdges();
+            if (region == 0 || region->count((*i).second) != 0) {
+                (*i).second->buildInnerEdges();
+            }
         }
         PROGRESS_TIME_MESSAGE(before);
     }
@@ -494,10 +517,12 @@ NBNetBuilder::compute(OptionsCont& oc, const std::set<std::string>& explicitTurn
         before = SysUtils::getCurrentMillis();
         PROGRESS_BEGIN_MESSAGE("stretching junctions to smooth geometries");
         myEdgeCont.computeLaneShapes();
-        myNodeCont.computeNodeShapes();
+        myNodeCont.computeNodeShapes(-1, region);
         myEdgeCont.computeEdgeShapes();
         for (std::map<std::string, NBNode*>::const_iterator i = myNodeCont.begin(); i != myNodeCont.end(); ++i) {
-            (*i).second->buildInnerEdges();
+            if (region == 0 || region->count((*i).second) != 0) {
+                (*i).second->buildInnerEdges();
+            }
         }
         PROGRESS_TIME_MESSAGE(before);
     }
@@ -647,6 +672,9 @@ NBNetBuilder::transformCoordinates(PositionVector& from, bool includeInBoundary,
         // now perform the transformation again so that height mapping can be
         // performed for the new points
     }
+    if (!NBHeightMapper::get().ready()) {
+        return GeoConvHelper::getProcessing().x2cartesian(from, includeInBoundary);
+    }
     bool ok = true;
     for (int i = 0; i < (int) from.size(); i++) {
         ok = ok && transformCoordinate(from[i], includeInBoundary, from_srs);
@@ -654,10 +682,53 @@ NBNetBuilder::transformCoordinates(PositionVector& from, bool includeInBoundary,
     return ok;
 }
 
+
+bool
+NBNetBuilder::transformCoordinatesParallel(PositionVector& from, bool includeInBoundary, int numThreads) {
+    GeoConvHelper& geoConv = GeoConvHelper::getProcessing();
+#ifdef HAVE_FOX
+    if (numThreads > 1 && (int)from.size() > PROJECTION_MIN_PARALLEL) {
+        // the first position initialises the projection which is then copied for every thread
+        int ok = geoConv.x2cartesian(from[0], includeInBoundary);
+        const int chunkSize = ((int)from.size() - 2) / numThreads + 1;
+        std::vector<GeoConvHelper*> copies;
+        std::vector<int> results(numThreads, 1);
+        FXWorkerThread::Pool threadPool(numThreads);
+        for (int begin = 1; begin < (int)from.size(); begin += chunkSize) {
+            copies.push_back(geoConv.copyForThread());
+            threadPool.add(new ProjectionTask(from, begin, MIN2(begin + chunkSize, (int)from.size()), includeInBoundary, *copies.back(), results[copies.size() - 1]));
+        }
+        threadPool.waitAll();
+        for (int i = 0; i < (int)copies.size(); i++) {
+            ok &= results[i];
+            geoConv.includeBoundaries(*copies[i]);
+            delete copies[i];
+        }
+        return ok != 0;
+    }
+#else
+    UNUSED_PARAMETER(numThreads);
+#endif
+    return geoConv.x2cartesian(from, includeInBoundary);
+}
+
 bool 
 NBNetBuilder::runningNetedit() {
     // see GNELoadThread::fillOptions
     return OptionsCont::getOptions().exists("new");
 }
 
+
+#ifdef HAVE_FOX
+// ===========================================================================
+// NBNetBuilder::ProjectionTask method definitions
+// ===========================================================================
+void
+NBNetBuilder::ProjectionTask::run(FXWorkerThread* /* context */) {
+    PositionVector positions(myPositions.begin() + myBegin, myPositions.begin() + myEnd);
+    myOK = myGeoConv.x2cartesian(positions, myIncludeInBoundary);
+    std::copy(positions.begin(), positions.end(), myPositions.begin() + myBegin);
+}
+#endif
+
 /****************************************************************************/
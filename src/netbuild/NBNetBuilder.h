@@ -45,6 +45,9 @@
 #include "NBPTStopCont.h"
 #include "NBPTLineCont.h"
 #include <utils/common/UtilExceptions.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -135,9 +138,12 @@ public:
      * @param[in] oc Container that contains options for building
      * @param[in] explicitTurnarounds List of edge ids for which turn-arounds should be added (used by NETEDIT)
      * @param[in] mayAddOrRemove whether processing steps which cause nodes and edges to be added or removed shall be triggered (used by netedit)
+     * @param[in] incremental whether the shapes, logics and inner edges shall only be recomputed for the
+     *  nodes marked as changed in the node container and their neighbors (used by netedit, needs !mayAddOrRemove,
+     *  everything is recomputed if no node is marked)
      * @exception ProcessError (recheck)
      */
-    void compute(OptionsCont& oc, const std::set<std::string>& explicitTurnarounds = std::set<std::string>(), bool mayAddOrRemove = true);
+    void compute(OptionsCont& oc, const std::set<std::string>& explicitTurnarounds = std::set<std::string>(), bool mayAddOrRemove = true, bool incremental = false);
 
     /** @brief Updates the shape for a single Node
      *
@@ -217,6 +223,17 @@ public:
     static bool transformCoordinate(Position& from, bool includeInBoundary = true, GeoConvHelper* from_srs = 0);
     static bool transformCoordinates(PositionVector& from, bool includeInBoundary = true, GeoConvHelper* from_srs = 0);
 
+    /**
+     * @brief transforms many loaded coordinates at once
+     * The positions are split among the given number of threads, each with a projection of its own.
+     * Unlike transformCoordinates no height data is imported and no segments are split.
+     * @param[in,out] from The coordinates to be transformed
+     * @param[in] includeInBoundary Whether to patch the convex boundary of the GeoConvHelper default instance
+     * @param[in] numThreads The number of threads to use
+     * @return Whether all coordinates could be transformed
+     */
+    static bool transformCoordinatesParallel(PositionVector& from, bool includeInBoundary, int numThreads);
+
     /// @brief whether netbuilding takes place in the context of NETEDIT
     static bool runningNetedit();
 
@@ -274,6 +291,29 @@ private:
     /// @brief mirror the network along the X-axis
     void mirrorX();
 
+#ifdef HAVE_FOX
+    /**
+     * @class ProjectionTask
+     * @brief Transforms a range of coordinates with a projection of its own in a worker thread
+     */
+    class ProjectionTask : public FXWorkerThread::Task {
+    public:
+        ProjectionTask(PositionVector& positions, const int begin, const int end, const bool includeInBoundary, GeoConvHelper& geoConv, int& ok)
+            : myPositions(positions), myBegin(begin), myEnd(end), myIncludeInBoundary(includeInBoundary), myGeoConv(geoConv), myOK(ok) {}
+        void run(FXWorkerThread* context);
+    private:
+        PositionVector& myPositions;
+        const int myBegin;
+        const int myEnd;
+        const bool myIncludeInBoundary;
+        GeoConvHelper& myGeoConv;
+        int& myOK;
+    private:
+        /// @brief Invalidated assignment operator.
+        ProjectionTask& operator=(const ProjectionTask&);
+    };
+#endif
+
 private:
     /// @brief invalidated copy constructor
     NBNetBuilder(const NBNetBuilder& s);
@@ -716,19 +716,27 @@ NBNode::removeJoinedTrafficLights() {
 
 void
 NBNode::computeLogic(const NBEdgeCont& ec, OptionsCont& oc) {
+    if (buildRequest(ec, oc)) {
+        computeRequestLogic();
+    }
+}
+
+
+bool
+NBNode::buildRequest(const NBEdgeCont& ec, OptionsCont& oc) {
     delete myRequest; // possibly recomputation step
     myRequest = 0;
     if (myIncomingEdges.size() == 0 || myOutgoingEdges.size() == 0) {
         // no logic if nothing happens here
         myType = NODETYPE_DEAD_END;
         removeJoinedTrafficLights();
-        return;
+        return false;
     }
     // check whether the node was set to be unregulated by the user
     if (oc.getBool("keep-nodes-unregulated") || oc.isInStringVector("keep-nodes-unregulated.explicit", getID())
             || (oc.getBool("keep-nodes-unregulated.district-nodes") && (isNearDistrict() || isDistrict()))) {
         myType = NODETYPE_NOJUNCTION;
-        return;
+        return false;
     }
     // compute the logic if necessary or split the junction
     if (myType != NODETYPE_NOJUNCTION && myType != NODETYPE_DISTRICT && myType != NODETYPE_TRAFFIC_LIGHT_NOJUNCTION) {
@@ -753,9 +761,16 @@ NBNode::computeLogic(const NBEdgeCont& ec, OptionsCont& oc) {
             myType = NODETYPE_DEAD_END;
             removeJoinedTrafficLights();
         } else {
-            myRequest->buildBitfieldLogic();
+            return true;
         }
     }
+    return false;
+}
+
+
+void
+NBNode::computeRequestLogic() {
+    myRequest->buildBitfieldLogic();
 }
 
 
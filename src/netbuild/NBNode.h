@@ -351,6 +351,17 @@ public:
     /// @brief computes the node's type, logic and traffic light
     void computeLogic(const NBEdgeCont& ec, OptionsCont& oc);
 
+    /** @brief computes the node's type and builds its request without computing the logic
+     * @return Whether the logic has to be computed using computeRequestLogic
+     */
+    bool buildRequest(const NBEdgeCont& ec, OptionsCont& oc);
+
+    /** @brief computes the logic of the request built before
+     *
+     * This depends only on the node and its edges and may run in parallel for different nodes.
+     */
+    void computeRequestLogic();
+
     /// @brief writes the XML-representation of the logic as a bitset-logic XML representation
     bool writeLogic(OutputDevice& into, const bool checkLaneFoes) const;
 
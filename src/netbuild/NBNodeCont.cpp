@@ -58,6 +58,9 @@
 #include "NBPTLineCont.h"
 #include "NBParking.h"
 
+// number of nodes whose logic is computed by one task of the thread pool
+#define LOGIC_CHUNK_SIZE 256
+
 
 // ===========================================================================
 // method definitions
@@ -153,6 +156,7 @@ NBNodeCont::extract(NBNode* node, bool remember) {
     const float pos[2] = {(float)node->getPosition().x(), (float)node->getPosition().y()};
     myRTree.Remove(pos, pos, node);
     node->removeTrafficLights();
+    myChanged.erase(node);
     if (remember) {
         myExtractedNodes.insert(node);
     }
@@ -498,6 +502,64 @@ NBNodeCont::generateNodeClusters(double maxDist, NodeClusters& into) const {
 }
 
 
+std::set<NBNode*>
+NBNodeCont::getNeighbors(const NBNode* n) {
+    std::set<NBNode*> result;
+    for (EdgeVector::const_iterator it_edge = n->getOutgoingEdges().begin(); it_edge != n->getOutgoingEdges().end(); ++it_edge) {
+        result.insert((*it_edge)->getToNode());
+    }
+    for (EdgeVector::const_iterator it_edge = n->getIncomingEdges().begin(); it_edge != n->getIncomingEdges().end(); ++it_edge) {
+        result.insert((*it_edge)->getFromNode());
+    }
+    return result;
+}
+
+
+bool
+NBNodeCont::isFringe(const NBNode* n, const std::set<NBNode*>& cluster) {
+    // compute clusterDist for node (length of shortest edge which connects this node to the cluster)
+    double clusterDist = std::numeric_limits<double>::max();
+    for (EdgeVector::const_iterator it_edge = n->getOutgoingEdges().begin(); it_edge != n->getOutgoingEdges().end(); ++it_edge) {
+        NBNode* neighbor = (*it_edge)->getToNode();
+        if (cluster.count(neighbor) != 0) {
+            clusterDist = MIN2(clusterDist, (*it_edge)->getLoadedLength());
+        }
+    }
+    for (EdgeVector::const_iterator it_edge = n->getIncomingEdges().begin(); it_edge != n->getIncomingEdges().end(); ++it_edge) {
+        NBNode* neighbor = (*it_edge)->getFromNode();
+        if (cluster.count(neighbor) != 0) {
+            clusterDist = MIN2(clusterDist, (*it_edge)->getLoadedLength());
+        }
+    }
+    // geometry-like nodes at fringe of the cluster
+    // (they have 1 neighbor in the cluster and at most 1 neighbor outside the cluster)
+    std::set<NBNode*> neighbors;
+    std::set<NBNode*> clusterNeigbors;
+    const double pedestrianFringeThreshold = 1.0;
+    for (EdgeVector::const_iterator it_edge = n->getOutgoingEdges().begin(); it_edge != n->getOutgoingEdges().end(); ++it_edge) {
+        NBNode* neighbor = (*it_edge)->getToNode();
+        if (cluster.count(neighbor) == 0) {
+            if ((*it_edge)->getPermissions() != SVC_PEDESTRIAN || clusterDist < pedestrianFringeThreshold) {
+                neighbors.insert(neighbor);
+            }
+        } else {
+            clusterNeigbors.insert(neighbor);
+        }
+    }
+    for (EdgeVector::const_iterator it_edge = n->getIncomingEdges().begin(); it_edge != n->getIncomingEdges().end(); ++it_edge) {
+        NBNode* neighbor = (*it_edge)->getFromNode();
+        if (cluster.count(neighbor) == 0) {
+            if ((*it_edge)->getPermissions() != SVC_PEDESTRIAN || clusterDist < pedestrianFringeThreshold) {
+                neighbors.insert(neighbor);
+            }
+        } else {
+            clusterNeigbors.insert(neighbor);
+        }
+    }
+    return neighbors.size() <= 1 && clusterNeigbors.size() == 1;
+}
+
+
 void
 NBNodeCont::addJoinExclusion(const std::vector<std::string>& ids, bool check) {
     for (std::vector<std::string>::const_iterator it = ids.begin(); it != ids.end(); it++) {
@@ -572,57 +634,27 @@ NBNodeCont::joinJunctions(double maxDist, NBDistrictCont& dc, NBEdgeCont& ec, NB
             }
         }
         // iteratively remove the fringe
-        bool pruneFringe = true;
-        while (pruneFringe) {
-            pruneFringe = false;
-            for (std::set<NBNode*>::iterator j = cluster.begin(); j != cluster.end();) {
-                std::set<NBNode*>::iterator check = j;
-                NBNode* n = *check;
-                ++j;
-
-                // compute clusterDist for node (length of shortest edge which connects this node to the cluster)
-                double clusterDist = std::numeric_limits<double>::max();
-                for (EdgeVector::const_iterator it_edge = n->getOutgoingEdges().begin(); it_edge != n->getOutgoingEdges().end(); ++it_edge) {
-                    NBNode* neighbor = (*it_edge)->getToNode();
+        // (only the cluster neighbors of a removed node need to be checked again,
+        //  the ones following it in the cluster order are checked within the current pass)
+        std::set<NBNode*> check = cluster;
+        std::set<NBNode*> checkNextPass;
+        while (!check.empty()) {
+            NBNode* n = *check.begin();
+            check.erase(check.begin());
+            if (isFringe(n, cluster)) {
+                cluster.erase(n);
+                for (NBNode* neighbor : getNeighbors(n)) {
                     if (cluster.count(neighbor) != 0) {
-                        clusterDist = MIN2(clusterDist, (*it_edge)->getLoadedLength());
-                    }
-                }
-                for (EdgeVector::const_iterator it_edge = n->getIncomingEdges().begin(); it_edge != n->getIncomingEdges().end(); ++it_edge) {
-                    NBNode* neighbor = (*it_edge)->getFromNode();
-                    if (cluster.count(neighbor) != 0) {
-                        clusterDist = MIN2(clusterDist, (*it_edge)->getLoadedLength());
-                    }
-                }
-                // remove geometry-like nodes at fringe of the cluster
-                // (they have 1 neighbor in the cluster and at most 1 neighbor outside the cluster)
-                std::set<NBNode*> neighbors;
-                std::set<NBNode*> clusterNeigbors;
-                const double pedestrianFringeThreshold = 1.0;
-                for (EdgeVector::const_iterator it_edge = n->getOutgoingEdges().begin(); it_edge != n->getOutgoingEdges().end(); ++it_edge) {
-                    NBNode* neighbor = (*it_edge)->getToNode();
-                    if (cluster.count(neighbor) == 0) {
-                        if ((*it_edge)->getPermissions() != SVC_PEDESTRIAN || clusterDist < pedestrianFringeThreshold) {
-                            neighbors.insert(neighbor);
+                        if (cluster.key_comp()(n, neighbor)) {
+                            check.insert(neighbor);
+                        } else {
+                            checkNextPass.insert(neighbor);
                         }
-                    } else {
-                        clusterNeigbors.insert(neighbor);
                     }
                 }
-                for (EdgeVector::const_iterator it_edge = n->getIncomingEdges().begin(); it_edge != n->getIncomingEdges().end(); ++it_edge) {
-                    NBNode* neighbor = (*it_edge)->getFromNode();
-                    if (cluster.count(neighbor) == 0) {
-                        if ((*it_edge)->getPermissions() != SVC_PEDESTRIAN || clusterDist < pedestrianFringeThreshold) {
-                            neighbors.insert(neighbor);
-                        }
-                    } else {
-                        clusterNeigbors.insert(neighbor);
-                    }
-                }
-                if (neighbors.size() <= 1 && clusterNeigbors.size() == 1) {
-                    cluster.erase(check);
-                    pruneFringe = true; // other nodes could belong to the fringe now
-                }
+            }
+            if (check.empty()) {
+                check.swap(checkNextPass);
             }
         }
         // exclude the fromNode of a long edge if the toNode is in the cluster (and they were both added via an alternative path).
@@ -1142,9 +1174,30 @@ NBNodeCont::computeLanes2Lanes() {
 
 // computes the "wheel" of incoming and outgoing edges for every node
 void
-NBNodeCont::computeLogics(const NBEdgeCont& ec, OptionsCont& oc) {
+NBNodeCont::computeLogics(const NBEdgeCont& ec, OptionsCont& oc, const std::set<NBNode*>* region) {
+    // building the requests may change node types and tls and emit warnings so it stays serial
+    std::vector<NBNode*> requests;
     for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
-        (*i).second->computeLogic(ec, oc);
+        if (region != 0 && region->count((*i).second) == 0) {
+            continue;
+        }
+        if ((*i).second->buildRequest(ec, oc)) {
+            requests.push_back((*i).second);
+        }
+    }
+#ifdef HAVE_FOX
+    const int numThreads = oc.exists("threads") ? oc.getInt("threads") : 0;
+    if (numThreads > 1) {
+        FXWorkerThread::Pool threadPool(numThreads);
+        for (int begin = 0; begin < (int)requests.size(); begin += LOGIC_CHUNK_SIZE) {
+            threadPool.add(new LogicTask(requests, begin, MIN2(begin + LOGIC_CHUNK_SIZE, (int)requests.size())));
+        }
+        threadPool.waitAll();
+        return;
+    }
+#endif
+    for (std::vector<NBNode*>::const_iterator i = requests.begin(); i != requests.end(); ++i) {
+        (*i)->computeRequestLogic();
     }
 }
 
@@ -1159,6 +1212,7 @@ NBNodeCont::clear() {
         delete(*i);
     }
     myExtractedNodes.clear();
+    myChanged.clear();
 }
 
 
@@ -1177,13 +1231,26 @@ NBNodeCont::getFreeID() {
 
 
 void
-NBNodeCont::computeNodeShapes(double mismatchThreshold) {
+NBNodeCont::computeNodeShapes(double mismatchThreshold, const std::set<NBNode*>* region) {
     for (NodeCont::iterator i = myNodes.begin(); i != myNodes.end(); i++) {
-        (*i).second->computeNodeShape(mismatchThreshold);
+        if (region == 0 || region->count((*i).second) != 0) {
+            (*i).second->computeNodeShape(mismatchThreshold);
+        }
     }
 }
 
 
+std::set<NBNode*>
+NBNodeCont::getChangedRegion() const {
+    std::set<NBNode*> result = myChanged;
+    for (std::set<NBNode*>::const_iterator i = myChanged.begin(); i != myChanged.end(); ++i) {
+        const std::set<NBNode*> neighbors = getNeighbors(*i);
+        result.insert(neighbors.begin(), neighbors.end());
+    }
+    return result;
+}
+
+
 void
 NBNodeCont::printBuiltNodesStatistics() const {
     int numUnregulatedJunctions = 0;
@@ -1330,5 +1397,18 @@ NBNodeCont::remapIDs(bool numericaIDs, bool reservedIDs) {
     return (int)toChange.size();
 }
 
+#ifdef HAVE_FOX
+// ===========================================================================
+// NBNodeCont::LogicTask method definitions
+// ===========================================================================
+void
+NBNodeCont::LogicTask::run(FXWorkerThread* /* context */) {
+    for (int i = myBegin; i < myEnd; i++) {
+        myNodes[i]->computeRequestLogic();
+    }
+}
+#endif
+
+
 /****************************************************************************/
 
@@ -40,6 +40,9 @@
 #include "NBEdgeCont.h"
 #include "NBNode.h"
 #include <utils/common/UtilExceptions.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -234,8 +237,15 @@ public:
     /// divides the incoming lanes on outgoing lanes
     void computeLanes2Lanes();
 
-    /// build the list of outgoing edges and lanes
-    void computeLogics(const NBEdgeCont& ec, OptionsCont& oc);
+    /** @brief build the list of outgoing edges and lanes
+     *
+     * The requests are built in the order of the node ids, the (independent)
+     *  logics of the requests are computed in parallel if option "threads"
+     *  asks for more than one thread.
+     *
+     * @param[in] region If given, only the requests of these nodes are rebuilt
+     */
+    void computeLogics(const NBEdgeCont& ec, OptionsCont& oc, const std::set<NBNode*>* region = 0);
 
     /// @brief Returns the number of nodes stored in this container
     int size() const {
@@ -250,8 +260,35 @@ public:
 
     /** @brief Compute the junction shape for this node
      * @param[in] mismatchThreshold The threshold for warning about shapes which are away from myPosition
+     * @param[in] region If given, only the shapes of these nodes are recomputed
+     */
+    void computeNodeShapes(double mismatchThreshold = -1, const std::set<NBNode*>* region = 0);
+
+    /// @name Tracking of changed nodes for the incremental recomputation (used by netedit)
+    /// @{
+
+    /// @brief marks the node as modified since the last computation
+    void markAsChanged(NBNode* node) {
+        myChanged.insert(node);
+    }
+
+    /// @brief returns whether any node was marked as modified
+    bool hasChanged() const {
+        return !myChanged.empty();
+    }
+
+    /** @brief Returns the nodes which need to be recomputed after the marked changes
+     *
+     * These are the modified nodes and their neighbors (the nodes at the other
+     *  end of their incoming and outgoing edges).
      */
-    void computeNodeShapes(double mismatchThreshold = -1);
+    std::set<NBNode*> getChangedRegion() const;
+
+    /// @brief forgets the marked changes (after a computation)
+    void clearChanged() {
+        myChanged.clear();
+    }
+    /// @}
 
     /** @brief Prints statistics about built nodes
      *
@@ -309,6 +346,19 @@ private:
      */
     void generateNodeClusters(double maxDist, NodeClusters& into) const;
 
+    /// @brief returns the nodes connected to the given node by an incoming or outgoing edge
+    static std::set<NBNode*> getNeighbors(const NBNode* n);
+
+    /** @brief Returns whether the node is a geometry-like node at the fringe of the cluster
+     *
+     * The result only depends on the cluster membership of the node's neighbors.
+     *
+     * @param[in] n The node to check
+     * @param[in] cluster The cluster the node belongs to
+     * @return Whether the node has one neighbor in the cluster and at most one outside
+     */
+    static bool isFringe(const NBNode* n, const std::set<NBNode*>& cluster);
+
     /// @brief joins the given node clusters
     void joinNodeClusters(NodeClusters clusters, NBDistrictCont& dc, NBEdgeCont& ec, NBTrafficLightLogicCont& tlc);
 
@@ -323,6 +373,26 @@ private:
     bool shouldBeTLSControlled(const std::set<NBNode*>& c) const;
     /// @}
 
+#ifdef HAVE_FOX
+    /**
+     * @class LogicTask
+     * @brief Computes the request logics of a range of nodes in a worker thread
+     */
+    class LogicTask : public FXWorkerThread::Task {
+    public:
+        LogicTask(const std::vector<NBNode*>& nodes, const int begin, const int end)
+            : myNodes(nodes), myBegin(begin), myEnd(end) {}
+        void run(FXWorkerThread* context);
+    private:
+        const std::vector<NBNode*>& myNodes;
+        const int myBegin;
+        const int myEnd;
+    private:
+        /// @brief Invalidated assignment operator.
+        LogicTask& operator=(const LogicTask&);
+    };
+#endif
+
 
 private:
     /// @brief The running internal id
@@ -337,6 +407,9 @@ private:
     /// @brief The extracted nodes which are kept for reference
     std::set<NBNode*> myExtractedNodes;
 
+    /// @brief The nodes modified since the last computation
+    std::set<NBNode*> myChanged;
+
     /// @brief set of node ids which should not be joined
     std::set<std::string> myJoinExclusions;
 
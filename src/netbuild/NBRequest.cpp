@@ -355,12 +355,13 @@ NBRequest::distanceCounterClockwise(NBEdge* from, NBEdge* to) {
 void
 NBRequest::writeLogic(std::string /* key */, OutputDevice& into, const bool checkLaneFoes) const {
     int pos = 0;
+    const std::vector<LinkConnection> links = getLinkConnections();
     EdgeVector::const_iterator i;
     // normal connections
     for (i = myIncoming.begin(); i != myIncoming.end(); i++) {
         int noLanes = (*i)->getNumLanes();
         for (int k = 0; k < noLanes; k++) {
-            pos = writeLaneResponse(into, *i, k, pos, checkLaneFoes);
+            pos = writeLaneResponse(into, *i, k, pos, checkLaneFoes, links);
         }
     }
     // crossings
@@ -372,61 +373,66 @@ NBRequest::writeLogic(std::string /* key */, OutputDevice& into, const bool chec
 
 void
 NBRequest::resetSignalised() {
+    const std::vector<LinkConnection> links = getLinkConnections();
     // go through possible prohibitions
-    for (EdgeVector::const_iterator i11 = myIncoming.begin(); i11 != myIncoming.end(); i11++) {
-        int noLanesEdge1 = (*i11)->getNumLanes();
-        for (int j1 = 0; j1 < noLanesEdge1; j1++) {
-            std::vector<NBEdge::Connection> el1 = (*i11)->getConnectionsFromLane(j1);
-            for (std::vector<NBEdge::Connection>::iterator i12 = el1.begin(); i12 != el1.end(); ++i12) {
-                int idx1 = getIndex((*i11), (*i12).toEdge);
-                if (idx1 < 0) {
-                    continue;
-                }
-                // go through possibly prohibited
-                for (EdgeVector::const_iterator i21 = myIncoming.begin(); i21 != myIncoming.end(); i21++) {
-                    int noLanesEdge2 = (*i21)->getNumLanes();
-                    for (int j2 = 0; j2 < noLanesEdge2; j2++) {
-                        std::vector<NBEdge::Connection> el2 = (*i21)->getConnectionsFromLane(j2);
-                        for (std::vector<NBEdge::Connection>::iterator i22 = el2.begin(); i22 != el2.end(); i22++) {
-                            int idx2 = getIndex((*i21), (*i22).toEdge);
-                            if (idx2 < 0) {
-                                continue;
-                            }
-                            // check
-                            // same incoming connections do not prohibit each other
-                            if ((*i11) == (*i21)) {
-                                myForbids[idx1][idx2] = false;
-                                myForbids[idx2][idx1] = false;
-                                continue;
-                            }
-                            // check other
-                            // if both are non-signalised or both are signalised
-                            if (((*i12).tlID == "" && (*i22).tlID == "")
-                                    ||
-                                    ((*i12).tlID != "" && (*i22).tlID != "")) {
-                                // do nothing
-                                continue;
-                            }
-                            // supposing, we don not have to
-                            //  brake if we are no foes
-                            if (!foes(*i11, (*i12).toEdge, *i21, (*i22).toEdge)) {
-                                continue;
-                            }
-                            // otherwise:
-                            //  the non-signalised must break
-                            if ((*i12).tlID != "") {
-                                myForbids[idx1][idx2] = true;
-                                myForbids[idx2][idx1] = false;
-                            } else {
-                                myForbids[idx1][idx2] = false;
-                                myForbids[idx2][idx1] = true;
-                            }
-                        }
-                    }
-                }
+    for (std::vector<LinkConnection>::const_iterator l1 = links.begin(); l1 != links.end(); ++l1) {
+        const int idx1 = l1->index;
+        if (idx1 < 0) {
+            continue;
+        }
+        // go through possibly prohibited
+        for (std::vector<LinkConnection>::const_iterator l2 = links.begin(); l2 != links.end(); ++l2) {
+            const int idx2 = l2->index;
+            if (idx2 < 0) {
+                continue;
+            }
+            // check
+            // same incoming connections do not prohibit each other
+            if (l1->from == l2->from) {
+                myForbids[idx1][idx2] = false;
+                myForbids[idx2][idx1] = false;
+                continue;
+            }
+            // check other
+            // if both are non-signalised or both are signalised
+            if ((l1->con.tlID == "" && l2->con.tlID == "")
+                    ||
+                    (l1->con.tlID != "" && l2->con.tlID != "")) {
+                // do nothing
+                continue;
+            }
+            // supposing, we don not have to
+            //  brake if we are no foes
+            if (!myForbids[idx1][idx2] && !myForbids[idx2][idx1]) {
+                continue;
+            }
+            // otherwise:
+            //  the non-signalised must break
+            if (l1->con.tlID != "") {
+                myForbids[idx1][idx2] = true;
+                myForbids[idx2][idx1] = false;
+            } else {
+                myForbids[idx1][idx2] = false;
+                myForbids[idx2][idx1] = true;
+            }
+        }
+    }
+}
+
+
+std::vector<NBRequest::LinkConnection>
+NBRequest::getLinkConnections() const {
+    std::vector<LinkConnection> result;
+    for (EdgeVector::const_iterator i = myIncoming.begin(); i != myIncoming.end(); i++) {
+        const int noLanes = (*i)->getNumLanes();
+        for (int j = 0; j < noLanes; j++) {
+            const std::vector<NBEdge::Connection> connected = (*i)->getConnectionsFromLane(j);
+            for (std::vector<NBEdge::Connection>::const_iterator k = connected.begin(); k != connected.end(); ++k) {
+                result.push_back(LinkConnection(*i, *k, getIndex(*i, k->toEdge)));
             }
         }
     }
+    return result;
 }
 
 
@@ -502,15 +508,15 @@ NBRequest::forbids(const NBEdge* const possProhibitorFrom, const NBEdge* const p
 
 int
 NBRequest::writeLaneResponse(OutputDevice& od, NBEdge* from,
-                             int fromLane, int pos, const bool checkLaneFoes) const {
+                             int fromLane, int pos, const bool checkLaneFoes, const std::vector<LinkConnection>& links) const {
     std::vector<NBEdge::Connection> connected = from->getConnectionsFromLane(fromLane);
     for (std::vector<NBEdge::Connection>::iterator j = connected.begin(); j != connected.end(); j++) {
         assert((*j).toEdge != 0);
         od.openTag(SUMO_TAG_REQUEST);
         od.writeAttr(SUMO_ATTR_INDEX, pos++);
-        const std::string foes = getFoesString(from, (*j).toEdge, fromLane, (*j).toLane, checkLaneFoes);
+        const std::string foes = getFoesString(from, (*j).toEdge, fromLane, (*j).toLane, checkLaneFoes, links);
         const std::string response = (myJunction->getType() == NODETYPE_ZIPPER ? foes
-                                      : getResponseString((*j).tlLinkIndex, from, (*j).toEdge, fromLane, (*j).toLane, (*j).mayDefinitelyPass, checkLaneFoes));
+                                      : getResponseString((*j).tlLinkIndex, from, (*j).toEdge, fromLane, (*j).toLane, (*j).mayDefinitelyPass, checkLaneFoes, links));
         od.writeAttr(SUMO_ATTR_RESPONSE, response);
         od.writeAttr(SUMO_ATTR_FOES, foes);
         if (!OptionsCont::getOptions().getBool("no-internal-links")) {
@@ -560,48 +566,42 @@ NBRequest::writeCrossingResponse(OutputDevice& od, const NBNode::Crossing& cross
 
 std::string
 NBRequest::getResponseString(int tlIndex, const NBEdge* const from, const NBEdge* const to,
-                             int fromLane, int toLane, bool mayDefinitelyPass, const bool checkLaneFoes) const {
+                             int fromLane, int toLane, bool mayDefinitelyPass, const bool checkLaneFoes,
+                             const std::vector<LinkConnection>& links) const {
     const bool lefthand = OptionsCont::getOptions().getBool("lefthand");
     int idx = 0;
     if (to != 0) {
         idx = getIndex(from, to);
     }
     std::string result;
+    result.reserve(myCrossings.size() + links.size());
     // crossings
     for (std::vector<NBNode::Crossing*>::const_reverse_iterator i = myCrossings.rbegin(); i != myCrossings.rend(); i++) {
         result += mustBrakeForCrossing(myJunction, from, to, **i) ? '1' : '0';
     }
     NBEdge::Connection queryCon = from->getConnection(fromLane, to, toLane);
     // normal connections
-    for (EdgeVector::const_reverse_iterator i = myIncoming.rbegin(); i != myIncoming.rend(); i++) {
-        //const std::vector<NBEdge::Connection> &allConnections = (*i)->getConnections();
-        int noLanes = (*i)->getNumLanes();
-        for (int j = noLanes; j-- > 0;) {
-            std::vector<NBEdge::Connection> connected = (*i)->getConnectionsFromLane(j);
-            int size = (int) connected.size();
-            for (int k = size; k-- > 0;) {
-                if (mayDefinitelyPass) {
-                    result += '0';
-                } else if ((*i) == from && fromLane == j) {
-                    // do not prohibit a connection by others from same lane
-                    result += '0';
-                } else {
-                    assert(k < (int) connected.size());
-                    assert(idx < (int)(myIncoming.size() * myOutgoing.size()));
-                    assert(connected[k].toEdge != 0);
-                    assert(getIndex(*i, connected[k].toEdge) < (int)(myIncoming.size() * myOutgoing.size()));
-                    // check whether the connection is prohibited by another one
-                    if ((myForbids[getIndex(*i, connected[k].toEdge)][idx] &&
-                            (!checkLaneFoes || laneConflict(from, to, toLane, *i, connected[k].toEdge, connected[k].toLane)))
-                            || NBNode::rightTurnConflict(from, to, fromLane, *i, connected[k].toEdge, connected[k].fromLane, lefthand)
-                            || mergeConflict(from, queryCon, *i, connected[k], false)
-                            || myJunction->rightOnRedConflict(tlIndex, connected[k].tlLinkIndex)
-                       ) {
-                        result += '1';
-                    } else {
-                        result += '0';
-                    }
-                }
+    for (std::vector<LinkConnection>::const_reverse_iterator i = links.rbegin(); i != links.rend(); ++i) {
+        const NBEdge::Connection& prohibitor = i->con;
+        if (mayDefinitelyPass) {
+            result += '0';
+        } else if (i->from == from && fromLane == prohibitor.fromLane) {
+            // do not prohibit a connection by others from same lane
+            result += '0';
+        } else {
+            assert(idx < (int)(myIncoming.size() * myOutgoing.size()));
+            assert(prohibitor.toEdge != 0);
+            assert(i->index < (int)(myIncoming.size() * myOutgoing.size()));
+            // check whether the connection is prohibited by another one
+            if ((myForbids[i->index][idx] &&
+                    (!checkLaneFoes || laneConflict(from, to, toLane, i->from, prohibitor.toEdge, prohibitor.toLane)))
+                    || NBNode::rightTurnConflict(from, to, fromLane, i->from, prohibitor.toEdge, prohibitor.fromLane, lefthand)
+                    || mergeConflict(from, queryCon, i->from, prohibitor, false)
+                    || myJunction->rightOnRedConflict(tlIndex, prohibitor.tlLinkIndex)
+               ) {
+                result += '1';
+            } else {
+                result += '0';
             }
         }
     }
@@ -610,13 +610,15 @@ NBRequest::getResponseString(int tlIndex, const NBEdge* const from, const NBEdge
 
 
 std::string
-NBRequest::getFoesString(NBEdge* from, NBEdge* to, int fromLane, int toLane, const bool checkLaneFoes) const {
+NBRequest::getFoesString(NBEdge* from, NBEdge* to, int fromLane, int toLane, const bool checkLaneFoes,
+                         const std::vector<LinkConnection>& links) const {
     const bool lefthand = OptionsCont::getOptions().getBool("lefthand");
     // remember the case when the lane is a "dead end" in the meaning that
     // vehicles must choose another lane to move over the following
     // junction
     // !!! move to forbidden
     std::string result;
+    result.reserve(myCrossings.size() + links.size());
     // crossings
     for (std::vector<NBNode::Crossing*>::const_reverse_iterator i = myCrossings.rbegin(); i != myCrossings.rend(); i++) {
         bool foes = false;
@@ -629,23 +631,18 @@ NBRequest::getFoesString(NBEdge* from, NBEdge* to, int fromLane, int toLane, con
         result += foes ? '1' : '0';
     }
     NBEdge::Connection queryCon = from->getConnection(fromLane, to, toLane);
+    const int idx = to == 0 ? -1 : getIndex(from, to);
     // normal connections
-    for (EdgeVector::const_reverse_iterator i = myIncoming.rbegin();
-            i != myIncoming.rend(); i++) {
-
-        for (int j = (int)(*i)->getNumLanes() - 1; j >= 0; --j) {
-            std::vector<NBEdge::Connection> connected = (*i)->getConnectionsFromLane(j);
-            int size = (int) connected.size();
-            for (int k = size; k-- > 0;) {
-                if ((foes(from, to, (*i), connected[k].toEdge) &&
-                        (!checkLaneFoes || laneConflict(from, to, toLane, *i, connected[k].toEdge, connected[k].toLane)))
-                        || NBNode::rightTurnConflict(from, to, fromLane, *i, connected[k].toEdge, connected[k].fromLane, lefthand)
-                        || mergeConflict(from, queryCon, *i, connected[k], true)) {
-                    result += '1';
-                } else {
-                    result += '0';
-                }
-            }
+    for (std::vector<LinkConnection>::const_reverse_iterator i = links.rbegin(); i != links.rend(); ++i) {
+        const NBEdge::Connection& prohibitor = i->con;
+        const bool linkFoes = idx >= 0 && i->index >= 0 && (myForbids[idx][i->index] || myForbids[i->index][idx]);
+        if ((linkFoes &&
+                (!checkLaneFoes || laneConflict(from, to, toLane, i->from, prohibitor.toEdge, prohibitor.toLane)))
+                || NBNode::rightTurnConflict(from, to, fromLane, i->from, prohibitor.toEdge, prohibitor.fromLane, lefthand)
+                || mergeConflict(from, queryCon, i->from, prohibitor, true)) {
+            result += '1';
+        } else {
+            result += '0';
         }
     }
     return result;
@@ -774,17 +771,18 @@ NBRequest::mustBrake(const NBEdge* const from, const NBEdge* const to, int fromL
         }
     }
     // maybe we need to brake due to a merge conflict
+    // (only connections from the same edge may merge, from is incoming since its index is known)
     NBEdge::Connection queryCon = from->getConnection(fromLane, to, toLane);
-    for (EdgeVector::const_reverse_iterator i = myIncoming.rbegin(); i != myIncoming.rend(); i++) {
-        int noLanes = (*i)->getNumLanes();
-        for (int j = noLanes; j-- > 0;) {
-            std::vector<NBEdge::Connection> connected = (*i)->getConnectionsFromLane(j);
-            const int size = (int) connected.size();
-            for (int k = size; k-- > 0;) {
-                if ((*i) == from && fromLane != j
-                        && mergeConflict(from, queryCon, *i, connected[k], myJunction->getType() == NODETYPE_ZIPPER)) {
-                    return true;
-                }
+    const int noLanes = from->getNumLanes();
+    for (int j = noLanes; j-- > 0;) {
+        if (j == fromLane) {
+            continue;
+        }
+        std::vector<NBEdge::Connection> connected = from->getConnectionsFromLane(j);
+        const int size = (int) connected.size();
+        for (int k = size; k-- > 0;) {
+            if (mergeConflict(from, queryCon, from, connected[k], myJunction->getType() == NODETYPE_ZIPPER)) {
+                return true;
             }
         }
     }
@@ -152,6 +152,24 @@ public:
 
 
 private:
+    /** @struct LinkConnection
+     * @brief A lane-to-lane connection of the junction together with the index of its edge-to-edge link
+     */
+    struct LinkConnection {
+        LinkConnection(const NBEdge* _from, const NBEdge::Connection& _con, int _index) :
+            from(_from), con(_con), index(_index) {}
+
+        /// @brief The incoming edge
+        const NBEdge* from;
+        /// @brief The connection
+        NBEdge::Connection con;
+        /// @brief The index of the link within myForbids and myDone (-1 if the link is not known)
+        int index;
+    };
+
+    /// @brief Returns the lane-to-lane connections in the order of their link indices within the junction logic
+    std::vector<LinkConnection> getLinkConnections() const;
+
     /** sets the information that the edge from1->to1 blocks the edge
         from2->to2 (is higher priorised than this) */
     void setBlocking(NBEdge* from1, NBEdge* to1, NBEdge* from2, NBEdge* to2);
@@ -159,7 +177,7 @@ private:
     /** @brief writes the response of a certain lane
         Returns the next link index within the junction */
     int writeLaneResponse(OutputDevice& od, NBEdge* from, int lane,
-                          int pos, const bool checkLaneFoes) const;
+                          int pos, const bool checkLaneFoes, const std::vector<LinkConnection>& links) const;
 
     /** @brief writes the response of a certain crossing
         Returns the next link index within the junction */
@@ -181,16 +199,19 @@ private:
      * @param[in] fromLane The link's starting lane
      * @param[in] toLane The link's destination lane
      * @param[in] mayDefinitelyPass Whether this link is definitely not disturbed
+     * @param[in] links All connections of the junction (see getLinkConnections)
      * @return the response string
      * @exception IOError not yet implemented
      */
     std::string getResponseString(int tlIndex, const NBEdge* const from, const NBEdge* const to,
-                                  int fromLane, int toLane, bool mayDefinitelyPass, const bool checkLaneFoes) const;
+                                  int fromLane, int toLane, bool mayDefinitelyPass, const bool checkLaneFoes,
+                                  const std::vector<LinkConnection>& links) const;
 
 
     /** writes which participating links are foes to the given */
     std::string getFoesString(NBEdge* from, NBEdge* to,
-                              int fromLane, int toLane, const bool checkLaneFoes) const;
+                              int fromLane, int toLane, const bool checkLaneFoes,
+                              const std::vector<LinkConnection>& links) const;
 
 
     /** @brief Returns the index to the internal combination container for the given edge combination
@@ -142,7 +142,10 @@ NBTrafficLightLogicCont::extract(NBTrafficLightDefinition* definition) {
 
 
 std::pair<int, int>
-NBTrafficLightLogicCont::computeLogics(OptionsCont& oc) {
+NBTrafficLightLogicCont::computeLogics(OptionsCont& oc, const std::set<NBNode*>* region) {
+    if (region != 0) {
+        return computeRegionLogics(oc, *region);
+    }
     // clean previous logics
     Logics logics = getComputed();
     for (Logics::iterator it = logics.begin(); it != logics.end(); it++) {
@@ -161,6 +164,43 @@ NBTrafficLightLogicCont::computeLogics(OptionsCont& oc) {
 }
 
 
+std::pair<int, int>
+NBTrafficLightLogicCont::computeRegionLogics(OptionsCont& oc, const std::set<NBNode*>& region) {
+    // clean logics of removed definitions
+    for (Id2Logics::iterator i = myComputed.begin(); i != myComputed.end();) {
+        for (Program2Logic::iterator j = i->second.begin(); j != i->second.end();) {
+            if (getDefinition(i->first, j->first) == 0) {
+                delete j->second;
+                i->second.erase(j++);
+            } else {
+                ++j;
+            }
+        }
+        if (i->second.empty()) {
+            myComputed.erase(i++);
+        } else {
+            ++i;
+        }
+    }
+    std::set<std::string> ids;
+    int numPrograms = 0;
+    Definitions definitions = getDefinitions();
+    for (Definitions::iterator it = definitions.begin(); it != definitions.end(); it++) {
+        const std::vector<NBNode*>& nodes = (*it)->getNodes();
+        for (std::vector<NBNode*>::const_iterator i = nodes.begin(); i != nodes.end(); ++i) {
+            if (region.count(*i) != 0) {
+                if (computeSingleLogic(oc, *it)) {
+                    ids.insert((*it)->getID());
+                    numPrograms++;
+                }
+                break;
+            }
+        }
+    }
+    return std::pair<int, int>((int)ids.size(), numPrograms);
+}
+
+
 bool
 NBTrafficLightLogicCont::computeSingleLogic(OptionsCont& oc, NBTrafficLightDefinition* def) {
     if (def->getNodes().size() == 0) {
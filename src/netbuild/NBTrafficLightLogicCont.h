@@ -135,11 +135,15 @@ public:
      * Goes through all stored definitions and calls "NBTrafficLightDefinition::compute"
      *  for each. Stores the result using "insert".
      *
+     * If a region is given, only the definitions controlling one of its nodes
+     *  are recomputed while the other computed logics are kept.
+     *
      * @param[in] oc Options used during the computation
+     * @param[in] region If given, the nodes whose traffic lights shall be recomputed
      * @return The number of computed tls and programs
      * @see NBTrafficLightDefinition::compute
      */
-    std::pair<int, int> computeLogics(OptionsCont& oc);
+    std::pair<int, int> computeLogics(OptionsCont& oc, const std::set<NBNode*>* region = 0);
 
 
     /** @brief Computes a specific traffic light logic (using by NETEDIT)
@@ -242,6 +246,16 @@ private:
     /// @brief Returns a list of all definitions (convenience for easier iteration)
     Definitions getDefinitions() const;
 
+    /** @brief Recomputes the logics of the definitions controlling one of the given nodes
+     *
+     * Logics of definitions which do not exist anymore are deleted.
+     *
+     * @param[in] oc Options used during the computation
+     * @param[in] region The nodes whose traffic lights shall be recomputed
+     * @return The number of recomputed tls and programs
+     */
+    std::pair<int, int> computeRegionLogics(OptionsCont& oc, const std::set<NBNode*>& region);
+
     /** @brief Destroys all stored definitions and logics
      */
     void clear();
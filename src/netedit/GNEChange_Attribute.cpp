@@ -33,6 +33,7 @@
 #include "GNENet.h"
 #include "GNEViewNet.h"
 #include "GNEAdditional.h"
+#include "GNENetElement.h"
 #include "GNEShape.h"
 
 // ===========================================================================
@@ -53,11 +54,13 @@ GNEChange_Attribute::GNEChange_Attribute(GNEAttributeCarrier* ac,
     myOrigValue(customOrigValue ? origValue : ac->getAttribute(key)),
     myNewValue(value),
     myAdditional(NULL),
-    myShape(NULL) {
+    myShape(NULL),
+    myNetElement(NULL) {
     myAC->incRef("GNEChange_Attribute " + toString(myKey));
-    // try to cast AC as additional and Shape
+    // try to cast AC as additional, Shape and network element
     myAdditional = dynamic_cast<GNEAdditional*>(myAC);
     myShape = dynamic_cast<GNEShape*>(myAC);
+    myNetElement = dynamic_cast<GNENetElement*>(myAC);
 }
 
 
@@ -90,6 +93,10 @@ GNEChange_Attribute::undo() {
     if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
         WRITE_WARNING("Setting previous attribute " + toString(myKey) + " '" + myOrigValue + "' into " + toString(myAC->getTag()) + " '" + myAC->getID() + "'");
     }
+    // mark the affected junctions before the change as well (e.g. the old endpoints of an edge)
+    if (myNetElement) {
+        myNetElement->getNet()->markChanged(myNetElement);
+    }
     // set original value
     myAC->setAttribute(myKey, myOrigValue);
     // check if additional or shapes has to be saved
@@ -97,6 +104,8 @@ GNEChange_Attribute::undo() {
         myAdditional->getViewNet()->getNet()->requiereSaveAdditionals();
     } else if (myShape) {
         myShape->getNet()->requiereSaveShapes();
+    } else if (myNetElement) {
+        myNetElement->getNet()->markChanged(myNetElement);
     }
 }
 
@@ -107,6 +116,10 @@ GNEChange_Attribute::redo() {
     if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
         WRITE_WARNING("Setting new attribute " + toString(myKey) + " '" + myNewValue + "' into " + toString(myAC->getTag()) + " '" + myAC->getID() + "'");
     }
+    // mark the affected junctions before the change as well (e.g. the old endpoints of an edge)
+    if (myNetElement) {
+        myNetElement->getNet()->markChanged(myNetElement);
+    }
     // set new value
     myAC->setAttribute(myKey, myNewValue);
     // check if additional or shapes has to be saved
@@ -114,6 +127,8 @@ GNEChange_Attribute::redo() {
         myAdditional->getViewNet()->getNet()->requiereSaveAdditionals();
     } else if (myShape) {
         myShape->getNet()->requiereSaveShapes();
+    } else if (myNetElement) {
+        myNetElement->getNet()->markChanged(myNetElement);
     }
 }
 
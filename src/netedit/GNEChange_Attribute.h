@@ -37,6 +37,7 @@
 // ===========================================================================
 class GNEAttributeCarrier;
 class GNEAdditional;
+class GNENetElement;
 class GNEShape;
 
 // ===========================================================================
@@ -104,6 +105,9 @@ private:
 
     /// @brief used if Ac is a shape element
     GNEShape* myShape;
+
+    /// @brief used if Ac is a network element
+    GNENetElement* myNetElement;
 };
 
 #endif
@@ -60,6 +60,7 @@ GNEChange_Connection::~GNEChange_Connection() {
 
 void
 GNEChange_Connection::undo() {
+    myNet->markChanged(myEdge);
     if (myForward) {
         // show extra information for tests
         if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
@@ -85,6 +86,7 @@ GNEChange_Connection::undo() {
 
 void
 GNEChange_Connection::redo() {
+    myNet->markChanged(myEdge);
     if (myForward) {
         // show extra information for tests
         if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
@@ -66,6 +66,7 @@ GNEChange_Crossing::~GNEChange_Crossing() {
 
 
 void GNEChange_Crossing::undo() {
+    myNet->markChanged(myJunctionParent);
     if (myForward) {
         // show extra information for tests
         if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
@@ -121,6 +122,7 @@ void GNEChange_Crossing::undo() {
 
 
 void GNEChange_Crossing::redo() {
+    myNet->markChanged(myJunctionParent);
     if (myForward) {
         // show extra information for tests
         if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
@@ -68,6 +68,7 @@ GNEChange_Edge::~GNEChange_Edge() {
 
 void
 GNEChange_Edge::undo() {
+    myNet->markChanged(myEdge);
     if (myForward) {
         // show extra information for tests
         if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
@@ -88,6 +89,7 @@ GNEChange_Edge::undo() {
 
 void
 GNEChange_Edge::redo() {
+    myNet->markChanged(myEdge);
     if (myForward) {
         // show extra information for tests
         if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
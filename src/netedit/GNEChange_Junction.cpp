@@ -66,6 +66,7 @@ GNEChange_Junction::~GNEChange_Junction() {
 
 void
 GNEChange_Junction::undo() {
+    myNet->markChanged(myJunction);
     if (myForward) {
         // show extra information for tests
         if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
@@ -86,6 +87,7 @@ GNEChange_Junction::undo() {
 
 void
 GNEChange_Junction::redo() {
+    myNet->markChanged(myJunction);
     if (myForward) {
         // show extra information for tests
         if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
@@ -91,6 +91,7 @@ GNEChange_Lane::~GNEChange_Lane() {
 
 void
 GNEChange_Lane::undo() {
+    myNet->markChanged(myEdge);
     if (myForward) {
         // show extra information for tests
         if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
@@ -136,6 +137,7 @@ GNEChange_Lane::undo() {
 
 void
 GNEChange_Lane::redo() {
+    myNet->markChanged(myEdge);
     if (myForward) {
         // show extra information for tests
         if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
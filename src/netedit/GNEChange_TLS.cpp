@@ -78,6 +78,7 @@ GNEChange_TLS::~GNEChange_TLS() {
 
 void
 GNEChange_TLS::undo() {
+    myNet->markChanged(myJunction);
     if (myForward) {
         // show extra information for tests
         if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
@@ -98,6 +99,7 @@ GNEChange_TLS::undo() {
 
 void
 GNEChange_TLS::redo() {
+    myNet->markChanged(myJunction);
     if (myForward) {
         // show extra information for tests
         if (OptionsCont::getOptions().getBool("gui-testing-debug")) {
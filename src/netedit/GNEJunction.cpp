@@ -515,6 +515,7 @@ void
 GNEJunction::invalidateShape() {
     if (!myNBNode.hasCustomShape()) {
         myNBNode.myPoly.clear();
+        myNet->markChanged(this);
         myNet->requireRecompute();
     }
 }
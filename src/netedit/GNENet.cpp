@@ -122,6 +122,7 @@ GNENet::GNENet(NBNetBuilder* netBuilder) :
     myEdgeIDSupplier("gneE", netBuilder->getEdgeCont().getAllNames()),
     myJunctionIDSupplier("gneJ", netBuilder->getNodeCont().getAllNames()),
     myNeedRecompute(true),
+    myNeedFullRecompute(true),
     myAdditionalsSaved(true),
     myShapesSaved(true),
     myTLSProgramsSaved(true) {
@@ -1271,6 +1272,8 @@ void
 GNENet::computeEverything(GNEApplicationWindow* window, bool force, bool volatileOptions, std::string additionalPath, std::string shapePath) {
     if (!myNeedRecompute) {
         if (force) {
+            // the user asks for a recomputation although nothing changed
+            myNeedFullRecompute = true;
             if (volatileOptions) {
                 window->setStatusBarText("Forced computing junctions with volatile options ...");
             } else {
@@ -1346,6 +1349,28 @@ GNENet::requireRecompute() {
 }
 
 
+void
+GNENet::markChanged(GNENetElement* element) {
+    NBNodeCont& nc = myNetBuilder->getNodeCont();
+    GNEJunction* junction = dynamic_cast<GNEJunction*>(element);
+    GNEEdge* edge = dynamic_cast<GNEEdge*>(element);
+    if (dynamic_cast<GNELane*>(element) != 0) {
+        edge = &dynamic_cast<GNELane*>(element)->getParentEdge();
+    } else if (dynamic_cast<GNEConnection*>(element) != 0) {
+        edge = dynamic_cast<GNEConnection*>(element)->getEdgeFrom();
+    } else if (dynamic_cast<GNECrossing*>(element) != 0) {
+        junction = dynamic_cast<GNECrossing*>(element)->getParentJunction();
+    }
+    if (junction != 0) {
+        nc.markAsChanged(junction->getNBNode());
+    }
+    if (edge != 0) {
+        nc.markAsChanged(edge->getNBEdge()->getFromNode());
+        nc.markAsChanged(edge->getNBEdge()->getToNode());
+    }
+}
+
+
 bool
 GNENet::netHasGNECrossings() const {
     for (auto n : myJunctions) {
@@ -1633,6 +1658,12 @@ void
 GNENet::changeEdgeEndpoints(GNEEdge* edge, const std::string& newSource, const std::string& newDest) {
     NBNode* from = retrieveJunction(newSource)->getNBNode();
     NBNode* to = retrieveJunction(newDest)->getNBNode();
+    // the old and the new endpoints need to be recomputed
+    NBNodeCont& nc = myNetBuilder->getNodeCont();
+    nc.markAsChanged(edge->getNBEdge()->getFromNode());
+    nc.markAsChanged(edge->getNBEdge()->getToNode());
+    nc.markAsChanged(from);
+    nc.markAsChanged(to);
     edge->getNBEdge()->reinitNodes(from, to);
     requireRecompute();
     update();
@@ -2334,7 +2365,8 @@ GNENet::computeAndUpdate(OptionsCont& oc, bool volatileOptions) {
         }
     }
 
-    myNetBuilder->compute(oc, liveExplicitTurnarounds, volatileOptions);
+    // volatile options may add or remove elements so they always need a full computation
+    myNetBuilder->compute(oc, liveExplicitTurnarounds, volatileOptions, !volatileOptions && !myNeedFullRecompute);
     // update ids if necessary
     if (oc.getBool("numerical-ids") || oc.isSet("reserved-ids")) {
         std::map<std::string, GNEEdge*> newEdgeMap;
@@ -2415,6 +2447,7 @@ GNENet::computeAndUpdate(OptionsCont& oc, bool volatileOptions) {
     }
 
     myNeedRecompute = false;
+    myNeedFullRecompute = false;
 }
 
 
@@ -521,6 +521,13 @@ public:
     /// @brief inform the net about the need for recomputation
     void requireRecompute();
 
+    /** @brief marks the junctions affected by a change of the given element for the next recomputation
+     *
+     * As long as all modifications since the last computation are marked (they pass
+     *  through the undo list), only the surroundings of the marked junctions are recomputed.
+     */
+    void markChanged(GNENetElement* element);
+
     /// @brief check if net has GNECrossings
     bool netHasGNECrossings() const;
 
@@ -704,6 +711,9 @@ protected:
     /// @brief whether the net needs recomputation
     bool myNeedRecompute;
 
+    /// @brief whether the next recomputation must not be restricted to the marked junctions
+    bool myNeedFullRecompute;
+
     /// @brief Flag to check if additionals has to be saved
     bool myAdditionalsSaved;
 
@@ -272,6 +272,9 @@ NIFrame::fillOptions() {
     oc.doRegister("osm.all-attributes", new Option_Bool(false));
     oc.addDescription("osm.all-attributes", "Processing", "Whether additional attributes shall be imported");
 
+    oc.doRegister("osm.lean-nodes", new Option_Bool(false));
+    oc.addDescription("osm.lean-nodes", "Processing", "Parses the ways first and keeps only the nodes used by roads, platforms and relations");
+
     // register opendrive options
     oc.doRegister("opendrive.import-all-lanes", new Option_Bool(false));
     oc.addDescription("opendrive.import-all-lanes", "Processing", "Imports all lane types");
@@ -45,6 +45,7 @@
 #include <netbuild/NBNode.h>
 #include <netbuild/NBNodeCont.h>
 #include <netbuild/NBNetBuilder.h>
+#include <netbuild/NBHeightMapper.h>
 #include <netbuild/NBOwnTLDef.h>
 #include <utils/xml/SUMOXMLDefinitions.h>
 #include <utils/geom/GeoConvHelper.h>
@@ -133,16 +134,33 @@ NIImporter_OpenStreetMap::load(const OptionsCont& oc, NBNetBuilder& nb) {
         return;
     }
     /* Parse file(s)
-     * Each file is parsed twice: first for nodes, second for edges. */
+     * Each file is parsed twice: first for nodes, second for edges.
+     * If only the referenced nodes shall be kept, the edges are parsed first. */
     std::vector<std::string> files = oc.getStringVector("osm-files");
-    // load nodes, first
-    NodesHandler nodesHandler(myOSMNodes, myUniqueNodes, oc);
     for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
-        // nodes
         if (!FileHelpers::isReadable(*file)) {
             WRITE_ERROR("Could not open osm-file '" + *file + "'.");
             return;
         }
+    }
+    const bool leanNodes = oc.getBool("osm.lean-nodes");
+    std::vector<long long int> referencedNodes;
+    if (leanNodes) {
+        parseEdges(files, &referencedNodes);
+        // the sorted ids of all nodes used by kept ways and by relations
+        for (const auto& item : myEdges) {
+            referencedNodes.insert(referencedNodes.end(), item.second->myCurrentNodes.begin(), item.second->myCurrentNodes.end());
+        }
+        for (const auto& item : myPlatformShapes) {
+            referencedNodes.insert(referencedNodes.end(), item.second->myCurrentNodes.begin(), item.second->myCurrentNodes.end());
+        }
+        std::sort(referencedNodes.begin(), referencedNodes.end());
+        referencedNodes.erase(std::unique(referencedNodes.begin(), referencedNodes.end()), referencedNodes.end());
+        referencedNodes.shrink_to_fit();
+    }
+    // load nodes
+    NodesHandler nodesHandler(myOSMNodes, myUniqueNodes, oc, leanNodes ? &referencedNodes : nullptr);
+    for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
         nodesHandler.setFileName(*file);
         PROGRESS_BEGIN_MESSAGE("Parsing nodes from osm-file '" + *file + "'");
         if (!XMLSubSys::runParser(nodesHandler, *file)) {
@@ -150,14 +168,12 @@ NIImporter_OpenStreetMap::load(const OptionsCont& oc, NBNetBuilder& nb) {
         }
         PROGRESS_DONE_MESSAGE();
     }
-    // load edges, then
-    EdgesHandler edgesHandler(myOSMNodes, myEdges, myPlatformShapes);
-    for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
-        // edges
-        edgesHandler.setFileName(*file);
-        PROGRESS_BEGIN_MESSAGE("Parsing edges from osm-file '" + *file + "'");
-        XMLSubSys::runParser(edgesHandler, *file);
-        PROGRESS_DONE_MESSAGE();
+    if (leanNodes) {
+        std::vector<long long int>().swap(referencedNodes);
+        resolveNodeReferences(myEdges);
+        resolveNodeReferences(myPlatformShapes);
+    } else {
+        parseEdges(files, nullptr);
     }
 
     /* Remove duplicate edges with the same shape and attributes */
@@ -207,6 +223,12 @@ NIImporter_OpenStreetMap::load(const OptionsCont& oc, NBNetBuilder& nb) {
         }
     }
 
+    /* Transform the node coordinates in advance (in parallel if option "threads" is set)
+     * unless they are needed in the original system for height data or segment splitting */
+    if (!NBHeightMapper::get().ready() && oc.getFloat("geometry.max-segment-length") <= 0) {
+        transformNodeCoordinates(oc.exists("threads") ? oc.getInt("threads") : 0);
+    }
+
     /* Instantiate edges
      * Only those nodes in the middle of an edge which are used by more than
      * one edge are instantiated. Other nodes are considered as geometry nodes. */
@@ -266,13 +288,75 @@ NIImporter_OpenStreetMap::load(const OptionsCont& oc, NBNetBuilder& nb) {
     }
 }
 
+void
+NIImporter_OpenStreetMap::parseEdges(const std::vector<std::string>& files, std::vector<long long int>* referencedNodes) {
+    EdgesHandler edgesHandler(myOSMNodes, myEdges, myPlatformShapes, referencedNodes);
+    for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file) {
+        edgesHandler.setFileName(*file);
+        PROGRESS_BEGIN_MESSAGE("Parsing edges from osm-file '" + *file + "'");
+        XMLSubSys::runParser(edgesHandler, *file);
+        PROGRESS_DONE_MESSAGE();
+    }
+}
+
+
+void
+NIImporter_OpenStreetMap::transformNodeCoordinates(int numThreads) {
+    std::vector<NIOSMNode*> nodes;
+    PositionVector positions;
+    for (const auto& item : myEdges) {
+        const std::vector<long long int>& edgeNodes = item.second->myCurrentNodes;
+        if (edgeNodes.size() < 2) {
+            continue;
+        }
+        for (long long int id : edgeNodes) {
+            NIOSMNode* n = myOSMNodes.find(id)->second;
+            if (n->cartesian == Position::INVALID) {
+                // marks the node as collected
+                n->cartesian = Position(n->lon, n->lat, n->ele);
+                nodes.push_back(n);
+                positions.push_back(n->cartesian);
+            }
+        }
+    }
+    const bool ok = NBNetBuilder::transformCoordinatesParallel(positions, true, numThreads);
+    for (int i = 0; i < (int)nodes.size(); i++) {
+        nodes[i]->cartesian = ok ? positions[i] : Position::INVALID;
+    }
+}
+
+
+void
+NIImporter_OpenStreetMap::resolveNodeReferences(std::map<long long int, Edge*>& ways) {
+    for (const auto& item : ways) {
+        std::vector<long long int>& nodes = item.second->myCurrentNodes;
+        std::vector<long long int> resolved;
+        resolved.reserve(nodes.size());
+        for (long long int ref : nodes) {
+            auto node = myOSMNodes.find(ref);
+            if (node == myOSMNodes.end()) {
+                WRITE_WARNING("The referenced geometry information (ref='" + toString(ref) + "') is not known");
+                continue;
+            }
+            ref = node->second->id; // node may have been substituted
+            if (resolved.empty() || resolved.back() != ref) { // avoid consecutive duplicates
+                resolved.push_back(ref);
+            }
+        }
+        nodes.swap(resolved);
+    }
+}
+
+
 NBNode*
 NIImporter_OpenStreetMap::insertNodeChecking(long long int id, NBNodeCont& nc, NBTrafficLightLogicCont& tlsc) {
     NBNode* node = nc.retrieve(toString(id));
     if (node == 0) {
         NIOSMNode* n = myOSMNodes.find(id)->second;
         Position pos(n->lon, n->lat, n->ele);
-        if (!NBNetBuilder::transformCoordinate(pos, true)) {
+        if (n->cartesian != Position::INVALID) {
+            pos = n->cartesian;
+        } else if (!NBNetBuilder::transformCoordinate(pos, true)) {
             WRITE_ERROR("Unable to project coordinates for junction '" + toString(id) + "'.");
             return 0;
         }
@@ -340,6 +424,8 @@ NIImporter_OpenStreetMap::insertEdge(Edge* e, int index, NBNode* from, NBNode* t
 
     // convert the shape
     PositionVector shape;
+    PositionVector cartesian;
+    bool transformed = true;
     for (long long i : passed) {
         NIOSMNode* n = myOSMNodes.find(i)->second;
 
@@ -349,7 +435,9 @@ NIImporter_OpenStreetMap::insertEdge(Edge* e, int index, NBNode* from, NBNode* t
                 existingPtStop->registerAdditionalEdge(toString(e->id), id);
             } else {
                 Position ptPos(n->lon, n->lat, n->ele);
-                if (!NBNetBuilder::transformCoordinate(ptPos)) {
+                if (n->cartesian != Position::INVALID) {
+                    ptPos = n->cartesian;
+                } else if (!NBNetBuilder::transformCoordinate(ptPos)) {
                     WRITE_ERROR("Unable to project coordinates for node '" + toString(n->id) + "'.");
                 }
                 NBPTStop* ptStop = new NBPTStop(toString(n->id), ptPos, id, toString(e->id), n->ptStopLength, n->name,
@@ -360,8 +448,12 @@ NIImporter_OpenStreetMap::insertEdge(Edge* e, int index, NBNode* from, NBNode* t
         }
         Position pos(n->lon, n->lat, n->ele);
         shape.push_back(pos);
+        cartesian.push_back(n->cartesian);
+        transformed &= n->cartesian != Position::INVALID;
     }
-    if (!NBNetBuilder::transformCoordinates(shape)) {
+    if (transformed) {
+        shape = cartesian;
+    } else if (!NBNetBuilder::transformCoordinates(shape)) {
         WRITE_ERROR("Unable to project coordinates for edge '" + id + "'.");
     }
 //    shape.in
@@ -633,7 +725,8 @@ NIImporter_OpenStreetMap::insertEdge(Edge* e, int index, NBNode* from, NBNode* t
 // ---------------------------------------------------------------------------
 NIImporter_OpenStreetMap::NodesHandler::NodesHandler(std::map<long long int, NIOSMNode*>& toFill,
         std::set<NIOSMNode*, CompareNodes>& uniqueNodes,
-        const OptionsCont& oc)
+        const OptionsCont& oc,
+        const std::vector<long long int>* referencedNodes)
 
     :
     SUMOSAXHandler("osm - file"),
@@ -643,7 +736,8 @@ NIImporter_OpenStreetMap::NodesHandler::NodesHandler(std::map<long long int, NIO
     myHierarchyLevel(0),
     myUniqueNodes(uniqueNodes),
     myImportElevation(oc.getBool("osm.elevation")),
-    myOptionsCont(oc) {
+    myOptionsCont(oc),
+    myReferencedNodes(referencedNodes) {
 }
 
 NIImporter_OpenStreetMap::NodesHandler::~NodesHandler() = default;
@@ -667,6 +761,10 @@ NIImporter_OpenStreetMap::NodesHandler::myStartElement(int element, const SUMOSA
             return;
         }
         myLastNodeID = -1;
+        if (myReferencedNodes != nullptr && !std::binary_search(myReferencedNodes->begin(), myReferencedNodes->end(), id)) {
+            // neither used by a kept way nor by a relation
+            return;
+        }
         if (myToFill.find(id) == myToFill.end()) {
             myLastNodeID = id;
             // assume we are loading multiple files...
@@ -769,12 +867,14 @@ NIImporter_OpenStreetMap::NodesHandler::myEndElement(int element) {
 // ---------------------------------------------------------------------------
 NIImporter_OpenStreetMap::EdgesHandler::EdgesHandler(
     const std::map<long long int, NIOSMNode*>& osmNodes,
-    std::map<long long int, Edge*>& toFill, std::map<long long int, Edge*>& platformShapes)
+    std::map<long long int, Edge*>& toFill, std::map<long long int, Edge*>& platformShapes,
+    std::vector<long long int>* referencedNodes)
     :
     SUMOSAXHandler("osm - file"),
     myOSMNodes(osmNodes),
     myEdgeMap(toFill),
-    myPlatformShapesMap(platformShapes) {
+    myPlatformShapesMap(platformShapes),
+    myReferencedNodes(referencedNodes) {
     mySpeedMap["signals"] = MAXSPEED_UNGIVEN;
     mySpeedMap["none"] = 300.;
     mySpeedMap["no"] = 300.;
@@ -802,18 +902,28 @@ NIImporter_OpenStreetMap::EdgesHandler::myStartElement(int element,
         }
         myCurrentEdge = new Edge(id);
     }
+    // collect nodes which are members of relations if the nodes are not parsed yet
+    if (element == SUMO_TAG_MEMBER && myReferencedNodes != nullptr) {
+        bool ok = true;
+        const long long int ref = attrs.get<long long int>(SUMO_ATTR_REF, nullptr, ok);
+        if (ok && attrs.getStringSecure(SUMO_ATTR_TYPE, "") == "node") {
+            myReferencedNodes->push_back(ref);
+        }
+    }
     // parse "nd" (node) elements
     if (element == SUMO_TAG_ND && myCurrentEdge != 0) {
         bool ok = true;
         long long int ref = attrs.get<long long int>(SUMO_ATTR_REF, 0, ok);
         if (ok) {
-            auto node = myOSMNodes.find(ref);
-            if (node == myOSMNodes.end()) {
-                WRITE_WARNING("The referenced geometry information (ref='" + toString(ref) + "') is not known");
-                return;
+            if (myReferencedNodes == nullptr) {
+                auto node = myOSMNodes.find(ref);
+                if (node == myOSMNodes.end()) {
+                    WRITE_WARNING("The referenced geometry information (ref='" + toString(ref) + "') is not known");
+                    return;
+                }
+                ref = node->second->id; // node may have been substituted
             }
-
-            ref = node->second->id; // node may have been substituted
+            // otherwise the nodes are not parsed yet, see resolveNodeReferences
             if (myCurrentEdge->myCurrentNodes.empty() ||
                     myCurrentEdge->myCurrentNodes.back() != ref) { // avoid consecutive duplicates
                 myCurrentEdge->myCurrentNodes.push_back(ref);
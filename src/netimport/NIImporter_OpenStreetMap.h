@@ -85,7 +85,7 @@ protected:
             id(_id), lon(_lon), lat(_lat), ele(0), tlsControlled(false), railwayCrossing(false),
             ptStopPosition(false), ptStopLength(0), name(""),
             permissions(SVC_RAIL | SVC_BUS | SVC_TRAM),
-            node(0) { }
+            node(0), cartesian(Position::INVALID) { }
 
         /// @brief The node's id
         const long long int id;
@@ -109,6 +109,8 @@ protected:
         SVCPermissions permissions;
         /// @brief the NBNode that was instantiated
         NBNode* node;
+        /// @brief The transformed position (Position::INVALID if not transformed in advance)
+        Position cartesian;
 
     private:
         /// invalidated assignment operator
@@ -268,6 +270,32 @@ private:
     int insertEdge(Edge* e, int index, NBNode* from, NBNode* to,
                    const std::vector<long long int>& passed, NBNetBuilder& nb);
 
+    /** @brief Parses the ways of the given files
+     *
+     * @param[in] files The osm-files to parse
+     * @param[in, out] referencedNodes The container to fill with relation member nodes (0 if the nodes are already known)
+     */
+    void parseEdges(const std::vector<std::string>& files, std::vector<long long int>* referencedNodes);
+
+
+    /** @brief Replaces the node references of the given ways by the (possibly substituted) loaded nodes
+     *
+     * Used if the ways are parsed before the nodes (osm.lean-nodes), unknown nodes are
+     *  removed from the ways with a warning.
+     * @param[in, out] ways The ways to update
+     */
+    void resolveNodeReferences(std::map<long long int, Edge*>& ways);
+
+
+    /** @brief Transforms the coordinates of all nodes used by the edges at once
+     *
+     * The nodes are transformed in the order they are used when building the edges
+     *  since the first one initialises the projection. If any node cannot be
+     *  transformed, all are transformed again when they are used (reporting the failure).
+     * @param[in] numThreads The number of threads to use
+     */
+    void transformNodeCoordinates(int numThreads);
+
     /// @brief reconstruct elevation from layer info
     void reconstructLayerElevation(double layerElevation, NBNetBuilder& nb);
 
@@ -290,10 +318,12 @@ protected:
          * @param[in, out] toFill The nodes container to fill
          * @param[in, out] uniqueNodes The nodes container for ensuring uniqueness
          * @param[in] options The options to use
+         * @param[in] referencedNodes The sorted ids of the nodes to load (all nodes are loaded if 0)
          */
         NodesHandler(std::map<long long int, NIOSMNode*>& toFill, std::set<NIOSMNode*,
                      CompareNodes>& uniqueNodes,
-                     const OptionsCont& cont);
+                     const OptionsCont& cont,
+                     const std::vector<long long int>* referencedNodes = nullptr);
 
 
         /// @brief Destructor
@@ -347,6 +377,9 @@ protected:
         /// @brief the options
         const OptionsCont& myOptionsCont;
 
+        /// @brief the sorted ids of the nodes to load, 0 if all nodes are loaded
+        const std::vector<long long int>* const myReferencedNodes;
+
 
     private:
         /** @brief invalidated copy constructor */
@@ -365,12 +398,19 @@ protected:
     class EdgesHandler : public SUMOSAXHandler {
     public:
         /** @brief Constructor
+         *
+         * If the referenced nodes are given, the ways are parsed before the nodes.
+         *  The node references are kept unresolved then and the nodes which are
+         *  members of relations are collected.
          *
          * @param[in] osmNodes The previously parsed (osm-)nodes
          * @param[in, out] toFill The edges container to fill with read edges
+         * @param[in, out] platformShapes The container to fill with read platform shapes
+         * @param[in, out] referencedNodes The container to fill with relation member nodes (0 if the nodes are already known)
          */
         EdgesHandler(const std::map<long long int, NIOSMNode*>& osmNodes,
-                     std::map<long long int, Edge*>& toFill, std::map<long long int, Edge*>& platformShapes);
+                     std::map<long long int, Edge*>& toFill, std::map<long long int, Edge*>& platformShapes,
+                     std::vector<long long int>* referencedNodes = nullptr);
 
 
         /// @brief Destructor
@@ -420,6 +460,9 @@ protected:
         /// @brief A map of non-numeric speed descriptions to their numeric values
         std::map<std::string, double> mySpeedMap;
 
+        /// @brief The ids of the nodes which are members of relations, 0 if the nodes are already known
+        std::vector<long long int>* const myReferencedNodes;
+
     private:
         /** @brief invalidated copy constructor */
         EdgesHandler(const EdgesHandler& s);
@@ -46,6 +46,7 @@
 #include <utils/xml/SUMORouteLoaderControl.h>
 #include <utils/xml/SUMORouteLoader.h>
 #include <utils/xml/XMLSubSys.h>
+#include <utils/xml/SUMOSAXReader.h>
 #include <mesosim/MEVehicleControl.h>
 #include <microsim/MSVehicleControl.h>
 #include <microsim/MSVehicleTransfer.h>
@@ -100,6 +101,30 @@ NLBuilder::EdgeFloatTimeLineRetriever_EdgeTravelTime::addEdgeWeight(const std::s
 }
 
 
+// ---------------------------------------------------------------------------
+// NLBuilder::RegionHandler - methods
+// ---------------------------------------------------------------------------
+void
+NLBuilder::RegionHandler::myStartElement(int element, const SUMOSAXAttributes& attrs) {
+    if (element == SUMO_TAG_NET) {
+        mySeenNet = true;
+        myHaveVersion = attrs.hasAttribute(SUMO_ATTR_VERSION);
+    } else if (element == SUMO_TAG_JUNCTION) {
+        // errors are reported when the network is loaded
+        bool ok = true;
+        const std::string id = attrs.get<std::string>(SUMO_ATTR_ID, 0, ok, false);
+        // internal junctions are loaded together with their junction
+        if (ok && id[0] != ':') {
+            const double x = attrs.get<double>(SUMO_ATTR_X, id.c_str(), ok, false);
+            const double y = attrs.get<double>(SUMO_ATTR_Y, id.c_str(), ok, false);
+            if (ok) {
+                myJunctions[id] = myBoundary.around(Position(x, y));
+            }
+        }
+    }
+}
+
+
 // ---------------------------------------------------------------------------
 // NLBuilder - methods
 // ---------------------------------------------------------------------------
@@ -120,9 +145,15 @@ NLBuilder::~NLBuilder() {}
 bool
 NLBuilder::build() {
     // try to build the net
+    if (myOptions.isSet("net-file.boundary") && !loadRegion()) {
+        return false;
+    }
     if (!load("net-file", true)) {
         return false;
     }
+    if (myOptions.isSet("net-file.boundary") && !myXMLHandler.haveRegionJunctions()) {
+        WRITE_WARNING("No junctions within the boundary '" + myOptions.getString("net-file.boundary") + "'.");
+    }
     // check whether the loaded net agrees with the simulation options
     if (myOptions.getBool("no-internal-links") && myXMLHandler.haveSeenInternalEdge()) {
         WRITE_WARNING("Network contains internal links but option --no-internal-links is set. Vehicles will 'jump' across junctions and thus underestimate route lengths and travel times.");
@@ -227,7 +258,7 @@ NLBuilder::init() {
         SystemFrame::close();
         return nullptr;
     }
-    XMLSubSys::setValidation(oc.getString("xml-validation"), oc.getString("xml-validation.net"));
+    XMLSubSys::setValidation(oc.getString("xml-validation"), oc.getString("xml-validation.net"), oc.getString("xml-parser"));
     if (!MSFrame::checkOptions()) {
         throw ProcessError();
     }
@@ -337,6 +368,55 @@ NLBuilder::load(const std::string& mmlWhat, const bool isNet) {
 }
 
 
+bool
+NLBuilder::loadRegion() {
+    if (!myOptions.isUsableFileList("net-file")) {
+        return false;
+    }
+    const std::vector<std::string> values = myOptions.getStringVector("net-file.boundary");
+    Boundary boundary;
+    try {
+        boundary.add(TplConvert::_2double(values[0].c_str()), TplConvert::_2double(values[1].c_str()));
+        boundary.add(TplConvert::_2double(values[2].c_str()), TplConvert::_2double(values[3].c_str()));
+    } catch (NumberFormatException&) {
+        WRITE_ERROR("Invalid boundary '" + myOptions.getString("net-file.boundary") + "' for the network to load.");
+        return false;
+    } catch (EmptyData&) {
+        WRITE_ERROR("Invalid boundary '" + myOptions.getString("net-file.boundary") + "' for the network to load.");
+        return false;
+    }
+    const std::vector<std::string> files = myOptions.getStringVector("net-file");
+    bool haveVersion = true;
+    for (std::vector<std::string>::const_iterator fileIt = files.begin(); fileIt != files.end() && haveVersion; ++fileIt) {
+        // only read the root element
+        RegionHandler header(boundary);
+        header.setFileName(*fileIt);
+        SUMOSAXReader* parser = XMLSubSys::getSAXReader(header);
+        if (parser->parseFirst(*fileIt)) {
+            while (!header.hasSeenNet() && parser->parseNext());
+        }
+        haveVersion = !header.hasSeenNet() || header.hasVersion();
+        delete parser;
+    }
+    if (haveVersion) {
+        // the junctions are located while loading the network
+        myXMLHandler.setRegion(boundary, std::map<std::string, bool>());
+        return true;
+    }
+    RegionHandler handler(boundary);
+    for (std::vector<std::string>::const_iterator fileIt = files.begin(); fileIt != files.end(); ++fileIt) {
+        PROGRESS_BEGIN_MESSAGE("Determining the junctions to load from '" + *fileIt + "'");
+        long before = SysUtils::getCurrentMillis();
+        if (!XMLSubSys::runParser(handler, *fileIt, true)) {
+            return false;
+        }
+        PROGRESS_TIME_MESSAGE(before);
+    }
+    myXMLHandler.setRegion(boundary, handler.getJunctions());
+    return true;
+}
+
+
 SUMORouteLoaderControl*
 NLBuilder::buildRouteLoaderControl(const OptionsCont& oc) {
     // build the loaders
@@ -351,7 +431,7 @@ NLBuilder::buildRouteLoaderControl(const OptionsCont& oc) {
         }
         // open files for reading
         for (std::vector<std::string>::const_iterator fileIt = files.begin(); fileIt != files.end(); ++fileIt) {
-            loaders->add(new SUMORouteLoader(new MSRouteHandler(*fileIt, false)));
+            loaders->add(new SUMORouteLoader(new MSRouteHandler(*fileIt, false), oc.getBool("route-files.parse-ahead")));
         }
     }
     return loaders;
@@ -31,7 +31,9 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <utils/geom/Boundary.h>
 #include <utils/xml/SAXWeightsHandler.h>
+#include <utils/xml/SUMOSAXHandler.h>
 
 
 // ===========================================================================
@@ -115,6 +117,17 @@ protected:
     bool load(const std::string& mmlWhat, const bool isNet = false);
 
 
+    /** @brief Restricts the network to load to the junctions within the boundary given by "net-file.boundary"
+     *
+     * The net handler decides while loading which junctions lie within the boundary.
+     *  Only for networks without a version (written by very old or foreign tools, whose
+     *  lanes need not end at their junctions) the network files are parsed once in
+     *  advance to locate the junctions by their positions.
+     * @return Whether the network files could be parsed and the boundary is valid
+     */
+    bool loadRegion();
+
+
     /** @brief Closes the net building process
      *
      * Builds the microsim-structures which belong to a MSNet using the factories
@@ -201,6 +214,53 @@ protected:
     };
 
 
+    /**
+     * @class RegionHandler
+     * @brief Reads the network version and locates the (non-internal) junctions of a network file relative to a boundary
+     */
+    class RegionHandler : public SUMOSAXHandler {
+    public:
+        /// @brief Constructor
+        RegionHandler(const Boundary& boundary) : myBoundary(boundary), mySeenNet(false), myHaveVersion(false) {}
+
+        /// @brief Destructor
+        ~RegionHandler() { }
+
+        /// @brief Returns for each junction whether it lies within the boundary
+        const std::map<std::string, bool>& getJunctions() const {
+            return myJunctions;
+        }
+
+        /// @brief Returns whether the root element was read
+        bool hasSeenNet() const {
+            return mySeenNet;
+        }
+
+        /// @brief Returns whether the root element has a version
+        bool hasVersion() const {
+            return myHaveVersion;
+        }
+
+    protected:
+        /// @brief Reads the version or checks the position of a junction
+        void myStartElement(int element, const SUMOSAXAttributes& attrs);
+
+    private:
+        /// @brief The boundary of the region to load
+        const Boundary myBoundary;
+
+        /// @brief Whether the junctions lie within the boundary
+        std::map<std::string, bool> myJunctions;
+
+        /// @brief Whether the root element was read
+        bool mySeenNet;
+
+        /// @brief Whether the root element has a version
+        bool myHaveVersion;
+
+    };
+
+
 protected:
     /// @brief The options to get the names of the files to load and further information from
     OptionsCont& myOptions;
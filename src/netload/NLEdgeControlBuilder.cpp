@@ -172,6 +172,18 @@ NLEdgeControlBuilder::closeEdge() {
 }
 
 
+void
+NLEdgeControlBuilder::discardEdge() {
+    assert(myLaneStorage->empty() && myEdges.back() == myActiveEdge);
+    myEdges.pop_back();
+    delete myActiveEdge;
+    myActiveEdge = 0;
+    // the numerical ids have to stay contiguous
+    myCurrentNumericalEdgeID--;
+    myCurrentDefaultStopOffsets.clear();
+}
+
+
 void
 NLEdgeControlBuilder::closeLane() {
     myCurrentLaneIndex=-1;
@@ -127,6 +127,12 @@ public:
         The edge is completely described by now and may not be opened again */
     virtual MSEdge* closeEdge();
 
+    /** @brief Deletes the edge begun last (before any lane was added)
+     *
+     * Used for edges which turn out to lie outside the region of the network to load.
+     */
+    void discardEdge();
+
     /** @brief Closes the building of a lane;
         The edge is completely described by now and may not be opened again */
     void closeLane();
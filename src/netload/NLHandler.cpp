@@ -76,13 +76,63 @@ NLHandler::NLHandler(const std::string& file, MSNet& net,
     myHaveSeenAdditionalSpeedRestrictions(false),
     myLefthand(false),
     myNetworkVersion(0),
-    myNetIsLoaded(false) {
+    myNetIsLoaded(false),
+    myHaveRegion(false),
+    myCurrentIsOutside(false),
+    myCurrentIsFringe(false) {
 }
 
 
 NLHandler::~NLHandler() {}
 
 
+void
+NLHandler::setRegion(const Boundary& boundary, const std::map<std::string, bool>& junctions) {
+    myHaveRegion = true;
+    myRegion = boundary;
+    myRegionJunctions = junctions;
+    myFringeJunctions.clear();
+}
+
+
+bool
+NLHandler::haveRegionJunctions() const {
+    for (std::map<std::string, bool>::const_iterator it = myRegionJunctions.begin(); it != myRegionJunctions.end(); ++it) {
+        if (it->second) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+bool
+NLHandler::isInRegion(const std::string& junctionID, const Position& pos) {
+    std::map<std::string, bool>::const_iterator it = myRegionJunctions.find(junctionID);
+    if (it == myRegionJunctions.end()) {
+        it = myRegionJunctions.insert(std::make_pair(junctionID, myRegion.around(pos))).first;
+    }
+    return it->second;
+}
+
+
+bool
+NLHandler::touchesRegion(const std::string& from, const std::string& to) {
+    const bool fromInside = myRegionJunctions[from];
+    const bool toInside = myRegionJunctions[to];
+    if (!fromInside && !toInside) {
+        return false;
+    }
+    if (!fromInside) {
+        myFringeJunctions.insert(from);
+    }
+    if (!toInside) {
+        myFringeJunctions.insert(to);
+    }
+    return true;
+}
+
+
 void
 NLHandler::myStartElement(int element,
                           const SUMOSAXAttributes& attrs) {
@@ -101,7 +151,9 @@ NLHandler::myStartElement(int element,
                 addLane(attrs);
                 break;
             case SUMO_TAG_NEIGH:
-                myEdgeControlBuilder.addNeigh(attrs.getString(SUMO_ATTR_LANE));
+                if (!myCurrentIsOutside) {
+                    myEdgeControlBuilder.addNeigh(attrs.getString(SUMO_ATTR_LANE));
+                }
                 myHaveSeenNeighs = true;
                 break;
             case SUMO_TAG_JUNCTION:
@@ -227,6 +279,9 @@ NLHandler::myStartElement(int element,
                 break;
             }
             case SUMO_TAG_STOPOFFSET: {
+                if (myCurrentIsOutside) {
+                    break;
+                }
                 bool ok = true;
                 std::map<SVCPermissions, double> stopOffsets = parseStopOffsets(attrs, ok);
                 if (!ok) {
@@ -259,7 +314,7 @@ NLHandler::myEndElement(int element) {
             myEdgeControlBuilder.closeLane();
             break;
         case SUMO_TAG_JUNCTION:
-            if (!myCurrentIsBroken) {
+            if (!myCurrentIsBroken && !myCurrentIsOutside) {
                 try {
                     myJunctionControlBuilder.closeJunctionLogic();
                     myJunctionControlBuilder.closeJunction(getFileName());
@@ -310,6 +365,7 @@ NLHandler::myEndElement(int element) {
                 }
             }
             myNetIsLoaded = true;
+            myCurrentIsOutside = false;
             break;
         default:
             break;
@@ -327,6 +383,8 @@ void
 NLHandler::beginEdgeParsing(const SUMOSAXAttributes& attrs) {
     bool ok = true;
     myCurrentIsBroken = false;
+    myCurrentIsOutside = false;
+    myCurrentRegionPendingEdge = "";
     // get the id, report an error if not given or empty...
     std::string id = attrs.get<std::string>(SUMO_ATTR_ID, 0, ok);
     if (!ok) {
@@ -341,11 +399,31 @@ NLHandler::beginEdgeParsing(const SUMOSAXAttributes& attrs) {
             return;
         }
         std::string junctionID = SUMOXMLDefinitions::getJunctionIDFromInternalEdge(id);
+        if (myHaveRegion) {
+            if (myRegionJunctions.count(junctionID) == 0) {
+                // the junction is located by the first lane
+                myCurrentRegionPendingEdge = id;
+            } else if (!myRegionJunctions[junctionID]) {
+                // omit internal edges of junctions outside the loaded region
+                myCurrentIsOutside = true;
+                return;
+            }
+        }
         myJunctionGraph[id] = std::make_pair(junctionID, junctionID);
     } else {
-        myJunctionGraph[id] = std::make_pair(
-                                  attrs.get<std::string>(SUMO_ATTR_FROM, id.c_str(), ok),
-                                  attrs.get<std::string>(SUMO_ATTR_TO, id.c_str(), ok));
+        const std::string from = attrs.get<std::string>(SUMO_ATTR_FROM, id.c_str(), ok);
+        const std::string to = attrs.get<std::string>(SUMO_ATTR_TO, id.c_str(), ok);
+        if (ok && myHaveRegion) {
+            if (myRegionJunctions.count(from) == 0 || myRegionJunctions.count(to) == 0) {
+                // the junctions are located by the ends of the first lane
+                myCurrentRegionPendingEdge = id;
+            } else if (!touchesRegion(from, to)) {
+                // omit edges not touching the loaded region
+                myCurrentIsOutside = true;
+                return;
+            }
+        }
+        myJunctionGraph[id] = std::make_pair(from, to);
         if (!ok) {
             myCurrentIsBroken = true;
             return;
@@ -394,8 +472,8 @@ NLHandler::beginEdgeParsing(const SUMOSAXAttributes& attrs) {
 
 void
 NLHandler::closeEdge() {
-    // omit internal edges if not wished and broken edges
-    if (myCurrentIsInternalToSkip || myCurrentIsBroken) {
+    // omit internal edges if not wished, edges outside the region and broken edges
+    if (myCurrentIsInternalToSkip || myCurrentIsOutside || myCurrentIsBroken) {
         return;
     }
     try {
@@ -410,8 +488,8 @@ NLHandler::closeEdge() {
 //             ---- the root/edge/lanes/lane - element
 void
 NLHandler::addLane(const SUMOSAXAttributes& attrs) {
-    // omit internal edges if not wished and broken edges
-    if (myCurrentIsInternalToSkip || myCurrentIsBroken) {
+    // omit internal edges if not wished, edges outside the region and broken edges
+    if (myCurrentIsInternalToSkip || myCurrentIsOutside || myCurrentIsBroken) {
         return;
     }
     bool ok = true;
@@ -434,6 +512,21 @@ NLHandler::addLane(const SUMOSAXAttributes& attrs) {
         myCurrentIsBroken = true;
         return;
     }
+    if (myCurrentRegionPendingEdge != "") {
+        // locate the junctions which were not seen before by the lane ends and drop the edge if it is outside
+        const std::pair<std::string, std::string> junctions = myJunctionGraph[myCurrentRegionPendingEdge];
+        isInRegion(junctions.first, shape.front());
+        isInRegion(junctions.second, shape.back());
+        if (!touchesRegion(junctions.first, junctions.second)) {
+            myJunctionGraph.erase(myCurrentRegionPendingEdge);
+            myEdgeControlBuilder.discardEdge();
+            myCurrentIsOutside = true;
+        }
+        myCurrentRegionPendingEdge = "";
+        if (myCurrentIsOutside) {
+            return;
+        }
+    }
     const SVCPermissions permissions = parseVehicleClasses(allow, disallow);
     if (permissions != SVCAll) {
         myNet.setPermissionsFound();
@@ -462,6 +555,8 @@ NLHandler::addLane(const SUMOSAXAttributes& attrs) {
 void
 NLHandler::openJunction(const SUMOSAXAttributes& attrs) {
     myCurrentIsBroken = false;
+    myCurrentIsOutside = false;
+    myCurrentIsFringe = false;
     bool ok = true;
     // get the id, report an error if not given or empty...
     std::string id = attrs.get<std::string>(SUMO_ATTR_ID, 0, ok);
@@ -469,6 +564,19 @@ NLHandler::openJunction(const SUMOSAXAttributes& attrs) {
         myCurrentIsBroken = true;
         return;
     }
+    if (myHaveRegion) {
+        // internal junctions are named after their lane and belong to the junction of this lane
+        const std::string junctionID = id[0] == ':' ? SUMOXMLDefinitions::getJunctionIDFromInternalEdge(SUMOXMLDefinitions::getEdgeIDFromLane(id)) : id;
+        // a junction which is not reached by any lane is located by its own position
+        const Position pos(attrs.get<double>(SUMO_ATTR_X, id.c_str(), ok, false), attrs.get<double>(SUMO_ATTR_Y, id.c_str(), ok, false));
+        if (!isInRegion(junctionID, pos)) {
+            if (id[0] == ':' || myFringeJunctions.count(id) == 0) {
+                myCurrentIsOutside = true;
+                return;
+            }
+            myCurrentIsFringe = true;
+        }
+    }
     PositionVector shape;
     if (attrs.hasAttribute(SUMO_ATTR_SHAPE)) {
         // inner junctions have no shape
@@ -489,11 +597,23 @@ NLHandler::openJunction(const SUMOSAXAttributes& attrs) {
     std::string key = attrs.getOpt<std::string>(SUMO_ATTR_KEY, id.c_str(), ok, "");
     // incoming lanes
     std::vector<MSLane*> incomingLanes;
-    parseLanes(id, attrs.getStringSecure(SUMO_ATTR_INCLANES, ""), incomingLanes, ok);
     // internal lanes
     std::vector<MSLane*> internalLanes;
-    if (MSGlobals::gUsingInternalLanes) {
-        parseLanes(id, attrs.getStringSecure(SUMO_ATTR_INTLANES, ""), internalLanes, ok);
+    if (myCurrentIsFringe) {
+        // only the loaded edges end here, the vehicles leave the network
+        type = NODETYPE_DEAD_END;
+        StringTokenizer st(attrs.getStringSecure(SUMO_ATTR_INCLANES, ""));
+        while (st.hasNext()) {
+            MSLane* lane = MSLane::dictionary(st.next());
+            if (lane != 0) {
+                incomingLanes.push_back(lane);
+            }
+        }
+    } else {
+        parseLanes(id, attrs.getStringSecure(SUMO_ATTR_INCLANES, ""), incomingLanes, ok);
+        if (MSGlobals::gUsingInternalLanes) {
+            parseLanes(id, attrs.getStringSecure(SUMO_ATTR_INTLANES, ""), internalLanes, ok);
+        }
     }
     if (!ok) {
         myCurrentIsBroken = true;
@@ -615,7 +735,7 @@ NLHandler::addWAUTJunction(const SUMOSAXAttributes& attrs) {
 
 void
 NLHandler::addRequest(const SUMOSAXAttributes& attrs) {
-    if (myCurrentIsBroken) {
+    if (myCurrentIsBroken || myCurrentIsOutside || myCurrentIsFringe) {
         return;
     }
     bool ok = true;
@@ -640,7 +760,7 @@ NLHandler::addRequest(const SUMOSAXAttributes& attrs) {
 
 void
 NLHandler::initJunctionLogic(const SUMOSAXAttributes& attrs) {
-    if (myCurrentIsBroken) {
+    if (myCurrentIsBroken || myCurrentIsOutside) {
         return;
     }
     myAmParsingTLLogicOrJunction = true;
@@ -1154,6 +1274,13 @@ NLHandler::addConnection(const SUMOSAXAttributes& attrs) {
     if (!MSGlobals::gUsingInternalLanes && (fromID[0] == ':' || toID[0] == ':')) {
         return;
     }
+    if (myHaveRegion) {
+        // omit connections at junctions outside the loaded region
+        JunctionGraph::const_iterator it = myJunctionGraph.find(fromID);
+        if (it == myJunctionGraph.end() || !myRegionJunctions[it->second.second]) {
+            return;
+        }
+    }
 
     MSLink* link = 0;
     try {
@@ -1316,6 +1443,10 @@ NLHandler::addDistrict(const SUMOSAXAttributes& attrs) {
                 MSEdge* edge = MSEdge::dictionary(*i);
                 // check whether the edge exists
                 if (edge == 0) {
+                    if (myHaveRegion) {
+                        // outside the loaded region
+                        continue;
+                    }
                     throw InvalidArgument("The edge '" + *i + "' within district '" + myCurrentDistrictID + "' is not known.");
                 }
                 source->addSuccessor(edge);
@@ -1353,7 +1484,7 @@ NLHandler::addDistrictEdge(const SUMOSAXAttributes& attrs, bool isSource) {
         } else {
             succ->addSuccessor(MSEdge::dictionary(myCurrentDistrictID + "-sink"));
         }
-    } else {
+    } else if (!myHaveRegion) {
         WRITE_ERROR("At district '" + myCurrentDistrictID + "': succeeding edge '" + id + "' does not exist.");
     }
 }
@@ -1366,7 +1497,9 @@ NLHandler::addRoundabout(const SUMOSAXAttributes& attrs) {
         for (std::vector<std::string>::iterator it = edgeIDs.begin(); it != edgeIDs.end(); ++it) {
             MSEdge* edge = MSEdge::dictionary(*it);
             if (edge == 0) {
-                WRITE_ERROR("Unknown edge '" + (*it) + "' in roundabout");
+                if (!myHaveRegion) {
+                    WRITE_ERROR("Unknown edge '" + (*it) + "' in roundabout");
+                }
             } else {
                 edge->markAsRoundabout();
             }
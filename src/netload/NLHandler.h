@@ -30,6 +30,8 @@
 #include <config.h>
 #endif
 
+#include <map>
+#include <set>
 #include <utils/geom/Boundary.h>
 #include <utils/shapes/ShapeHandler.h>
 #include <microsim/MSRouteHandler.h>
@@ -126,6 +128,22 @@ public:
         return myNetworkVersion;
     }
 
+    /** @brief Restricts the network to load to the junctions within the given boundary
+     *
+     * Only the edges starting or ending at one of these junctions are loaded.
+     *  The other end of such an edge is built as a dead end without internal
+     *  lanes and connections, all other junctions are skipped.
+     * As the junctions follow the edges in the network file, a junction not
+     *  given in junctions is located by the end of the first lane reaching it
+     *  (or by its own position if no lane reaches it before).
+     * @param[in] boundary The boundary of the region to load
+     * @param[in] junctions Whether junctions known in advance lie within the boundary
+     */
+    void setRegion(const Boundary& boundary, const std::map<std::string, bool>& junctions);
+
+    /// @brief Returns whether a junction within the region to load was found
+    bool haveRegionJunctions() const;
+
 protected:
     /// @name inherited from GenericSAXHandler
     //@{
@@ -218,6 +236,20 @@ private:
     /// begins the processing of an edge
     void beginEdgeParsing(const SUMOSAXAttributes& attrs);
 
+    /** @brief Returns whether the junction lies within the loaded region
+     *
+     * A junction which is not located yet is located at the given position.
+     * @param[in] junctionID The id of the junction
+     * @param[in] pos The position to use if the junction is not located yet
+     */
+    bool isInRegion(const std::string& junctionID, const Position& pos);
+
+    /** @brief Returns whether the edge between the (located) junctions touches the loaded region
+     *
+     * The end of a loaded edge outside the region is remembered as a fringe junction.
+     */
+    bool touchesRegion(const std::string& from, const std::string& to);
+
     /// adds a lane to the previously opened edge
     void addLane(const SUMOSAXAttributes& attrs);
 
@@ -360,6 +392,27 @@ protected:
     typedef std::map<std::string, std::pair<std::string, std::string> > JunctionGraph;
     JunctionGraph myJunctionGraph;
 
+    /// @brief whether only a part of the network gets loaded
+    bool myHaveRegion;
+
+    /// @brief the boundary of the loaded region (if myHaveRegion)
+    Boundary myRegion;
+
+    /// @brief whether the junctions located so far lie within the region (and are loaded completely)
+    std::map<std::string, bool> myRegionJunctions;
+
+    /// @brief the junctions outside the region which are the end of a loaded edge
+    std::set<std::string> myFringeJunctions;
+
+    /// @brief whether the currently parsed edge or junction lies outside the loaded region
+    bool myCurrentIsOutside;
+
+    /// @brief whether the currently parsed junction is a fringe junction
+    bool myCurrentIsFringe;
+
+    /// @brief the currently parsed edge if its first lane decides whether it lies outside the region
+    std::string myCurrentRegionPendingEdge;
+
 private:
     /** invalid copy constructor */
     NLHandler(const NLHandler& s);
@@ -31,6 +31,7 @@
 #include <algorithm>
 #include <utils/options/OptionsCont.h>
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/iodevices/OutputDevice_String.h>
 #include <utils/geom/GeoConvHelper.h>
 #include <utils/common/ToString.h>
 #include <utils/common/MsgHandler.h>
@@ -48,6 +49,9 @@
 #include "NWFrame.h"
 #include "NWWriter_SUMO.h"
 
+// number of edges or junctions serialized by one task of the thread pool
+#define SERIALIZATION_CHUNK_SIZE 256
+
 
 
 // ===========================================================================
@@ -106,10 +110,9 @@ NWWriter_SUMO::writeNetwork(const OptionsCont& oc, NBNetBuilder& nb) {
     }
 
     // write edges with lanes and connected edges
+    const int numThreads = oc.exists("threads") ? oc.getInt("threads") : 0;
     bool noNames = !oc.getBool("output.street-names");
-    for (std::map<std::string, NBEdge*>::const_iterator i = ec.begin(); i != ec.end(); ++i) {
-        writeEdge(device, *(*i).second, noNames);
-    }
+    writeEdges(device, ec, noNames, numThreads);
     device.lf();
 
     // write tls logics
@@ -127,10 +130,12 @@ NWWriter_SUMO::writeNetwork(const OptionsCont& oc, NBNetBuilder& nb) {
             }
         }
     }
+    std::vector<std::pair<const NBNode*, bool> > junctions;
     for (std::map<std::string, NBNode*>::const_iterator i = nc.begin(); i != nc.end(); ++i) {
         const bool checkLaneFoes = checkLaneFoesAll || (checkLaneFoesRoundabout && roundaboutNodes.count((*i).second) > 0);
-        writeJunction(device, *(*i).second, checkLaneFoes);
+        junctions.push_back(std::make_pair((*i).second, checkLaneFoes));
     }
+    writeJunctions(device, junctions, numThreads);
     device.lf();
     const bool includeInternal = !oc.getBool("no-internal-links");
     if (includeInternal) {
@@ -397,6 +402,43 @@ NWWriter_SUMO::writeEdge(OutputDevice& into, const NBEdge& e, bool noNames) {
 }
 
 
+void
+NWWriter_SUMO::writeEdges(OutputDevice& into, const NBEdgeCont& ec, bool noNames, const int numThreads) {
+    std::vector<const NBEdge*> edges;
+    // lanes without a positive speed are reported (or refused) by writeLane which has to happen in order
+    bool parallel = numThreads > 1 && !into.isBinary();
+    for (std::map<std::string, NBEdge*>::const_iterator i = ec.begin(); i != ec.end(); ++i) {
+        edges.push_back((*i).second);
+        const std::vector<NBEdge::Lane>& lanes = (*i).second->getLanes();
+        for (std::vector<NBEdge::Lane>::const_iterator j = lanes.begin(); j != lanes.end(); ++j) {
+            parallel &= (*j).speed > 0;
+        }
+    }
+#ifdef HAVE_FOX
+    if (parallel && (int)edges.size() > SERIALIZATION_CHUNK_SIZE) {
+        std::vector<OutputDevice_String*> buffers;
+        FXWorkerThread::Pool threadPool(numThreads);
+        for (int begin = 0; begin < (int)edges.size(); begin += SERIALIZATION_CHUNK_SIZE) {
+            buffers.push_back(new OutputDevice_String(false, 1));
+            buffers.back()->setPrecision(into.getPrecision());
+            threadPool.add(new EdgeTask(edges, begin, MIN2(begin + SERIALIZATION_CHUNK_SIZE, (int)edges.size()), noNames, *buffers.back()));
+        }
+        threadPool.waitAll();
+        for (std::vector<OutputDevice_String*>::const_iterator i = buffers.begin(); i != buffers.end(); ++i) {
+            into << (*i)->getString();
+            delete *i;
+        }
+        return;
+    }
+#else
+    UNUSED_PARAMETER(parallel);
+#endif
+    for (std::vector<const NBEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+        writeEdge(into, **i, noNames);
+    }
+}
+
+
 void
 NWWriter_SUMO::writeLane(OutputDevice& into, const std::string& lID,
                          double speed, SVCPermissions permissions, SVCPermissions preferred,
@@ -531,6 +573,33 @@ NWWriter_SUMO::writeJunction(OutputDevice& into, const NBNode& n, const bool che
 }
 
 
+void
+NWWriter_SUMO::writeJunctions(OutputDevice& into, const std::vector<std::pair<const NBNode*, bool> >& nodes, const int numThreads) {
+#ifdef HAVE_FOX
+    if (numThreads > 1 && !into.isBinary() && (int)nodes.size() > SERIALIZATION_CHUNK_SIZE) {
+        std::vector<OutputDevice_String*> buffers;
+        FXWorkerThread::Pool threadPool(numThreads);
+        for (int begin = 0; begin < (int)nodes.size(); begin += SERIALIZATION_CHUNK_SIZE) {
+            buffers.push_back(new OutputDevice_String(false, 1));
+            buffers.back()->setPrecision(into.getPrecision());
+            threadPool.add(new JunctionTask(nodes, begin, MIN2(begin + SERIALIZATION_CHUNK_SIZE, (int)nodes.size()), *buffers.back()));
+        }
+        threadPool.waitAll();
+        for (std::vector<OutputDevice_String*>::const_iterator i = buffers.begin(); i != buffers.end(); ++i) {
+            into << (*i)->getString();
+            delete *i;
+        }
+        return;
+    }
+#else
+    UNUSED_PARAMETER(numThreads);
+#endif
+    for (std::vector<std::pair<const NBNode*, bool> >::const_iterator i = nodes.begin(); i != nodes.end(); ++i) {
+        writeJunction(into, *(*i).first, (*i).second);
+    }
+}
+
+
 bool
 NWWriter_SUMO::writeInternalNodes(OutputDevice& into, const NBNode& n) {
     bool ret = false;
@@ -863,5 +932,30 @@ NWWriter_SUMO::writeStopOffsets(OutputDevice& into, const std::map<SVCPermission
     into.closeTag();
 }
 
+
+#ifdef HAVE_FOX
+// ===========================================================================
+// NWWriter_SUMO::EdgeTask method definitions
+// ===========================================================================
+void
+NWWriter_SUMO::EdgeTask::run(FXWorkerThread* /* context */) {
+    for (int i = myBegin; i < myEnd; i++) {
+        writeEdge(myInto, *myEdges[i], myNoNames);
+    }
+}
+
+
+// ===========================================================================
+// NWWriter_SUMO::JunctionTask method definitions
+// ===========================================================================
+void
+NWWriter_SUMO::JunctionTask::run(FXWorkerThread* /* context */) {
+    for (int i = myBegin; i < myEnd; i++) {
+        writeJunction(myInto, *myNodes[i].first, myNodes[i].second);
+    }
+}
+#endif
+
+
 /****************************************************************************/
 
@@ -36,6 +36,9 @@
 #include <utils/xml/SUMOSAXHandler.h>
 #include <utils/common/UtilExceptions.h>
 #include <netbuild/NBConnectionDefs.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -126,6 +129,19 @@ private:
     static void writeEdge(OutputDevice& into, const NBEdge& e, bool noNames);
 
 
+    /** @brief Writes all (normal) edges in the order of their ids
+     *
+     * With more than one thread the edges are serialized in chunks into
+     *  separate buffers which are appended in order, so the output does not
+     *  depend on the number of threads.
+     * @param[in] into The device to write the edges into
+     * @param[in] ec The edge container to write
+     * @param[in] noNames Whether names shall be ignored
+     * @param[in] numThreads The number of threads to use
+     */
+    static void writeEdges(OutputDevice& into, const NBEdgeCont& ec, bool noNames, const int numThreads);
+
+
     /** @brief Writes a lane (<lane ...) of an edge
      * @param[in] into The device to write the edge into
      * @param[in] lID The ID of the lane
@@ -152,6 +168,14 @@ private:
     static void writeJunction(OutputDevice& into, const NBNode& n, const bool checkLaneFoes);
 
 
+    /** @brief Writes the given junctions, in parallel like writeEdges
+     * @param[in] into The device to write the junctions into
+     * @param[in] nodes The junctions/nodes to write together with their checkLaneFoes flag
+     * @param[in] numThreads The number of threads to use
+     */
+    static void writeJunctions(OutputDevice& into, const std::vector<std::pair<const NBNode*, bool> >& nodes, const int numThreads);
+
+
     /** @brief Writes internal junctions (<junction with id[0]==':' ...) of the given node
      * @param[in] into The device to write the edge into
      * @param[in] n The junction/node to write internal nodes for
@@ -203,6 +227,47 @@ private:
     /// @brief retrieve the id of the opposite direction internal lane if it exists
     static std::string getOppositeInternalID(const NBEdgeCont& ec, const NBEdge* from, const NBEdge::Connection& con);
 
+#ifdef HAVE_FOX
+    /**
+     * @class EdgeTask
+     * @brief Serializes a range of edges into a buffer in a worker thread
+     */
+    class EdgeTask : public FXWorkerThread::Task {
+    public:
+        EdgeTask(const std::vector<const NBEdge*>& edges, const int begin, const int end, const bool noNames, OutputDevice& into)
+            : myEdges(edges), myBegin(begin), myEnd(end), myNoNames(noNames), myInto(into) {}
+        void run(FXWorkerThread* context);
+    private:
+        const std::vector<const NBEdge*>& myEdges;
+        const int myBegin;
+        const int myEnd;
+        const bool myNoNames;
+        OutputDevice& myInto;
+    private:
+        /// @brief Invalidated assignment operator.
+        EdgeTask& operator=(const EdgeTask&);
+    };
+
+    /**
+     * @class JunctionTask
+     * @brief Serializes a range of junctions into a buffer in a worker thread
+     */
+    class JunctionTask : public FXWorkerThread::Task {
+    public:
+        JunctionTask(const std::vector<std::pair<const NBNode*, bool> >& nodes, const int begin, const int end, OutputDevice& into)
+            : myNodes(nodes), myBegin(begin), myEnd(end), myInto(into) {}
+        void run(FXWorkerThread* context);
+    private:
+        const std::vector<std::pair<const NBNode*, bool> >& myNodes;
+        const int myBegin;
+        const int myEnd;
+        OutputDevice& myInto;
+    private:
+        /// @brief Invalidated assignment operator.
+        JunctionTask& operator=(const JunctionTask&);
+    };
+#endif
+
 };
 
 
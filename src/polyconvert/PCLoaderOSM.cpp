@@ -153,12 +153,12 @@ PCLoaderOSM::loadIfSet(OptionsCont& oc, PCPolyContainer& toFill,
         PositionVector vec;
         for (std::vector<long long int>::iterator j = e->myCurrentNodes.begin(); j != e->myCurrentNodes.end(); ++j) {
             PCOSMNode* n = nodes.find(*j)->second;
-            Position pos(n->lon, n->lat);
-            if (!GeoConvHelper::getProcessing().x2cartesian(pos)) {
-                WRITE_WARNING("Unable to project coordinates for polygon '" + toString(e->id) + "'.");
-            }
-            vec.push_back_noDoublePos(pos);
+            vec.push_back(Position(n->lon, n->lat));
+        }
+        if (!GeoConvHelper::getProcessing().x2cartesian(vec)) {
+            WRITE_WARNING("Unable to project coordinates for polygon '" + toString(e->id) + "'.");
         }
+        vec.removeDoublePoints();
         const bool ignorePruning = OptionsCont::getOptions().isInStringVector("prune.keep-list", toString(e->id));
         // add as many polygons as keys match defined types
         int index = 0;
@@ -98,6 +98,9 @@ ROFrame::fillOptions(OptionsCont& oc) {
     oc.doRegister("route-steps", 's', new Option_String("200", "TIME"));
     oc.addDescription("route-steps", "Processing", "Load routes for the next number of seconds ahead");
 
+    oc.doRegister("route-files.parse-ahead", new Option_Bool(false));
+    oc.addDescription("route-files.parse-ahead", "Processing", "Parse each route file in a background thread ahead of the routing");
+
     oc.doRegister("randomize-flows", new Option_Bool(false));
     oc.addDescription("randomize-flows", "Processing", "generate random departure times for flow input");
 
@@ -178,6 +181,10 @@ ROFrame::checkOptions(OptionsCont& oc) {
         WRITE_ERROR("Parallel routing is only possible when compiled with Fox.");
         return false;
     }
+    if (oc.getBool("route-files.parse-ahead")) {
+        WRITE_ERROR("Parsing route files in the background is only possible when compiled with Fox.");
+        return false;
+    }
 #endif
     return true;
 }
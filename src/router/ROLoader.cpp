@@ -234,7 +234,7 @@ ROLoader::openTypedRoutes(const std::string& optionName,
                 }
                 delete handler;
             } else {
-                myLoaders.add(new SUMORouteLoader(handler));
+                myLoaders.add(new SUMORouteLoader(handler, myOptions.exists("route-files.parse-ahead") && myOptions.getBool("route-files.parse-ahead")));
             }
         } catch (ProcessError& e) {
             WRITE_ERROR("The loader for " + optionName + " from file '" + fileIt + "' could not be initialised (" + e.what() + ").");
@@ -65,6 +65,18 @@
 // command: change target
 #define CMD_CHANGETARGET 0x31
 
+// command: get a variable for a list of objects
+#define CMD_GET_BULK_VARIABLE 0x60
+
+// response: get a variable for a list of objects
+#define RESPONSE_GET_BULK_VARIABLE 0x70
+
+// command: subscribe context with the results ordered by variable
+#define CMD_SUBSCRIBE_COLUMNAR_CONTEXT 0x61
+
+// response: subscribe context with the results ordered by variable
+#define RESPONSE_SUBSCRIBE_COLUMNAR_CONTEXT 0x71
+
 // command: close sumo
 #define CMD_CLOSE 0x7F
 
@@ -47,6 +47,7 @@
 #include <iostream>
 #include <algorithm>
 #include <foreign/tcpip/socket.h>
+#include <foreign/tcpip/shmsocket.h>
 #include <foreign/tcpip/storage.h>
 #include <utils/common/SUMOTime.h>
 #include <utils/vehicle/DijkstraRouter.h>
@@ -103,10 +104,11 @@ bool TraCIServer::myDoCloseConnection = false;
 // ===========================================================================
 // method definitions
 // ===========================================================================
-TraCIServer::TraCIServer(const SUMOTime begin, const int port, const int numClients)
+TraCIServer::TraCIServer(const SUMOTime begin, const int port, const int numClients, const std::string& sharedMemory)
     : myServerSocket(0),
       myTargetTime(begin),
-      myAmEmbedded(port == 0) {
+      myAmEmbedded(port == 0 && sharedMemory == ""),
+      myParallelQueries(OptionsCont::getOptions().getBool("parallel-queries") && numClients > 1 && sharedMemory == "") {
 #ifdef DEBUG_MULTI_CLIENTS
     std::cout << "Creating new TraCIServer for " << numClients << " clients on port " << port << "." << std::endl;
 #endif
@@ -161,8 +163,16 @@ TraCIServer::TraCIServer(const SUMOTime begin, const int port, const int numClie
 
     if (!myAmEmbedded) {
         try {
-            WRITE_MESSAGE("***Starting server on port " + toString(port) + " ***");
-            myServerSocket = new tcpip::Socket(port);
+            if (sharedMemory != "") {
+                if (OptionsCont::getOptions().getBool("parallel-queries")) {
+                    WRITE_WARNING("Parallel queries are not supported for shared memory connections.");
+                }
+                WRITE_MESSAGE("***Starting server on shared memory segment '" + sharedMemory + "' ***");
+                myServerSocket = new tcpip::SharedMemorySocket(sharedMemory);
+            } else {
+                WRITE_MESSAGE("***Starting server on port " + toString(port) + " ***");
+                myServerSocket = new tcpip::Socket(port);
+            }
             while ((int)mySockets.size() < numClients) {
                 int index = (int)mySockets.size() + MAX_ORDER + 1;
                 mySockets[index] = new SocketInfo(myServerSocket->accept(true), begin);
@@ -204,13 +214,15 @@ TraCIServer::~TraCIServer() {
 void
 TraCIServer::openSocket(const std::map<int, CmdExecutor>& execs) {
     if (myInstance == 0 && !myDoCloseConnection && (OptionsCont::getOptions().getInt("remote-port") != 0
+            || OptionsCont::getOptions().isSet("remote-shm")
 #ifdef HAVE_PYTHON
             || OptionsCont::getOptions().isSet("python-script")
 #endif
                                                    )) {
         myInstance = new TraCIServer(string2time(OptionsCont::getOptions().getString("begin")),
                                      OptionsCont::getOptions().getInt("remote-port"),
-                                     OptionsCont::getOptions().getInt("num-clients"));
+                                     OptionsCont::getOptions().getInt("num-clients"),
+                                     OptionsCont::getOptions().getString("remote-shm"));
         for (std::map<int, CmdExecutor>::const_iterator i = execs.begin(); i != execs.end(); ++i) {
             myInstance->myExecutors[i->first] = i->second;
         }
@@ -489,7 +501,16 @@ TraCIServer::processCommandsUntilSimStep(SUMOTime step) {
 #endif
                         // Read next request
                         myInputStorage.reset();
-                        myCurrentSocket->second->socket->receiveExact(myInputStorage);
+                        if (myParallelQueries) {
+                            answerQueriesUntilRequest();
+                        }
+                        SocketInfo* const current = myCurrentSocket->second;
+                        if (current->pending.size() > 0) {
+                            myInputStorage.writeStorage(current->pending);
+                            current->pending.reset();
+                        } else {
+                            current->socket->receiveExact(myInputStorage);
+                        }
                     }
 
                     while (myInputStorage.valid_pos() && !myDoCloseConnection) {
@@ -697,6 +718,85 @@ TraCIServer::removeCurrentSocket() {
 }
 
 
+void
+TraCIServer::answerQueriesUntilRequest() {
+    const std::map<int, SocketInfo*>::iterator current = myCurrentSocket;
+    while (current->second->pending.size() == 0) {
+        // wait for the current client and all other clients which may still send queries
+        std::vector<tcpip::Socket*> waiting;
+        for (std::map<int, SocketInfo*>::const_iterator it = mySockets.begin(); it != mySockets.end(); ++it) {
+            if (it == current || it->second->pending.size() == 0) {
+                waiting.push_back(it->second->socket);
+            }
+        }
+        const std::vector<tcpip::Socket*> ready = tcpip::Socket::wait_for_pending_data(waiting);
+        if (ready.empty() || std::find(ready.begin(), ready.end(), current->second->socket) != ready.end()) {
+            break;
+        }
+        for (myCurrentSocket = mySockets.begin(); myCurrentSocket != mySockets.end(); ++myCurrentSocket) {
+            SocketInfo* const info = myCurrentSocket->second;
+            if (std::find(ready.begin(), ready.end(), info->socket) == ready.end()) {
+                continue;
+            }
+            info->socket->receiveExact(myInputStorage);
+            if (isReadOnly(myInputStorage)) {
+#ifdef DEBUG_MULTI_CLIENTS
+                std::cout << "    answering query of client " << info->socket << " out of turn" << std::endl;
+#endif
+                // myCurrentSocket points to the querying client (needed for the vehicle state changes)
+                while (myInputStorage.valid_pos()) {
+                    dispatchCommand();
+                }
+                info->socket->sendExact(myOutputStorage);
+                myOutputStorage.reset();
+            } else {
+                info->pending.writeStorage(myInputStorage);
+            }
+            myInputStorage.reset();
+        }
+        myCurrentSocket = current;
+    }
+}
+
+
+bool
+TraCIServer::isReadOnly(const int commandId) {
+    return commandId == CMD_GETVERSION || isGetCommand(commandId);
+}
+
+
+bool
+TraCIServer::isReadOnly(const tcpip::Storage& request) {
+    const int size = (int)request.size();
+    tcpip::Storage::StorageType::const_iterator data = request.begin();
+    int pos = 0;
+    while (pos < size) {
+        int length = data[pos];
+        int idPos = pos + 1;
+        if (length == 0) {
+            if (pos + 5 >= size) {
+                return false;
+            }
+            length = (data[pos + 1] << 24) | (data[pos + 2] << 16) | (data[pos + 3] << 8) | data[pos + 4];
+            idPos = pos + 5;
+        }
+        if (length <= 0 || idPos >= size) {
+            return false;
+        }
+        if (data[idPos] == CMD_GET_BULK_VARIABLE) {
+            // a bulk request is read-only if the contained get command is
+            if (idPos + 1 >= size || !isGetCommand(data[idPos + 1])) {
+                return false;
+            }
+        } else if (!isReadOnly(data[idPos])) {
+            return false;
+        }
+        pos += length;
+    }
+    return size > 0;
+}
+
+
 int
 TraCIServer::readCommandID(int& commandStart, int& commandLength) {
     commandStart = myInputStorage.position();
@@ -725,6 +825,9 @@ TraCIServer::dispatchCommand() {
             case CMD_GETVERSION:
                 success = commandGetVersion();
                 break;
+            case CMD_GET_BULK_VARIABLE:
+                success = commandGetBulkVariable(commandStart + commandLength);
+                break;
             case CMD_LOAD: {
                 std::vector<std::string> args;
                 if (!readTypeCheckingStringList(myInputStorage, args)) {
@@ -825,6 +928,15 @@ TraCIServer::dispatchCommand() {
             case CMD_SUBSCRIBE_GUI_VARIABLE:
                 success = addObjectVariableSubscription(commandId, false);
                 break;
+            case CMD_SUBSCRIBE_COLUMNAR_CONTEXT: {
+                const int contextCommandId = myInputStorage.readUnsignedByte();
+                if (contextCommandId < CMD_SUBSCRIBE_INDUCTIONLOOP_CONTEXT || contextCommandId > CMD_SUBSCRIBE_PERSON_CONTEXT) {
+                    writeErrorStatusCmd(CMD_SUBSCRIBE_COLUMNAR_CONTEXT, "Unsupported context subscription " + toHex(contextCommandId, 2) + " specified.", myOutputStorage);
+                    break;
+                }
+                success = addObjectVariableSubscription(contextCommandId, true, true);
+                break;
+            }
             case CMD_SUBSCRIBE_INDUCTIONLOOP_CONTEXT:
             case CMD_SUBSCRIBE_LANEAREA_CONTEXT:
             case CMD_SUBSCRIBE_MULTIENTRYEXIT_CONTEXT:
@@ -883,6 +995,83 @@ TraCIServer::commandGetVersion() {
 }
 
 
+bool
+TraCIServer::commandGetBulkVariable(const int commandEnd) {
+    const int getCommandId = myInputStorage.readUnsignedByte();
+    const int variable = myInputStorage.readUnsignedByte();
+    std::vector<std::string> ids;
+    if (!readTypeCheckingStringList(myInputStorage, ids)) {
+        return writeErrorStatusCmd(CMD_GET_BULK_VARIABLE, "A bulk get command needs a list of object ids.", myOutputStorage);
+    }
+    if (!isGetCommand(getCommandId) || myExecutors.find(getCommandId) == myExecutors.end()) {
+        return writeErrorStatusCmd(CMD_GET_BULK_VARIABLE, "Unsupported get command " + toHex(getCommandId, 2) + " specified.", myOutputStorage);
+    }
+    std::vector<unsigned char> parameters;
+    while ((int)myInputStorage.position() < commandEnd) {
+        parameters.push_back(myInputStorage.readChar());
+    }
+    tcpip::Storage response;
+    tcpip::Storage values;
+    values.reserve(ids.size() * (3 + sizeof(double)));
+    for (const std::string& id : ids) {
+        values.writeUnsignedByte(variable);
+        if (executeGet(getCommandId, variable, id, parameters, response)) {
+            values.writeUnsignedByte(RTYPE_OK);
+            values.writeStorage(response);
+        } else {
+            values.writeUnsignedByte(RTYPE_ERR);
+            values.writeUnsignedByte(TYPE_STRING);
+            values.writeString(response.readString());
+        }
+    }
+    writeStatusCmd(CMD_GET_BULK_VARIABLE, RTYPE_OK, "");
+    myOutputStorage.writeUnsignedByte(0); // command length -> extended
+    myOutputStorage.writeInt(1 + 4 + 1 + 1 + 1 + 4 + (int)values.size());
+    myOutputStorage.writeUnsignedByte(RESPONSE_GET_BULK_VARIABLE);
+    myOutputStorage.writeUnsignedByte(getCommandId);
+    myOutputStorage.writeUnsignedByte(variable);
+    myOutputStorage.writeInt((int)ids.size());
+    myOutputStorage.writeStorage(values);
+    return true;
+}
+
+
+bool
+TraCIServer::isGetCommand(const int commandId) {
+    return commandId >= CMD_GET_INDUCTIONLOOP_VARIABLE && commandId <= CMD_GET_PERSON_VARIABLE;
+}
+
+
+bool
+TraCIServer::executeGet(const int getCommandId, const int variable, const std::string& objID,
+                        const std::vector<unsigned char>& parameters, tcpip::Storage& response) {
+    tcpip::Storage message;
+    message.writeUnsignedByte(variable);
+    message.writeString(objID);
+    message.writePacket(parameters);
+    response.reset();
+    if (!myExecutors[getCommandId](*this, message, response)) {
+        // skip length, command and status
+        response.readUnsignedByte();
+        response.readUnsignedByte();
+        response.readUnsignedByte();
+        return false;
+    }
+    // skip the status and the length, response type, variable and id of the response
+    int length = response.readUnsignedByte();
+    while (--length > 0) {
+        response.readUnsignedByte();
+    }
+    if (response.readUnsignedByte() == 0) {
+        response.readInt();
+    }
+    response.readUnsignedByte();
+    response.readUnsignedByte();
+    response.readString();
+    return true;
+}
+
+
 void
 TraCIServer::postProcessSimulationStep() {
     SUMOTime t = MSNet::getInstance()->getCurrentTimeStep();
@@ -994,15 +1183,17 @@ void
 TraCIServer::initialiseSubscription(const TraCIServer::Subscription& s) {
     tcpip::Storage writeInto;
     std::string errors;
+    const int statusCommandId = s.columnar ? CMD_SUBSCRIBE_COLUMNAR_CONTEXT : s.commandId;
     if (processSingleSubscription(s, writeInto, errors)) {
         if (s.endTime < MSNet::getInstance()->getCurrentTimeStep()) {
-            writeStatusCmd(s.commandId, RTYPE_ERR, "Subscription has ended.");
+            writeStatusCmd(statusCommandId, RTYPE_ERR, "Subscription has ended.");
         } else {
             bool needNewSubscription = true;
             for (std::vector<Subscription>::iterator i = mySubscriptions.begin(); i != mySubscriptions.end(); ++i) {
                 if (s.commandId == i->commandId && s.id == i->id &&
                         s.beginTime == i->beginTime && s.endTime == i->endTime &&
-                        s.contextVars == i->contextVars && s.contextDomain == i->contextDomain && s.range == i->range) {
+                        s.contextVars == i->contextVars && s.contextDomain == i->contextDomain && s.range == i->range &&
+                        s.columnar == i->columnar) {
                     std::vector<std::vector<unsigned char> >::const_iterator k = s.parameters.begin();
                     for (std::vector<int>::const_iterator j = s.variables.begin(); j != s.variables.end(); ++j, ++k) {
                         const int offset = (int)(std::find(i->variables.begin(), i->variables.end(), *j) - i->variables.begin());
@@ -1031,10 +1222,10 @@ TraCIServer::initialiseSubscription(const TraCIServer::Subscription& s) {
                     mySubscriptionCache.writeStorage(tmp);
                 }
             }
-            writeStatusCmd(s.commandId, RTYPE_OK, "");
+            writeStatusCmd(statusCommandId, RTYPE_OK, "");
         }
     } else {
-        writeStatusCmd(s.commandId, RTYPE_ERR, "Could not add subscription (" + errors + ").");
+        writeStatusCmd(statusCommandId, RTYPE_ERR, "Could not add subscription (" + errors + ").");
     }
     myOutputStorage.writeStorage(writeInto);
 }
@@ -1143,6 +1334,9 @@ TraCIServer::processSingleSubscription(const Subscription& s, tcpip::Storage& wr
     } else {
         objIDs.insert(s.id);
     }
+    if (s.columnar) {
+        return processColumnarSubscription(s, objIDs, writeInto, errors);
+    }
     const int numVars = s.contextVars && s.variables.size() == 1 && s.variables[0] == ID_LIST ? 0 : (int)s.variables.size();
     for (std::set<std::string>::iterator j = objIDs.begin(); j != objIDs.end(); ++j) {
         if (s.contextVars) {
@@ -1168,22 +1362,17 @@ TraCIServer::processSingleSubscription(const Subscription& s, tcpip::Storage& wr
                     while (--length > 0) {
                         tmpOutput.readUnsignedByte();
                     }
-                    int lengthLength = 1;
-                    length = tmpOutput.readUnsignedByte();
-                    if (length == 0) {
-                        lengthLength = 5;
-                        length = tmpOutput.readInt();
+                    if (tmpOutput.readUnsignedByte() == 0) {
+                        tmpOutput.readInt();
                     }
                     //read responseType
                     tmpOutput.readUnsignedByte();
                     int variable = tmpOutput.readUnsignedByte();
-                    std::string id = tmpOutput.readString();
+                    tmpOutput.readString();
                     outputStorage.writeUnsignedByte(variable);
                     outputStorage.writeUnsignedByte(RTYPE_OK);
-                    length -= (lengthLength + 1 + 4 + (int)id.length());
-                    while (--length > 0) {
-                        outputStorage.writeUnsignedByte(tmpOutput.readUnsignedByte());
-                    }
+                    // the value is the remainder of the response
+                    outputStorage.writeStorage(tmpOutput);
                 } else {
                     //read length
                     tmpOutput.readUnsignedByte();
@@ -1224,7 +1413,68 @@ TraCIServer::processSingleSubscription(const Subscription& s, tcpip::Storage& wr
 
 
 bool
-TraCIServer::addObjectVariableSubscription(const int commandId, const bool hasContext) {
+TraCIServer::processColumnarSubscription(const Subscription& s, const std::set<std::string>& objIDs,
+        tcpip::Storage& writeInto, std::string& errors) {
+    if (myExecutors.find(s.contextDomain) == myExecutors.end()) {
+        errors = "Unsupported command specified";
+        return false;
+    }
+    bool ok = true;
+    const std::vector<std::string> ids(objIDs.begin(), objIDs.end());
+    const int numVars = s.variables.size() == 1 && s.variables[0] == ID_LIST ? 0 : (int)s.variables.size();
+    tcpip::Storage columns;
+    if (numVars > 0 && !ids.empty()) {
+        tcpip::Storage response;
+        tcpip::Storage column;
+        std::vector<std::vector<unsigned char> >::const_iterator k = s.parameters.begin();
+        for (std::vector<int>::const_iterator i = s.variables.begin(); i != s.variables.end(); ++i, ++k) {
+            column.reset();
+            int type = -1;
+            std::string error;
+            for (const std::string& id : ids) {
+                if (!executeGet(s.contextDomain, *i, id, *k, response)) {
+                    error = response.readString();
+                    break;
+                }
+                const int valueType = response.readUnsignedByte();
+                if (type >= 0 && valueType != type) {
+                    error = "The values of variable " + toHex(*i, 2) + " have different types.";
+                    break;
+                }
+                type = valueType;
+                column.writeStorage(response);
+            }
+            columns.writeUnsignedByte(*i);
+            if (error == "") {
+                columns.writeUnsignedByte(RTYPE_OK);
+                columns.writeUnsignedByte(type);
+                columns.writeStorage(column);
+            } else {
+                columns.writeUnsignedByte(RTYPE_ERR);
+                columns.writeUnsignedByte(TYPE_STRING);
+                columns.writeString(error);
+                errors = errors + error;
+                ok = false;
+            }
+        }
+    }
+    tcpip::Storage header;
+    header.writeUnsignedByte(RESPONSE_SUBSCRIBE_COLUMNAR_CONTEXT);
+    header.writeUnsignedByte(s.commandId + 0x10);
+    header.writeString(s.id);
+    header.writeUnsignedByte(s.contextDomain);
+    header.writeUnsignedByte(numVars);
+    header.writeStringList(ids);
+    writeInto.writeUnsignedByte(0); // command length -> extended
+    writeInto.writeInt(1 + 4 + (int)header.size() + (int)columns.size());
+    writeInto.writeStorage(header);
+    writeInto.writeStorage(columns);
+    return ok;
+}
+
+
+bool
+TraCIServer::addObjectVariableSubscription(const int commandId, const bool hasContext, const bool columnar) {
     const SUMOTime beginTime = myInputStorage.readInt();
     const SUMOTime endTime = myInputStorage.readInt();
     const std::string id = myInputStorage.readString();
@@ -1243,11 +1493,14 @@ TraCIServer::addObjectVariableSubscription(const int commandId, const bool hasCo
     }
     // check subscribe/unsubscribe
     if (variables.size() == 0) {
+        if (columnar) {
+            return writeErrorStatusCmd(CMD_SUBSCRIBE_COLUMNAR_CONTEXT, "A columnar context subscription needs at least one variable, unsubscribe using the context subscription.", myOutputStorage);
+        }
         removeSubscription(commandId, id, -1);
         return true;
     }
     // process subscription
-    Subscription s(commandId, id, variables, parameters, beginTime, endTime, hasContext, domain, range);
+    Subscription s(commandId, id, variables, parameters, beginTime, endTime, hasContext, domain, range, columnar);
     initialiseSubscription(s);
     return true;
 }
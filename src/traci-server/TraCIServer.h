@@ -270,8 +270,10 @@ public:
 private:
     /** @brief Constructor
      * @param[in] port The port to listen to (to open)
+     * @param[in] numClients The number of clients to wait for
+     * @param[in] sharedMemory The name of the shared memory segment to use instead of the port
      */
-    TraCIServer(const SUMOTime begin, const int port, const int numClients);
+    TraCIServer(const SUMOTime begin, const int port, const int numClients, const std::string& sharedMemory = "");
 
 
     /// @brief Destructor
@@ -294,6 +296,8 @@ private:
         tcpip::Socket* socket;
         /// @brief container for vehicle state changes since last step taken by this client
         std::map<MSNet::VehicleState, std::vector<std::string> > vehicleStateChanges;
+        /// @brief a modifying request received before the client's turn (see answerQueriesUntilRequest)
+        tcpip::Storage pending;
     private:
         SocketInfo(const SocketInfo&);
     };
@@ -307,6 +311,18 @@ private:
     bool commandGetVersion();
 
 
+    /** @brief Retrieves a variable for a list of objects using the get command of their domain
+     *
+     * Any additional parameters following the object ids are passed to each get command.
+     * @param[in] commandEnd The position in the input storage where the command ends
+     * @return Whether the command could be processed (errors for single objects are reported within the response)
+     */
+    bool commandGetBulkVariable(const int commandEnd);
+
+    /// @brief Returns whether the command retrieves a variable of one of the object domains
+    static bool isGetCommand(const int commandId);
+
+
     /** @brief Handles subscriptions to send after a simstep2 command
      */
     void postProcessSimulationStep();
@@ -340,6 +356,20 @@ private:
     /// @brief removes myCurrentSocket from mySockets and returns an iterator pointing to the next member according to the ordering
     std::map<int, SocketInfo*>::iterator removeCurrentSocket();
 
+    /** @brief Answers the read-only requests of the other clients until the current client sent its next request
+     *
+     * Requests of clients waiting for their turn which contain only getter commands (see isReadOnly)
+     *  are answered immediately, other requests are stored and processed in the client's turn.
+     *  The server blocks (in select) until one of these clients sends a request.
+     */
+    void answerQueriesUntilRequest();
+
+    /// @brief Returns whether the command does not modify the simulation or the server state
+    static bool isReadOnly(const int commandId);
+
+    /// @brief Returns whether all commands of the request are read-only (bulk requests are checked for their get command)
+    static bool isReadOnly(const tcpip::Storage& request);
+
 
 private:
     /// @brief Singleton instance of the server
@@ -376,6 +406,9 @@ private:
     /// @brief Whether the server runs in embedded mode
     const bool myAmEmbedded;
 
+    /// @brief Whether read-only requests of clients waiting for their turn are answered immediately
+    const bool myParallelQueries;
+
     /// @brief Map of commandIds -> their executors; applicable if the executor applies to the method footprint
     std::map<int, CmdExecutor> myExecutors;
 
@@ -398,12 +431,14 @@ private:
          * @param[in] contextVarsArg Whether the subscription is a context subscription (variable subscription otherwise)
          * @param[in] contextDomainArg The domain ID of the context
          * @param[in] rangeArg The range of the context
+         * @param[in] columnarArg Whether the context results are ordered by variable
          */
         Subscription(int commandIdArg, const std::string& idArg,
                      const std::vector<int>& variablesArg, const std::vector<std::vector<unsigned char> >& paramsArg,
-                     SUMOTime beginTimeArg, SUMOTime endTimeArg, bool contextVarsArg, int contextDomainArg, double rangeArg)
+                     SUMOTime beginTimeArg, SUMOTime endTimeArg, bool contextVarsArg, int contextDomainArg, double rangeArg,
+                     bool columnarArg = false)
             : commandId(commandIdArg), id(idArg), variables(variablesArg), parameters(paramsArg), beginTime(beginTimeArg), endTime(endTimeArg),
-              contextVars(contextVarsArg), contextDomain(contextDomainArg), range(rangeArg) {}
+              contextVars(contextVarsArg), contextDomain(contextDomainArg), range(rangeArg), columnar(columnarArg) {}
 
         /// @brief commandIdArg The command id of the subscription
         int commandId;
@@ -423,6 +458,8 @@ private:
         int contextDomain;
         /// @brief The range of the context
         double range;
+        /// @brief Whether the context results are ordered by variable (see CMD_SUBSCRIBE_COLUMNAR_CONTEXT)
+        bool columnar;
 
     };
 
@@ -439,12 +476,31 @@ private:
     std::map<MSNet::VehicleState, std::vector<std::string> > myVehicleStateChanges;
 
 private:
-    bool addObjectVariableSubscription(const int commandId, const bool hasContext);
+    bool addObjectVariableSubscription(const int commandId, const bool hasContext, const bool columnar = false);
     void initialiseSubscription(const Subscription& s);
     void removeSubscription(int commandId, const std::string& identity, int domain);
     bool processSingleSubscription(const TraCIServer::Subscription& s, tcpip::Storage& writeInto,
                                    std::string& errors);
 
+    /** @brief Writes the results of a context subscription ordered by variable
+     *
+     * The object ids are followed by one column per variable, holding the type once
+     *  and the values of all objects without type information.
+     */
+    bool processColumnarSubscription(const TraCIServer::Subscription& s, const std::set<std::string>& objIDs,
+                                     tcpip::Storage& writeInto, std::string& errors);
+
+    /** @brief Executes the get command of the domain for a single object and variable
+     * @param[in] getCommandId The get command (an executor has to exist)
+     * @param[in] variable The variable to retrieve
+     * @param[in] objID The object to retrieve the variable from
+     * @param[in] parameters Additional parameters of the get command
+     * @param[out] response Positioned at the type of the value on success, at the error message otherwise
+     * @return Whether the variable could be retrieved
+     */
+    bool executeGet(const int getCommandId, const int variable, const std::string& objID,
+                    const std::vector<unsigned char>& parameters, tcpip::Storage& response);
+
 
     bool findObjectShape(int domain, const std::string& id, PositionVector& shape);
 
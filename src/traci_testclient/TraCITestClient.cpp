@@ -66,7 +66,7 @@ TraCITestClient::~TraCITestClient() {
 
 
 int
-TraCITestClient::run(std::string fileName, int port, std::string host) {
+TraCITestClient::run(std::string fileName, int port, std::string host, std::string sharedMemory) {
     std::ifstream defFile;
     std::string fileContentStr;
     std::stringstream fileContent;
@@ -77,7 +77,11 @@ TraCITestClient::run(std::string fileName, int port, std::string host) {
 
     // try to connect
     try {
-        TraCIAPI::connect(host, port);
+        if (sharedMemory != "") {
+            TraCIAPI::connectSharedMemory(sharedMemory);
+        } else {
+            TraCIAPI::connect(host, port);
+        }
     } catch (tcpip::SocketException& e) {
         std::stringstream msg;
         msg << "#Error while connecting: " << e.what();
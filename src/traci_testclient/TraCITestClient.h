@@ -62,8 +62,9 @@ public:
      * @param[in] fileName The name of the file containing the test script
      * @param[in] port The server port to connect to
      * @param[in] host The server name to connect to
+     * @param[in] sharedMemory The shared memory segment to connect to instead of host and port
      */
-    int run(std::string fileName, int port, std::string host = "localhost");
+    int run(std::string fileName, int port, std::string host = "localhost", std::string sharedMemory = "");
 
 
 protected:
@@ -42,10 +42,11 @@ int main(int argc, char* argv[]) {
     std::string outFileName = "testclient_out.txt";
     int port = -1;
     std::string host = "localhost";
+    std::string sharedMemory = "";
 
     if ((argc == 1) || (argc % 2 == 0)) {
         std::cout << "Usage: TraCITestClient -def <definition_file>  -p <remote port>"
-                  << "[-h <remote host>] [-o <outputfile name>]" << std::endl;
+                  << "[-h <remote host>] [-shm <shared memory segment>] [-o <outputfile name>]" << std::endl;
         return 0;
     }
 
@@ -63,13 +64,16 @@ int main(int argc, char* argv[]) {
         } else if (arg.compare("-h") == 0) {
             host = argv[i + 1];
             i++;
+        } else if (arg.compare("-shm") == 0) {
+            sharedMemory = argv[i + 1];
+            i++;
         } else {
             std::cerr << "unknown parameter: " << argv[i] << std::endl;
             return 1;
         }
     }
 
-    if (port == -1) {
+    if (port == -1 && sharedMemory == "") {
         std::cerr << "Missing port" << std::endl;
         return 1;
     }
@@ -80,7 +84,7 @@ int main(int argc, char* argv[]) {
 
     try {
         TraCITestClient client(outFileName);
-        return client.run(defFile, port, host);
+        return client.run(defFile, port, host, sharedMemory);
     } catch (tcpip::SocketException& e) {
         std::cerr << "Socket error running the test client: " << e.what();
         return 1;
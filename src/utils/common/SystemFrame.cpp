@@ -87,6 +87,9 @@ SystemFrame::addReportOptions(OptionsCont& oc) {
     oc.doRegister("xml-validation.net", new Option_String("never"));
     oc.addDescription("xml-validation.net", "Report", "Set schema validation scheme of SUMO network inputs (\"never\", \"auto\" or \"always\")");
 
+    oc.doRegister("xml-parser", new Option_String("xerces"));
+    oc.addDescription("xml-parser", "Report", "Set the parser for XML inputs (\"xerces\" or \"plain\"), the plain parser only reads inputs with the validation scheme \"never\" (see --xml-validation and --xml-validation.net)");
+
     oc.doRegister("no-warnings", 'W', new Option_Bool(false));
     oc.addSynonyme("no-warnings", "suppress-warnings", true);
     oc.addDescription("no-warnings", "Report", "Disables output of warnings");
@@ -30,6 +30,7 @@
 #endif
 
 #include <string>
+#include <cstring>
 #include <sstream>
 #include <cmath>
 #include <limits>
@@ -95,21 +96,15 @@ public:
         if (data == 0) {
             throw EmptyData();
         }
-        if (length == 0) {
-            return "";
-        }
-        char* buf = new char[length + 1];
-        int i = 0;
-        for (i = 0; i < length; i++) {
+        // fill the result directly, there is no need for an intermediate buffer
+        std::string ret(length, '\0');
+        for (int i = 0; i < length; i++) {
             if ((int) data[i] > 255) {
-                buf[i] = 63; // rudimentary damage control, replace with '?'
+                ret[i] = 63; // rudimentary damage control, replace with '?'
             } else {
-                buf[i] = (char) data[i];
+                ret[i] = (char) data[i];
             }
         }
-        buf[i] = 0;
-        std::string ret = buf;
-        delete[] buf;
         return ret;
     }
 
@@ -387,14 +382,21 @@ public:
         if (data == 0 || data[0] == 0) {
             throw EmptyData();
         }
-        std::string s = _2str(data);
-        // Don't use std::transform(..., ::tolower) due a C4244 Warning in MSVC17
-        for (int i = 0; i < (int)s.length(); i++) {
-            s[i] = (char)::tolower((char)s[i]);
+        // all valid values have at most five characters, so a fixed buffer suffices
+        char s[6];
+        for (int i = 0; i < 6; i++) {
+            if (i == 5 && data[i] != 0) {
+                throw BoolFormatException();
+            }
+            // Don't use std::transform(..., ::tolower) due a C4244 Warning in MSVC17
+            s[i] = (int) data[i] > 255 ? '?' : (char)::tolower((char)data[i]);
+            if (data[i] == 0) {
+                break;
+            }
         }
-        if (s == "1" || s == "yes" || s == "true" || s == "on" || s == "x" || s == "t") {
+        if (strcmp(s, "1") == 0 || strcmp(s, "yes") == 0 || strcmp(s, "true") == 0 || strcmp(s, "on") == 0 || strcmp(s, "x") == 0 || strcmp(s, "t") == 0) {
             return true;
-        } else if (s == "0" || s == "no" || s == "false" || s == "off" || s == "-" || s == "f") {
+        } else if (strcmp(s, "0") == 0 || strcmp(s, "no") == 0 || strcmp(s, "false") == 0 || strcmp(s, "off") == 0 || strcmp(s, "-") == 0 || strcmp(s, "f") == 0) {
             return false;
         } else {
             throw BoolFormatException();
@@ -102,6 +102,72 @@ public:
     };
 
 
+    /**
+     * @class EmissionsCache
+     * @brief Remembers the results of the last computeAll calls for one vehicle
+     *
+     * Several consumers (emission device, meandata, emission / full output)
+     *  evaluate the emissions of the same vehicle within one simulation step.
+     *  The device and the outputs use the vehicle's speed while the meandata
+     *  use the mean speed on the lane, so the results are kept per speed and
+     *  acceleration. The cached values are only reused if all arguments match
+     *  exactly so the results are the same as recomputing them.
+     */
+    class EmissionsCache {
+    public:
+        /// @brief Constructor
+        EmissionsCache() : myLastUsed(0) {}
+
+        /** @brief Returns the amount of all emitted pollutants, computing them only if the arguments changed
+         * @param[in] c The vehicle emission class
+         * @param[in] v The vehicle's current velocity
+         * @param[in] a The vehicle's current acceleration
+         * @param[in] slope The road's slope at vehicle's position [deg]
+         * @return The amount emitted by the given vehicle class when moving with the given velocity and acceleration [mg/s]
+         */
+        const Emissions& get(const SUMOEmissionClass c, const double v, const double a, const double slope) {
+            for (int i = 0; i < SIZE; i++) {
+                Entry& e = myEntries[i];
+                if (e.valid && e.speed == v && e.accel == a && e.emissionClass == c && e.slope == slope) {
+                    myLastUsed = i;
+                    return e.values;
+                }
+            }
+            // replace the entry which was not used by the last call
+            myLastUsed = (myLastUsed + 1) % SIZE;
+            Entry& e = myEntries[myLastUsed];
+            e.values = computeAll(c, v, a, slope);
+            e.emissionClass = c;
+            e.speed = v;
+            e.accel = a;
+            e.slope = slope;
+            e.valid = true;
+            return e.values;
+        }
+
+    private:
+        /// @brief The number of remembered results (one per speed used by the consumers)
+        static const int SIZE = 2;
+
+        /// @brief The arguments and the result of one computation
+        struct Entry {
+            Entry() : valid(false), emissionClass(0), speed(0.), accel(0.), slope(0.) {}
+            bool valid;
+            SUMOEmissionClass emissionClass;
+            double speed;
+            double accel;
+            double slope;
+            Emissions values;
+        };
+
+        /// @brief The remembered computations
+        Entry myEntries[SIZE];
+
+        /// @brief The index of the entry returned by the last call
+        int myLastUsed;
+    };
+
+
     /**
     * @class Helper
     * @brief abstract superclass for the model helpers
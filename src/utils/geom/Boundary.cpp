@@ -79,6 +79,12 @@ Boundary::reset() {
 }
 
 
+bool
+Boundary::isInitialised() const {
+    return myWasInitialised;
+}
+
+
 void
 Boundary::add(double x, double y, double z) {
     if (!myWasInitialised) {
@@ -59,6 +59,9 @@ public:
     /// Resets the boundary
     void reset();
 
+    /// Returns whether a coordinate was added since the last reset
+    bool isInitialised() const;
+
     /// Makes the boundary include the given coordinate
     void add(double x, double y, double z = 0);
 
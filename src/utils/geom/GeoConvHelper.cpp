@@ -31,9 +31,11 @@
 #include <cmath>
 #include <cassert>
 #include <climits>
+#include <complex>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/ToString.h>
 #include <utils/geom/GeomHelper.h>
+#include <utils/geom/PositionVector.h>
 #include <utils/options/OptionsCont.h>
 #include <utils/iodevices/OutputDevice.h>
 #include "GeoConvHelper.h"
@@ -62,6 +64,7 @@ GeoConvHelper::GeoConvHelper(const std::string& proj, const Position& offset,
 #endif
     myOffset(offset),
     myGeoScale(scale),
+    myUTMZone(0),
     myProjectionMethod(NONE),
     myUseInverseProjection(inverse),
     myOrigBoundary(orig),
@@ -98,7 +101,7 @@ GeoConvHelper::~GeoConvHelper() {
         pj_free(myInverseProjection);
     }
     if (myGeoProjection != 0) {
-        pj_free(myInverseProjection);
+        pj_free(myGeoProjection);
     }
 #endif
 }
@@ -112,6 +115,7 @@ GeoConvHelper::operator=(const GeoConvHelper& orig) {
     myOrigBoundary = orig.myOrigBoundary;
     myConvBoundary = orig.myConvBoundary;
     myGeoScale = orig.myGeoScale;
+    myUTMZone = orig.myUTMZone;
     myUseInverseProjection = orig.myUseInverseProjection;
 #ifdef HAVE_PROJ
     if (myProjection != 0) {
@@ -259,6 +263,9 @@ GeoConvHelper::x2cartesian(Position& from, bool includeInBoundary) {
         myOrigBoundary.add(from);
     }
     // init projection parameter on first use
+    if (myProjectionMethod == UTM && myUTMZone == 0) {
+        myUTMZone = (int)(from.x() * myGeoScale + 180) / 6 + 1;
+    }
 #ifdef HAVE_PROJ
     if (myProjection == 0) {
         double x = from.x() * myGeoScale;
@@ -339,6 +346,7 @@ GeoConvHelper::x2cartesian_const(Position& from) const {
             WRITE_WARNING("Invalid latitude " + toString(y));
             return false;
         }
+        bool projected = false;
 #ifdef HAVE_PROJ
         if (myProjection != 0) {
             projUV p;
@@ -348,8 +356,12 @@ GeoConvHelper::x2cartesian_const(Position& from) const {
             //!!! check pj_errno
             x = p.u;
             y = p.v;
+            projected = true;
         }
 #endif
+        if (!projected && myUTMZone != 0) {
+            x2utm(x, y);
+        }
         if (myProjectionMethod == SIMPLE) {
             x *= 111320. * cos(DEG2RAD(y));
             y *= 111136.;
@@ -366,6 +378,101 @@ GeoConvHelper::x2cartesian_const(Position& from) const {
 }
 
 
+bool
+GeoConvHelper::x2cartesian(PositionVector& from, bool includeInBoundary) {
+    bool ok = true;
+    for (int i = 0; i < (int)from.size(); i++) {
+        if (myUTMZone == 0 || myUseInverseProjection) {
+            // initialises the projection on first use
+            ok &= x2cartesian(from[i], includeInBoundary);
+            continue;
+        }
+        // UTM without the overhead of proj.4
+        Position& pos = from[i];
+        if (includeInBoundary) {
+            myOrigBoundary.add(pos);
+        }
+        double x = pos.x() * myGeoScale;
+        double y = pos.y() * myGeoScale;
+        if (x > 180.1 || x < -180.1 || y > 90.1 || y < -90.1) {
+            // reports the invalid coordinate
+            ok &= x2cartesian_const(pos);
+            continue;
+        }
+        x2utm(x, y);
+        pos.set(x, y);
+        pos.add(myOffset);
+        if (includeInBoundary) {
+            myConvBoundary.add(pos);
+        }
+    }
+    return ok;
+}
+
+
+void
+GeoConvHelper::x2utm(double& x, double& y) const {
+    // WGS84, see Karney: "Transverse Mercator with an accuracy of a few nanometers", J. Geodesy 85 (2011)
+    static const double f = 1. / 298.257223563;
+    static const double e = sqrt(f * (2. - f));
+    static const double n = f / (2. - f);
+    static const double n2 = n * n;
+    static const double n3 = n2 * n;
+    static const double n4 = n3 * n;
+    static const double n5 = n4 * n;
+    static const double n6 = n5 * n;
+    // scale factor (0.9996) times the rectifying radius
+    static const double k0A = 0.9996 * 6378137. / (1. + n) * (1. + n2 / 4. + n4 / 64. + n6 / 256.);
+    static const double alpha[6] = {
+        n / 2. - 2. * n2 / 3. + 5. * n3 / 16. + 41. * n4 / 180. - 127. * n5 / 288. + 7891. * n6 / 37800.,
+        13. * n2 / 48. - 3. * n3 / 5. + 557. * n4 / 1440. + 281. * n5 / 630. - 1983433. * n6 / 1935360.,
+        61. * n3 / 240. - 103. * n4 / 140. + 15061. * n5 / 26880. + 167603. * n6 / 181440.,
+        49561. * n4 / 161280. - 179. * n5 / 168. + 6601661. * n6 / 7257600.,
+        34729. * n5 / 80640. - 3418889. * n6 / 1995840.,
+        212378941. * n6 / 319334400.
+    };
+    const double lambda = DEG2RAD(x - (6 * myUTMZone - 183));
+    const double sinPhi = sin(DEG2RAD(y));
+    // conformal latitude and spherical transverse mercator
+    const double t = sinh(atanh(sinPhi) - e * atanh(e * sinPhi));
+    const std::complex<double> zeta(atan2(t, cos(lambda)), atanh(sin(lambda) / sqrt(1. + t * t)));
+    // Clenshaw summation of the series in sin(2 * j * zeta)
+    const std::complex<double> cos2 = cos(2. * zeta);
+    std::complex<double> b1 = 0.;
+    std::complex<double> b2 = 0.;
+    for (int j = 5; j >= 0; j--) {
+        const std::complex<double> b0 = 2. * cos2 * b1 - b2 + alpha[j];
+        b2 = b1;
+        b1 = b0;
+    }
+    const std::complex<double> result = zeta + sin(2. * zeta) * b1;
+    x = 500000. + k0A * result.imag();
+    y = k0A * result.real();
+}
+
+
+GeoConvHelper*
+GeoConvHelper::copyForThread() const {
+    GeoConvHelper* copy = new GeoConvHelper("!", Position(), Boundary(), Boundary());
+    // recreates the projections
+    *copy = *this;
+    copy->myOrigBoundary.reset();
+    copy->myConvBoundary.reset();
+    return copy;
+}
+
+
+void
+GeoConvHelper::includeBoundaries(const GeoConvHelper& copy) {
+    if (copy.myOrigBoundary.isInitialised()) {
+        myOrigBoundary.add(copy.myOrigBoundary);
+    }
+    if (copy.myConvBoundary.isInitialised()) {
+        myConvBoundary.add(copy.myConvBoundary);
+    }
+}
+
+
 void
 GeoConvHelper::moveConvertedBy(double x, double y) {
     myOffset.add(x, y);
@@ -121,6 +121,21 @@ public:
     /// @brief Converts the given coordinate into a cartesian using the previous initialisation
     bool x2cartesian_const(Position& from) const;
 
+    /**@brief Converts the given coordinates into cartesians and optionally updates the boundaries
+     * @note: the first position initialises the projection, the others use a faster
+     *  conversion than x2cartesian for the simple and the UTM projection
+     * @return Whether all coordinates could be converted (all are tried)
+     */
+    bool x2cartesian(PositionVector& from, bool includeInBoundary = true);
+
+    /**@brief Returns a copy with projections of its own and empty boundaries
+     * @note: a projection must not be shared between threads, so each thread converting in parallel needs its own copy
+     */
+    GeoConvHelper* copyForThread() const;
+
+    /// @brief Makes the boundaries include the boundaries of the given copy (see copyForThread)
+    void includeBoundaries(const GeoConvHelper& copy);
+
     /// @brief Returns whether a transformation from geo to metric coordinates will be performed
     bool usingGeoProjection() const;
 
@@ -184,6 +199,9 @@ private:
     /// @brief The scaling to apply to geo-coordinates
     double myGeoScale;
 
+    /// @brief The zone of the built-in UTM projection (0 before initialisation)
+    int myUTMZone;
+
     /// @brief Information whether no projection shall be done
     ProjectionMethod myProjectionMethod;
 
@@ -208,6 +226,9 @@ private:
     /// @brief the numer of coordinate transformations loaded from location elements
     static int myNumLoaded;
 
+    /// @brief Converts the given geo coordinate (in degrees) into UTM without proj.4 (Krueger series)
+    void x2utm(double& x, double& y) const;
+
     /// @brief make assignment operator private
     GeoConvHelper& operator=(const GeoConvHelper&);
 
@@ -27,51 +27,130 @@
 #endif
 
 #include <string>
+#include <cstring>
+#include <fstream>
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #include <utils/common/StdDefs.h>
 #include <utils/geom/Position.h>
 #include "BinaryFormatter.h"
 #include "BinaryInputDevice.h"
 
-// ===========================================================================
-// constants definitions
-// ===========================================================================
-#define BUF_MAX 10000
-
 
 // ===========================================================================
 // method definitions
 // ===========================================================================
 BinaryInputDevice::BinaryInputDevice(const std::string& name,
                                      const bool isTyped, const bool doValidate)
-    : myStream(name.c_str(), std::fstream::in | std::fstream::binary),
-      myAmTyped(isTyped), myEnableValidation(doValidate) {}
+    : myData(0), mySize(0), myPos(0), myAmMapped(false), myAmGood(false),
+      myAmTyped(isTyped), myEnableValidation(doValidate) {
+#ifndef WIN32
+    const int fd = open(name.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            // writable copy-on-write pages, so putback can replace single bytes
+            void* const mapped = mmap(0, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+                madvise(mapped, (size_t)info.st_size, MADV_SEQUENTIAL);
+#endif
+                myData = static_cast<char*>(mapped);
+                mySize = (long long int)info.st_size;
+                myAmMapped = true;
+                myAmGood = true;
+            }
+        }
+        close(fd);
+    }
+#endif
+    if (!myAmMapped) {
+        // fall back to reading the whole file at once
+        std::ifstream strm(name.c_str(), std::fstream::in | std::fstream::binary);
+        if (strm.good()) {
+            strm.seekg(0, std::ios::end);
+            const std::streamoff size = strm.tellg();
+            strm.seekg(0, std::ios::beg);
+            if (size > 0) {
+                myContent.resize((size_t)size);
+                strm.read(&myContent[0], size);
+                myData = &myContent[0];
+                mySize = (long long int)strm.gcount();
+            }
+            myAmGood = true;
+        }
+    }
+}
 
 
-BinaryInputDevice::~BinaryInputDevice() {}
+BinaryInputDevice::~BinaryInputDevice() {
+#ifndef WIN32
+    if (myAmMapped) {
+        munmap(myData, (size_t)mySize);
+    }
+#endif
+}
 
 
 bool
 BinaryInputDevice::good() const {
-    return myStream.good();
+    return myAmGood;
 }
 
 
 int
 BinaryInputDevice::peek() {
-    return myStream.peek();
+    if (myPos >= mySize) {
+        myAmGood = false;
+        return EOF;
+    }
+    return (unsigned char)myData[myPos];
 }
 
 
 std::string
 BinaryInputDevice::read(int numBytes) {
-    myStream.read((char*) &myBuffer, sizeof(char)*numBytes);
-    return std::string(myBuffer, numBytes);
+    std::string result(numBytes, 0);
+    if (numBytes > 0) {
+        readBytes(&result[0], numBytes);
+    }
+    return result;
 }
 
 
 void
 BinaryInputDevice::putback(char c) {
-    myStream.putback(c);
+    if (myPos > 0) {
+        myPos--;
+        myData[myPos] = c;
+    }
+}
+
+
+void
+BinaryInputDevice::retype(BinaryFormatter::DataType t) {
+    char c;
+    readBytes(&c, sizeof(char));
+    putback((char)t);
+}
+
+
+void
+BinaryInputDevice::readBytes(void* into, const int numBytes) {
+    const long long int available = MIN2((long long int)numBytes, mySize - myPos);
+    if (available > 0) {
+        memcpy(into, myData + myPos, (size_t)available);
+        myPos += available;
+    }
+    if (available < numBytes) {
+        memset(static_cast<char*>(into) + MAX2(available, 0LL), 0, (size_t)(numBytes - MAX2(available, 0LL)));
+        myPos = mySize;
+        myAmGood = false;
+    }
 }
 
 
@@ -79,8 +158,8 @@ int
 BinaryInputDevice::checkType(BinaryFormatter::DataType t) {
     if (myAmTyped) {
         char c;
-        myStream.read(&c, sizeof(char));
-        if (myEnableValidation && c != t) {
+        readBytes(&c, sizeof(char));
+        if (myEnableValidation && c != t && !isCompatible(t, c)) {
             throw ProcessError("Unexpected type.");
         }
         return c;
@@ -89,10 +168,25 @@ BinaryInputDevice::checkType(BinaryFormatter::DataType t) {
 }
 
 
+bool
+BinaryInputDevice::isCompatible(BinaryFormatter::DataType expected, int found) {
+    // numbers may be stored scaled and positions may have a third dimension
+    switch (expected) {
+        case BinaryFormatter::BF_FLOAT:
+            return found == BinaryFormatter::BF_SCALED2INT;
+        case BinaryFormatter::BF_POSITION_2D:
+            return found == BinaryFormatter::BF_POSITION_3D ||
+                   found == BinaryFormatter::BF_SCALED2INT_POSITION_2D || found == BinaryFormatter::BF_SCALED2INT_POSITION_3D;
+        default:
+            return false;
+    }
+}
+
+
 BinaryInputDevice&
 operator>>(BinaryInputDevice& os, char& c) {
     os.checkType(BinaryFormatter::BF_BYTE);
-    os.myStream.read(&c, sizeof(char));
+    os.readBytes(&c, sizeof(char));
     return os;
 }
 
@@ -100,7 +194,7 @@ operator>>(BinaryInputDevice& os, char& c) {
 BinaryInputDevice&
 operator>>(BinaryInputDevice& os, unsigned char& c) {
     os.checkType(BinaryFormatter::BF_BYTE);
-    os.myStream.read((char*) &c, sizeof(unsigned char));
+    os.readBytes(&c, sizeof(unsigned char));
     return os;
 }
 
@@ -108,7 +202,7 @@ operator>>(BinaryInputDevice& os, unsigned char& c) {
 BinaryInputDevice&
 operator>>(BinaryInputDevice& os, int& i) {
     os.checkType(BinaryFormatter::BF_INTEGER);
-    os.myStream.read((char*) &i, sizeof(int));
+    os.readBytes(&i, sizeof(int));
     return os;
 }
 
@@ -118,10 +212,10 @@ operator>>(BinaryInputDevice& os, double& f) {
     int t = os.checkType(BinaryFormatter::BF_FLOAT);
     if (t == BinaryFormatter::BF_SCALED2INT) {
         int v;
-        os.myStream.read((char*) &v, sizeof(int));
+        os.readBytes(&v, sizeof(int));
         f = v / 100.;
     } else {
-        os.myStream.read((char*) &f, sizeof(double));
+        os.readBytes(&f, sizeof(double));
     }
     return os;
 }
@@ -131,7 +225,7 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, bool& b) {
     os.checkType(BinaryFormatter::BF_BYTE);
     b = false;
-    os.myStream.read((char*) &b, sizeof(char));
+    os.readBytes(&b, sizeof(char));
     return os;
 }
 
@@ -140,14 +234,16 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, std::string& s) {
     os.checkType(BinaryFormatter::BF_STRING);
     int size;
-    os.myStream.read((char*) &size, sizeof(int));
-    int done = 0;
-    while (done < size) {
-        const int toRead = MIN2((int)size - done, (int)BUF_MAX - 1);
-        os.myStream.read((char*) &os.myBuffer, sizeof(char)*toRead);
-        os.myBuffer[toRead] = 0;
-        s += std::string(os.myBuffer);
-        done += toRead;
+    os.readBytes(&size, sizeof(int));
+    const long long int available = MIN2((long long int)size, os.mySize - os.myPos);
+    if (available > 0) {
+        // strings are written without terminating zero, stop at an embedded one as before
+        const char* const begin = os.myData + os.myPos;
+        s.append(begin, strnlen(begin, (size_t)available));
+        os.myPos += available;
+    }
+    if (available < size) {
+        os.myAmGood = false;
     }
     return os;
 }
@@ -157,7 +253,7 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, std::vector<std::string>& v) {
     os.checkType(BinaryFormatter::BF_LIST);
     int size;
-    os.myStream.read((char*) &size, sizeof(int));
+    os.readBytes(&size, sizeof(int));
     while (size > 0) {
         std::string s;
         os >> s;
@@ -172,7 +268,7 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, std::vector<int>& v) {
     os.checkType(BinaryFormatter::BF_LIST);
     int size;
-    os.myStream.read((char*) &size, sizeof(int));
+    os.readBytes(&size, sizeof(int));
     while (size > 0) {
         int i;
         os >> i;
@@ -187,7 +283,7 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, std::vector< std::vector<int> >& v) {
     os.checkType(BinaryFormatter::BF_LIST);
     int size;
-    os.myStream.read((char*) &size, sizeof(int));
+    os.readBytes(&size, sizeof(int));
     while (size > 0) {
         std::vector<int> nested;
         os >> nested;
@@ -202,21 +298,21 @@ BinaryInputDevice&
 operator>>(BinaryInputDevice& os, Position& p) {
     int t = os.checkType(BinaryFormatter::BF_POSITION_2D);
     double x, y, z = 0;
-    if (t == BinaryFormatter::BF_SCALED2INT_POSITION_2D || t == BinaryFormatter::BF_SCALED2INT_POSITION_2D) {
+    if (t == BinaryFormatter::BF_SCALED2INT_POSITION_2D || t == BinaryFormatter::BF_SCALED2INT_POSITION_3D) {
         int v;
-        os.myStream.read((char*) &v, sizeof(int));
+        os.readBytes(&v, sizeof(int));
         x = v / 100.;
-        os.myStream.read((char*) &v, sizeof(int));
+        os.readBytes(&v, sizeof(int));
         y = v / 100.;
         if (t == BinaryFormatter::BF_SCALED2INT_POSITION_3D) {
-            os.myStream.read((char*) &v, sizeof(int));
+            os.readBytes(&v, sizeof(int));
             z = v / 100.;
         }
     } else {
-        os.myStream.read((char*) &x, sizeof(double));
-        os.myStream.read((char*) &y, sizeof(double));
+        os.readBytes(&x, sizeof(double));
+        os.readBytes(&y, sizeof(double));
         if (t == BinaryFormatter::BF_POSITION_3D) {
-            os.myStream.read((char*) &z, sizeof(double));
+            os.readBytes(&z, sizeof(double));
         }
     }
     p.set(x, y, z);
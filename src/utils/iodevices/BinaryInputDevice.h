@@ -31,7 +31,6 @@
 
 #include <string>
 #include <vector>
-#include <fstream>
 #include "BinaryFormatter.h"
 
 
@@ -48,8 +47,10 @@ class BinaryInputDevice;
  * @class BinaryInputDevice
  * @brief Encapsulates binary reading operations on a file
  *
- * This class opens a binary file stream for reading and offers read access
- *  functions on it.
+ * This class makes the complete content of a binary file available in memory
+ *  and offers read access functions on it. Where possible the file is mapped
+ *  into memory (mmap) so large files (e.g. binary networks or states) are
+ *  paged in on demand instead of being copied, otherwise it is read at once.
  *
  * Please note that the byte order is undefined. Also the length of each
  *  type is not defined on a global scale and may differ across compilers or
@@ -72,7 +73,7 @@ public:
     ~BinaryInputDevice();
 
 
-    /** @brief Returns whether the underlying file stream can be used (is good())
+    /** @brief Returns whether the file could be opened and no read went beyond its end
      *
      * @return Whether the file is good
      */
@@ -81,6 +82,7 @@ public:
 
     /** @brief Returns the next character to be read by an actual parse.
      *
+     * At the end of the data EOF is returned and the device is not good anymore.
      * @return the next character which will be returned
      */
     int peek();
@@ -96,11 +98,21 @@ public:
 
     /** @brief Pushes a character back into the stream to be read by the next actual parse.
      *
+     * The character replaces the last one read (the data is a private copy).
      * @param[in] c The char to store in the stream
      */
     void putback(char c);
 
 
+    /** @brief Replaces the type marker at the current position.
+     *
+     * Used for markers which are followed by a value of a basic type
+     *  (e.g. the tag of an xml element or the index of an edge).
+     * @param[in] t The type of the value following the marker
+     */
+    void retype(BinaryFormatter::DataType t);
+
+
     /** @brief Reads a char from the file (input operator)
      *
      * @param[in, out] os The BinaryInputDevice to read the char from
@@ -217,18 +229,55 @@ public:
 private:
     int checkType(BinaryFormatter::DataType t);
 
+    /** @brief Returns whether the found type stores a value of the expected type in another representation
+     *
+     * @param[in] expected The basic type the reader wants to read
+     * @param[in] found The type marker found in the data
+     * @return whether the found type is a scaled or three dimensional variant of the expected one
+     */
+    static bool isCompatible(BinaryFormatter::DataType expected, int found);
+
+    /** @brief Copies the given number of bytes from the current position
+     *
+     * If the end of the data is reached the remaining bytes are zeroed and
+     *  the device is not good anymore.
+     * @param[out] into The memory to copy to
+     * @param[in] numBytes The number of bytes to copy
+     */
+    void readBytes(void* into, const int numBytes);
+
 private:
-    /// @brief The encapsulated stream
-    std::ifstream myStream;
+    /// @brief The file content (either a private mapping or pointing into myContent)
+    char* myData;
+
+    /// @brief The size of the file content
+    long long int mySize;
+
+    /// @brief The current read position
+    long long int myPos;
+
+    /// @brief Whether myData is a memory mapping which needs to be released
+    bool myAmMapped;
+
+    /// @brief Whether the file could be opened and all reads succeeded
+    bool myAmGood;
+
+    /// @brief The file content if it could not be mapped
+    std::vector<char> myContent;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    BinaryInputDevice(const BinaryInputDevice&);
+
+    /// @brief Invalidated assignment operator.
+    BinaryInputDevice& operator=(const BinaryInputDevice&);
 
     const bool myAmTyped;
 
     /// @brief Information whether types shall be checked
     const bool myEnableValidation;
 
-    /// @brief The buffer used for string parsing
-    char myBuffer[10000];
-
 };
 
 
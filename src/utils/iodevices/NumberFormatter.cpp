@@ -0,0 +1,160 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    NumberFormatter.cpp
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// Fast conversion of numbers into their textual output representation
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utils/common/ToString.h>
+#include <utils/geom/PositionVector.h>
+#include "NumberFormatter.h"
+
+
+// ===========================================================================
+// static members
+// ===========================================================================
+static const double POW10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15
+};
+
+static const unsigned long long int INT_POW10[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+    1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL
+};
+
+// scaled values need to stay below 2^52 for the integer part to be exact
+static const double MAX_SCALED = 4503599627370496.;
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+int
+NumberFormatter::format(char* buffer, const double v, const int precision) {
+    if (precision < 0 || precision > MAX_PRECISION) {
+        return -1;
+    }
+    const double scaled = fabs(v) * POW10[precision];
+    if (!(scaled < MAX_SCALED)) {
+        // too large, inf or nan
+        return -1;
+    }
+    const double intPart = floor(scaled);
+    const double frac = scaled - intPart;
+    // the product deviates from the exact one by at most half an ulp,
+    // so the stream might round differently only if we are that close to a tie
+    if (fabs(frac - 0.5) <= scaled * std::numeric_limits<double>::epsilon()) {
+        return -1;
+    }
+    const unsigned long long int rounded = (unsigned long long int)intPart + (frac > 0.5 ? 1 : 0);
+    char* const end = buffer + BUFFER_SIZE;
+    char* pos = end;
+    if (precision > 0) {
+        unsigned long long int decimals = rounded % INT_POW10[precision];
+        for (int i = 0; i < precision; i++) {
+            *--pos = (char)('0' + decimals % 10);
+            decimals /= 10;
+        }
+        *--pos = '.';
+    }
+    pos = writeDigits(pos, rounded / INT_POW10[precision]);
+    if (std::signbit(v)) {
+        *--pos = '-';
+    }
+    const int length = (int)(end - pos);
+    memmove(buffer, pos, length);
+    return length;
+}
+
+
+int
+NumberFormatter::format(char* buffer, const long long int v) {
+    char* const end = buffer + BUFFER_SIZE;
+    char* pos = writeDigits(end, v < 0 ? 0ULL - (unsigned long long int)v : (unsigned long long int)v);
+    if (v < 0) {
+        *--pos = '-';
+    }
+    const int length = (int)(end - pos);
+    memmove(buffer, pos, length);
+    return length;
+}
+
+
+void
+NumberFormatter::write(std::ostream& into, const double v, const int precision) {
+    char buffer[BUFFER_SIZE];
+    const int length = format(buffer, v, precision);
+    if (length < 0) {
+        into << toString(v, precision);
+    } else {
+        into.write(buffer, length);
+    }
+}
+
+
+void
+NumberFormatter::write(std::ostream& into, const long long int v) {
+    char buffer[BUFFER_SIZE];
+    into.write(buffer, format(buffer, v));
+}
+
+
+void
+NumberFormatter::write(std::ostream& into, const Position& p, const int precision) {
+    write(into, p.x(), precision);
+    into.put(',');
+    write(into, p.y(), precision);
+    if (p.z() != double(0.0)) {
+        into.put(',');
+        write(into, p.z(), precision);
+    }
+}
+
+
+void
+NumberFormatter::write(std::ostream& into, const PositionVector& v, const int precision) {
+    for (PositionVector::const_iterator i = v.begin(); i != v.end(); ++i) {
+        if (i != v.begin()) {
+            into.put(' ');
+        }
+        write(into, *i, precision);
+    }
+}
+
+
+char*
+NumberFormatter::writeDigits(char* end, unsigned long long int v) {
+    do {
+        *--end = (char)('0' + v % 10);
+        v /= 10;
+    } while (v > 0);
+    return end;
+}
+
+
+/****************************************************************************/
+
@@ -0,0 +1,105 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    NumberFormatter.h
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// Fast conversion of numbers into their textual output representation
+/****************************************************************************/
+#ifndef NumberFormatter_h
+#define NumberFormatter_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <iostream>
+
+
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class Position;
+class PositionVector;
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class NumberFormatter
+ * @brief Writes numbers into a char buffer without using the state of a stream
+ *
+ * The result is byte-identical to the output of a stream in fixed format with
+ *  the given precision (as written by toString). Doubles are scaled to an
+ *  integer and written digit by digit. Values where the rounding of this
+ *  scaling might change the last digit (almost exact ties), huge values,
+ *  precisions above MAX_PRECISION as well as nan and inf are formatted by
+ *  the stream instead.
+ */
+class NumberFormatter {
+public:
+    /// @brief The size of a buffer which is sufficient for every number written by format
+    static const int BUFFER_SIZE = 32;
+
+    /// @brief The largest precision handled without the stream
+    static const int MAX_PRECISION = 15;
+
+    /** @brief Writes the double in fixed format with the given precision into the buffer
+     *
+     * @param[in] buffer The buffer to write into (at least BUFFER_SIZE chars)
+     * @param[in] v The value to write
+     * @param[in] precision The number of digits behind the '.'
+     * @return The number of chars written or -1 if the value needs to be formatted by a stream
+     */
+    static int format(char* buffer, const double v, const int precision);
+
+    /** @brief Writes the integer into the buffer
+     *
+     * @param[in] buffer The buffer to write into (at least BUFFER_SIZE chars)
+     * @param[in] v The value to write
+     * @return The number of chars written
+     */
+    static int format(char* buffer, const long long int v);
+
+    /// @brief Writes the double in fixed format with the given precision to the stream
+    static void write(std::ostream& into, const double v, const int precision);
+
+    /// @brief Writes the integer to the stream
+    static void write(std::ostream& into, const long long int v);
+
+    /// @brief Writes the position as "x,y[,z]" with the given precision to the stream
+    static void write(std::ostream& into, const Position& p, const int precision);
+
+    /// @brief Writes the positions separated by a blank with the given precision to the stream
+    static void write(std::ostream& into, const PositionVector& v, const int precision);
+
+private:
+    /// @brief Writes the digits of the unsigned value to the end of the buffer and returns the position of the first digit
+    static char* writeDigits(char* end, unsigned long long int v);
+
+private:
+    /// @brief Invalidated constructor.
+    NumberFormatter();
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
@@ -28,6 +28,8 @@
 
 #include <utils/common/ToString.h>
 #include <utils/options/OptionsCont.h>
+#include <utils/geom/PositionVector.h>
+#include "NumberFormatter.h"
 #include "PlainXMLFormatter.h"
 
 
@@ -110,5 +112,43 @@ PlainXMLFormatter::writePreformattedTag(std::ostream& into, const std::string& v
     into << val;
 }
 
+
+template<>
+void PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const double& val) {
+    into << " " << toString(attr) << "=\"";
+    NumberFormatter::write(into, val, (int)into.precision());
+    into << "\"";
+}
+
+
+template<>
+void PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const int& val) {
+    into << " " << toString(attr) << "=\"";
+    NumberFormatter::write(into, (long long int)val);
+    into << "\"";
+}
+
+
+template<>
+void PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const std::string& val) {
+    into << " " << toString(attr) << "=\"" << val << "\"";
+}
+
+
+template<>
+void PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const Position& val) {
+    into << " " << toString(attr) << "=\"";
+    NumberFormatter::write(into, val, (int)into.precision());
+    into << "\"";
+}
+
+
+template<>
+void PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const PositionVector& val) {
+    into << " " << toString(attr) << "=\"";
+    NumberFormatter::write(into, val, (int)into.precision());
+    into << "\"";
+}
+
 /****************************************************************************/
 
@@ -31,6 +31,13 @@
 #include "OutputFormatter.h"
 
 
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class Position;
+class PositionVector;
+
+
 // ===========================================================================
 // class definitions
 // ===========================================================================
@@ -128,6 +135,9 @@ public:
 
 
     /** @brief writes a named attribute
+     *
+     * Numbers and positions are written by the NumberFormatter (see the
+     *  specializations below), everything else via toString.
      *
      * @param[in] into The output stream to use
      * @param[in] attr The attribute (name)
@@ -151,6 +161,13 @@ private:
 };
 
 
+template<> void PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const double& val);
+template<> void PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const int& val);
+template<> void PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const std::string& val);
+template<> void PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const Position& val);
+template<> void PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const PositionVector& val);
+
+
 #endif
 
 /****************************************************************************/
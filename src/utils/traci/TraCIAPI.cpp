@@ -28,6 +28,7 @@
 #include <config.h>
 #endif
 
+#include <foreign/tcpip/shmsocket.h>
 #include "TraCIAPI.h"
 
 using namespace libsumo;
@@ -74,6 +75,19 @@ TraCIAPI::connect(const std::string& host, int port) {
 }
 
 
+void
+TraCIAPI::connectSharedMemory(const std::string& name) {
+    mySocket = new tcpip::SharedMemorySocket(name);
+    try {
+        mySocket->connect();
+    } catch (tcpip::SocketException&) {
+        delete mySocket;
+        mySocket = 0;
+        throw;
+    }
+}
+
+
 void
 TraCIAPI::setOrder(int order) {
     tcpip::Storage outMsg;
@@ -225,7 +239,7 @@ TraCIAPI::send_commandSubscribeObjectVariable(int domID, const std::string& objI
 
 void
 TraCIAPI::send_commandSubscribeObjectContext(int domID, const std::string& objID, SUMOTime beginTime, SUMOTime endTime,
-        int domain, double range, const std::vector<int>& vars) const {
+        int domain, double range, const std::vector<int>& vars, const bool columnar) const {
     if (mySocket == 0) {
         throw tcpip::SocketException("Socket is not initialised");
     }
@@ -233,8 +247,11 @@ TraCIAPI::send_commandSubscribeObjectContext(int domID, const std::string& objID
     // command length (domID, objID, beginTime, endTime, length, vars)
     int varNo = (int) vars.size();
     outMsg.writeUnsignedByte(0);
-    outMsg.writeInt(5 + 1 + 4 + 4 + 4 + (int) objID.length() + 1 + 8 + 1 + varNo);
+    outMsg.writeInt(5 + 1 + 4 + 4 + 4 + (int) objID.length() + 1 + 8 + 1 + varNo + (columnar ? 1 : 0));
     // command id
+    if (columnar) {
+        outMsg.writeUnsignedByte(CMD_SUBSCRIBE_COLUMNAR_CONTEXT);
+    }
     outMsg.writeUnsignedByte(domID);
     // time
     outMsg.writeInt((int)beginTime);
@@ -495,6 +512,48 @@ TraCIAPI::getColor(int cmd, int var, const std::string& id, tcpip::Storage* add)
     return c;
 }
 
+
+TraCIAPI::SubscribedValues
+TraCIAPI::getBulk(int cmd, int var, const std::vector<std::string>& ids, tcpip::Storage* add) {
+    if (mySocket == 0) {
+        throw tcpip::SocketException("Socket is not initialised");
+    }
+    tcpip::Storage outMsg;
+    // command length (get command, variable, ids, additional values)
+    int length = 1 + 4 + 1 + 1 + 1 + 1 + 4;
+    for (std::vector<std::string>::const_iterator i = ids.begin(); i != ids.end(); ++i) {
+        length += 4 + (int)i->length();
+    }
+    if (add != 0) {
+        length += (int)add->size();
+    }
+    outMsg.writeUnsignedByte(0);
+    outMsg.writeInt(length);
+    // command id
+    outMsg.writeUnsignedByte(CMD_GET_BULK_VARIABLE);
+    outMsg.writeUnsignedByte(cmd);
+    outMsg.writeUnsignedByte(var);
+    // object ids
+    outMsg.writeUnsignedByte(TYPE_STRINGLIST);
+    outMsg.writeStringList(ids);
+    // additional values
+    if (add != 0) {
+        outMsg.writeStorage(*add);
+    }
+    mySocket->sendExact(outMsg);
+    tcpip::Storage inMsg;
+    check_resultState(inMsg, CMD_GET_BULK_VARIABLE);
+    check_commandGetResult(inMsg, CMD_GET_BULK_VARIABLE);
+    inMsg.readUnsignedByte(); // get command
+    inMsg.readUnsignedByte(); // variable
+    const int numObjects = inMsg.readInt();
+    SubscribedValues result;
+    for (int i = 0; i < numObjects; ++i) {
+        readVariables(inMsg, ids[i], 1, result);
+    }
+    return result;
+}
+
 void
 TraCIAPI::readVariables(tcpip::Storage& inMsg, const std::string& objectID, int variableCount, SubscribedValues& into) {
     while (variableCount > 0) {
@@ -504,49 +563,8 @@ TraCIAPI::readVariables(tcpip::Storage& inMsg, const std::string& objectID, int
         const int type = inMsg.readUnsignedByte();
 
         if (status == RTYPE_OK) {
-
             TraCIValue v;
-
-            switch (type) {
-                case TYPE_DOUBLE:
-                    v.scalar = inMsg.readDouble();
-                    break;
-                case TYPE_STRING:
-                    v.string = inMsg.readString();
-                    break;
-                case POSITION_2D:
-                    v.position.x = inMsg.readDouble();
-                    v.position.y = inMsg.readDouble();
-                    v.position.z = 0;
-                    break;
-                case POSITION_3D:
-                    v.position.x = inMsg.readDouble();
-                    v.position.y = inMsg.readDouble();
-                    v.position.z = inMsg.readDouble();
-                    break;
-                case TYPE_COLOR:
-                    v.color.r = (unsigned char)inMsg.readUnsignedByte();
-                    v.color.g = (unsigned char)inMsg.readUnsignedByte();
-                    v.color.b = (unsigned char)inMsg.readUnsignedByte();
-                    v.color.a = (unsigned char)inMsg.readUnsignedByte();
-                    break;
-                case TYPE_INTEGER:
-                    v.scalar = inMsg.readInt();
-                    break;
-                case TYPE_STRINGLIST: {
-                    int n = inMsg.readInt();
-                    for (int i = 0; i < n; ++i) {
-                        v.stringList.push_back(inMsg.readString());
-                    }
-                }
-                break;
-
-                // TODO Other data types
-
-                default:
-                    throw tcpip::SocketException("Unimplemented subscription type: " + toString(type));
-            }
-
+            readValue(inMsg, type, v);
             into[objectID][variableID] = v;
         } else {
             throw tcpip::SocketException("Subscription response error: variableID=" + toString(variableID) + " status=" + toString(status));
@@ -556,6 +574,49 @@ TraCIAPI::readVariables(tcpip::Storage& inMsg, const std::string& objectID, int
     }
 }
 
+void
+TraCIAPI::readValue(tcpip::Storage& inMsg, int type, TraCIValue& v) {
+    switch (type) {
+        case TYPE_DOUBLE:
+            v.scalar = inMsg.readDouble();
+            break;
+        case TYPE_STRING:
+            v.string = inMsg.readString();
+            break;
+        case POSITION_2D:
+            v.position.x = inMsg.readDouble();
+            v.position.y = inMsg.readDouble();
+            v.position.z = 0;
+            break;
+        case POSITION_3D:
+            v.position.x = inMsg.readDouble();
+            v.position.y = inMsg.readDouble();
+            v.position.z = inMsg.readDouble();
+            break;
+        case TYPE_COLOR:
+            v.color.r = (unsigned char)inMsg.readUnsignedByte();
+            v.color.g = (unsigned char)inMsg.readUnsignedByte();
+            v.color.b = (unsigned char)inMsg.readUnsignedByte();
+            v.color.a = (unsigned char)inMsg.readUnsignedByte();
+            break;
+        case TYPE_INTEGER:
+            v.scalar = inMsg.readInt();
+            break;
+        case TYPE_STRINGLIST: {
+            int n = inMsg.readInt();
+            for (int i = 0; i < n; ++i) {
+                v.stringList.push_back(inMsg.readString());
+            }
+        }
+        break;
+
+        // TODO Other data types
+
+        default:
+            throw tcpip::SocketException("Unimplemented subscription type: " + toString(type));
+    }
+}
+
 void
 TraCIAPI::readVariableSubscription(tcpip::Storage& inMsg) {
     const std::string objectID = inMsg.readString();
@@ -577,6 +638,50 @@ TraCIAPI::readContextSubscription(tcpip::Storage& inMsg) {
     }
 }
 
+void
+TraCIAPI::readColumnarContextSubscription(tcpip::Storage& inMsg) {
+    inMsg.readUnsignedByte(); // context subscription response
+    const std::string contextID = inMsg.readString();
+    inMsg.readUnsignedByte(); // context domain
+    int variableCount = inMsg.readUnsignedByte();
+    libsumo::TraCIColumnarResults& into = mySubscribedColumnarValues[contextID];
+    into.ids = inMsg.readStringList();
+    const int numObjects = (int)into.ids.size();
+    if (numObjects == 0) {
+        return;
+    }
+    while (variableCount > 0) {
+        const int variableID = inMsg.readUnsignedByte();
+        const int status = inMsg.readUnsignedByte();
+        const int type = inMsg.readUnsignedByte();
+        if (status != RTYPE_OK) {
+            throw tcpip::SocketException("Subscription response error: variableID=" + toString(variableID) + " status=" + toString(status) + " " + inMsg.readString());
+        }
+        if (type == TYPE_DOUBLE || type == TYPE_INTEGER) {
+            std::vector<double>& column = into.scalars[variableID];
+            column.reserve(numObjects);
+            for (int i = 0; i < numObjects; ++i) {
+                column.push_back(type == TYPE_DOUBLE ? inMsg.readDouble() : inMsg.readInt());
+            }
+        } else if (type == POSITION_2D || type == POSITION_3D) {
+            std::vector<TraCIPosition>& column = into.positions[variableID];
+            column.resize(numObjects);
+            for (int i = 0; i < numObjects; ++i) {
+                column[i].x = inMsg.readDouble();
+                column[i].y = inMsg.readDouble();
+                column[i].z = type == POSITION_3D ? inMsg.readDouble() : 0.;
+            }
+        } else {
+            std::vector<TraCIValue>& column = into.values[variableID];
+            column.resize(numObjects);
+            for (int i = 0; i < numObjects; ++i) {
+                readValue(inMsg, type, column[i]);
+            }
+        }
+        variableCount--;
+    }
+}
+
 void
 TraCIAPI::simulationStep(SUMOTime time) {
     send_commandSimulationStep(time);
@@ -585,11 +690,14 @@ TraCIAPI::simulationStep(SUMOTime time) {
 
     mySubscribedValues.clear();
     mySubscribedContextValues.clear();
+    mySubscribedColumnarValues.clear();
     int numSubs = inMsg.readInt();
     while (numSubs > 0) {
         int cmdId = check_commandGetResult(inMsg, 0, -1, true);
         if (cmdId >= RESPONSE_SUBSCRIBE_INDUCTIONLOOP_VARIABLE && cmdId <= RESPONSE_SUBSCRIBE_PERSON_VARIABLE) {
             readVariableSubscription(inMsg);
+        } else if (cmdId == RESPONSE_SUBSCRIBE_COLUMNAR_CONTEXT) {
+            readColumnarContextSubscription(inMsg);
         } else {
             readContextSubscription(inMsg);
         }
@@ -1585,6 +1693,15 @@ TraCIAPI::SimulationScope::subscribeContext(int domID, const std::string& objID,
     myParent.readContextSubscription(inMsg);
 }
 
+void
+TraCIAPI::SimulationScope::subscribeColumnarContext(int domID, const std::string& objID, SUMOTime beginTime, SUMOTime endTime, int domain, double range, const std::vector<int>& vars) const {
+    myParent.send_commandSubscribeObjectContext(domID, objID, beginTime, endTime, domain, range, vars, true);
+    tcpip::Storage inMsg;
+    myParent.check_resultState(inMsg, CMD_SUBSCRIBE_COLUMNAR_CONTEXT);
+    myParent.check_commandGetResult(inMsg, CMD_SUBSCRIBE_COLUMNAR_CONTEXT);
+    myParent.readColumnarContextSubscription(inMsg);
+}
+
 const TraCIAPI::SubscribedValues
 TraCIAPI::SimulationScope::getSubscriptionResults() const {
     return myParent.mySubscribedValues;
@@ -1617,6 +1734,16 @@ TraCIAPI::SimulationScope::getContextSubscriptionResults(const std::string& objI
 }
 
 
+const libsumo::TraCIColumnarResults
+TraCIAPI::SimulationScope::getColumnarContextSubscriptionResults(const std::string& objID) const {
+    if (myParent.mySubscribedColumnarValues.find(objID) != myParent.mySubscribedColumnarValues.end()) {
+        return myParent.mySubscribedColumnarValues[objID];
+    } else {
+        return libsumo::TraCIColumnarResults();
+    }
+}
+
+
 // ---------------------------------------------------------------------------
 // TraCIAPI::TrafficLightScope-methods
 // ---------------------------------------------------------------------------
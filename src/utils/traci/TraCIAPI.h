@@ -74,6 +74,12 @@ public:
      */
     void connect(const std::string& host, int port);
 
+    /** @brief Connects to the SUMO server on the same host via shared memory
+     * @param[in] name The name of the shared memory segment (the value of sumo's option remote-shm)
+     * @exception tcpip::SocketException if the connection fails
+     */
+    void connectSharedMemory(const std::string& name);
+
     /// @brief set priority (execution order) for the client
     void setOrder(int order);
 
@@ -466,6 +472,17 @@ public:
     typedef std::map<int, libsumo::TraCIValue> TraCIValues;
     typedef std::map<std::string, TraCIValues> SubscribedValues;
     typedef std::map<std::string, SubscribedValues> SubscribedContextValues;
+    typedef std::map<std::string, libsumo::TraCIColumnarResults> SubscribedColumnarValues;
+
+
+    /** @brief Retrieves the given variable of all given objects within a single request
+     * @param[in] cmd The get command of the objects' domain
+     * @param[in] var The variable to retrieve
+     * @param[in] ids The objects to retrieve the variable from
+     * @param[in] add Optional additional parameter given for each object
+     * @return The values by object id and variable
+     */
+    SubscribedValues getBulk(int cmd, int var, const std::vector<std::string>& ids, tcpip::Storage* add = 0);
 
 
     /** @class SimulationScope
@@ -493,6 +510,8 @@ public:
 
         void subscribe(int domID, const std::string& objID, SUMOTime beginTime, SUMOTime endTime, const std::vector<int>& vars) const;
         void subscribeContext(int domID, const std::string& objID, SUMOTime beginTime, SUMOTime endTime, int domain, double range, const std::vector<int>& vars) const;
+        /// @brief subscribes to the context with the results ordered by variable, unsubscribe using subscribeContext
+        void subscribeColumnarContext(int domID, const std::string& objID, SUMOTime beginTime, SUMOTime endTime, int domain, double range, const std::vector<int>& vars) const;
 
         const SubscribedValues getSubscriptionResults() const;
         const TraCIValues getSubscriptionResults(const std::string& objID) const;
@@ -500,6 +519,8 @@ public:
         const SubscribedContextValues getContextSubscriptionResults() const;
         const SubscribedValues getContextSubscriptionResults(const std::string& objID) const;
 
+        const libsumo::TraCIColumnarResults getColumnarContextSubscriptionResults(const std::string& objID) const;
+
     private:
         /// @brief invalidated copy constructor
         SimulationScope(const SimulationScope& src);
@@ -882,9 +903,10 @@ protected:
      * @param[in] domain The domain of the objects which values shall be returned
      * @param[in] range The range around the obj to investigate
      * @param[in] vars The variables to subscribe
+     * @param[in] columnar Whether the results shall be ordered by variable
      */
     void send_commandSubscribeObjectContext(int domID, const std::string& objID, SUMOTime beginTime, SUMOTime endTime,
-                                            int domain, double range, const std::vector<int>& vars) const;
+                                            int domain, double range, const std::vector<int>& vars, const bool columnar = false) const;
     /// @}
 
 
@@ -913,7 +935,9 @@ protected:
 
     void readVariableSubscription(tcpip::Storage& inMsg);
     void readContextSubscription(tcpip::Storage& inMsg);
+    void readColumnarContextSubscription(tcpip::Storage& inMsg);
     void readVariables(tcpip::Storage& inMsg, const std::string& objectID, int variableCount, SubscribedValues& into);
+    static void readValue(tcpip::Storage& inMsg, int type, libsumo::TraCIValue& into);
 
     template <class T>
     static inline std::string toString(const T& t, std::streamsize accuracy = PRECISION) {
@@ -933,6 +957,7 @@ protected:
 
     SubscribedValues mySubscribedValues;
     SubscribedContextValues mySubscribedContextValues;
+    SubscribedColumnarValues mySubscribedColumnarValues;
 };
 
 
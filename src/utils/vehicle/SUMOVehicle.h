@@ -36,6 +36,7 @@
 #include <utils/vehicle/SUMOAbstractRouter.h>
 #include <utils/vehicle/SUMOVehicleParameter.h>
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/emissions/PollutantsInterface.h>
 
 
 // ===========================================================================
@@ -76,6 +77,9 @@ public:
 
     typedef Named::NamedLikeComparatorIdLess<SUMOVehicle> ComparatorIdLess;
 
+    /// @brief Type of the vehicles' numerical ids
+    typedef long long int NumericalID;
+
     /// @brief Destructor
     virtual ~SUMOVehicle() {}
 
@@ -84,6 +88,13 @@ public:
      */
     virtual const std::string& getID() const = 0;
 
+    /** @brief Get the vehicle's numerical ID
+     *
+     * The numerical id is unique during the whole simulation run and assigned in order of vehicle creation.
+     * @return The numerical ID of the vehicle
+     */
+    virtual NumericalID getNumericalID() const = 0;
+
     /** @brief Get the vehicle's position along the lane
      * @return The position of the vehicle (in m from the lane's begin)
      */
@@ -202,6 +213,15 @@ public:
      */
     virtual double getSlope() const = 0;
 
+    /** @brief Returns the vehicle's emissions when driving with the given speed in its current state
+     *
+     * The values are computed using the vehicle's acceleration and slope and
+     *  are reused as long as these and the speed do not change.
+     * @param[in] speed The speed to compute the emissions for
+     * @return The amount emitted per second [mg/s]
+     */
+    virtual const PollutantsInterface::Emissions& getEmissions(const double speed) const = 0;
+
     /** @brief Returns the edge the vehicle is currently at
      *
      * @return The current edge in the vehicle's route
@@ -57,6 +57,7 @@ GenericSAXHandler::GenericSAXHandler(
         assert(myPredefinedTags.find(attrs[i].key) == myPredefinedTags.end());
         myPredefinedTags[attrs[i].key] = convert(attrs[i].str);
         myPredefinedTagsMML[attrs[i].key] = attrs[i].str;
+        myPredefinedAttrIDs[attrs[i].str] = attrs[i].key;
         i++;
     }
 }
@@ -101,16 +102,22 @@ GenericSAXHandler::startElement(const XMLCh* const /*uri*/,
                                 const XERCES_CPP_NAMESPACE::Attributes& attrs) {
     std::string name = TplConvert::_2str(qname);
     int element = convertTag(name);
-    myCharactersVector.clear();
     SUMOSAXAttributesImpl_Xerces na(attrs, myPredefinedTags, myPredefinedTagsMML, name);
+    processStartElement(element, na);
+}
+
+
+void
+GenericSAXHandler::processStartElement(int element, const SUMOSAXAttributes& attrs) {
+    myCharactersVector.clear();
     if (element == SUMO_TAG_INCLUDE) {
-        std::string file = na.getString(SUMO_ATTR_HREF);
+        std::string file = attrs.getString(SUMO_ATTR_HREF);
         if (!FileHelpers::isAbsolute(file)) {
             file = FileHelpers::getConfigurationRelative(getFileName(), file);
         }
         XMLSubSys::runParser(*this, file);
     } else {
-        myStartElement(element, na);
+        myStartElement(element, attrs);
     }
 }
 
@@ -120,7 +127,12 @@ GenericSAXHandler::endElement(const XMLCh* const /*uri*/,
                               const XMLCh* const /*localname*/,
                               const XMLCh* const qname) {
     std::string name = TplConvert::_2str(qname);
-    int element = convertTag(name);
+    processEndElement(convertTag(name));
+}
+
+
+void
+GenericSAXHandler::processEndElement(int element) {
     // collect characters
     if (myCharactersVector.size() != 0) {
         int len = 0;
@@ -181,12 +193,28 @@ GenericSAXHandler::convertTag(const std::string& tag) const {
 }
 
 
+int
+GenericSAXHandler::convertAttr(const std::string& attr) const {
+    std::map<std::string, int>::const_iterator i = myPredefinedAttrIDs.find(attr);
+    if (i == myPredefinedAttrIDs.end()) {
+        return SUMO_ATTR_NOTHING;
+    }
+    return (*i).second;
+}
+
+
 std::string
 GenericSAXHandler::buildErrorMessage(const XERCES_CPP_NAMESPACE::SAXParseException& exception) {
+    return buildErrorMessage(exception, getFileName());
+}
+
+
+std::string
+GenericSAXHandler::buildErrorMessage(const XERCES_CPP_NAMESPACE::SAXParseException& exception, const std::string& file) {
     std::ostringstream buf;
     char* pMsg = XERCES_CPP_NAMESPACE::XMLString::transcode(exception.getMessage());
     buf << pMsg << std::endl;
-    buf << " In file '" << getFileName() << "'" << std::endl;
+    buf << " In file '" << file << "'" << std::endl;
     buf << " At line/column " << exception.getLineNumber() + 1
         << '/' << exception.getColumnNumber() << "." << std::endl;
     XERCES_CPP_NAMESPACE::XMLString::release(&pMsg);
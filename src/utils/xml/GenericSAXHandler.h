@@ -205,7 +205,19 @@ public:
     //@}
 
 
-    // Reader needs access to myStartElement, myEndElement
+    /**
+     * @brief Builds an error message for the given file
+     *
+     * Used by readers which report the errors of a file on behalf of the handler.
+     *
+     * @param[in] exception The occured exception to process
+     * @param[in] file The name of the file the exception occured in
+     * @return A string describing the given exception
+     */
+    static std::string buildErrorMessage(const XERCES_CPP_NAMESPACE::SAXParseException& exception, const std::string& file);
+
+
+    // Reader needs access to myStartElement, myEndElement and the event processing
     friend class SUMOSAXReader;
 
 
@@ -277,6 +289,34 @@ private:
     int convertTag(const std::string& tag) const;
 
 
+    /**
+     * @brief Converts an attribute name into its numerical representation
+     *
+     * @param[in] attr The string to convert
+     * @return The int-value that represents the string, SUMO_ATTR_NOTHING if the attribute is not known
+     */
+    int convertAttr(const std::string& attr) const;
+
+
+    /**
+     * @brief Processes an opening tag (including files or calling myStartElement)
+     *
+     * Called by "startElement" and by readers replaying previously parsed events.
+     * @param[in] element The opened element, given as a int
+     * @param[in] attrs The attributes of the element
+     */
+    void processStartElement(int element, const SUMOSAXAttributes& attrs);
+
+
+    /**
+     * @brief Processes a closing tag (reporting the collected characters and calling myEndElement)
+     *
+     * Called by "endElement" and by readers replaying previously parsed events.
+     * @param[in] element The closed element, given as a int
+     */
+    void processEndElement(int element);
+
+
 private:
     /// @name attributes parsing
     //@{
@@ -289,6 +329,9 @@ private:
 
     /// the map from ids to their string representation
     std::map<int, std::string> myPredefinedTagsMML;
+
+    /// the map from attribute names to their ids
+    std::map<std::string, int> myPredefinedAttrIDs;
     //@}
 
 
@@ -0,0 +1,494 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    PlainXMLReader.cpp
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// A fast non-validating streaming tokenizer for UTF-8 encoded XML files
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <utils/common/UtilExceptions.h>
+#include "PlainXMLReader.h"
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+const size_t PlainXMLReader::CHUNK_SIZE = 1 << 24;
+
+
+// ===========================================================================
+// helper functions
+// ===========================================================================
+static inline bool
+isWhite(const char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+PlainXMLReader::PlainXMLReader(const std::string& file)
+    : myFile(file), myStream(file.c_str(), std::ios::in | std::ios::binary),
+      myPos(0), myEnd(0), myAmSupported(false), myLine(1), mySeenRoot(false), myPendingEnd(false),
+      myDepth(0), myName(0), myCharacters(0), myCharactersLength(0) {
+    if (!myStream.good()) {
+        return;
+    }
+    // small files are read at once without allocating a full chunk
+    myStream.seekg(0, std::ios::end);
+    const std::streamoff size = myStream.tellg();
+    myStream.seekg(0, std::ios::beg);
+    myBuffer.resize((size > 0 && size < (std::streamoff)CHUNK_SIZE ? (size_t)size : CHUNK_SIZE) + 1);
+    fill();
+    if (myEnd == 0) {
+        // let xerces report empty files
+        return;
+    }
+    const unsigned char* const b = (const unsigned char*)&myBuffer[0];
+    if (myEnd >= 3 && b[0] == 0xEF && b[1] == 0xBB && b[2] == 0xBF) {
+        // UTF-8 byte order mark
+        myPos = 3;
+    } else if (myEnd >= 2 && (b[0] == 0 || b[1] == 0 || (b[0] == 0xFE && b[1] == 0xFF) || (b[0] == 0xFF && b[1] == 0xFE))) {
+        // UTF-16 or UTF-32
+        return;
+    }
+    if (strncmp(&myBuffer[myPos], "<?xml", 5) == 0) {
+        const size_t declEnd = findAfter("?>", myPos);
+        if (declEnd == std::string::npos) {
+            return;
+        }
+        const std::string decl(&myBuffer[myPos], declEnd - myPos);
+        const std::string::size_type encPos = decl.find("encoding");
+        if (encPos != std::string::npos) {
+            const std::string::size_type valueStart = decl.find_first_of("\"'", encPos);
+            if (valueStart == std::string::npos) {
+                return;
+            }
+            const std::string::size_type valueEnd = decl.find(decl[valueStart], valueStart + 1);
+            if (valueEnd == std::string::npos) {
+                return;
+            }
+            std::string encoding = decl.substr(valueStart + 1, valueEnd - valueStart - 1);
+            std::transform(encoding.begin(), encoding.end(), encoding.begin(), ::tolower);
+            if (encoding != "utf-8" && encoding != "utf8" && encoding != "us-ascii" && encoding != "ascii") {
+                return;
+            }
+        }
+    }
+    myAmSupported = true;
+}
+
+
+PlainXMLReader::~PlainXMLReader() {}
+
+
+bool
+PlainXMLReader::isSupported() const {
+    return myAmSupported;
+}
+
+
+PlainXMLReader::TokenType
+PlainXMLReader::next() {
+    if (myPendingEnd) {
+        myPendingEnd = false;
+        myEndName.swap(myElementStack[--myDepth]);
+        myName = myEndName.c_str();
+        return TOKEN_END;
+    }
+    while (true) {
+        if (myPos == myEnd && !fill()) {
+            if (myDepth > 0) {
+                error("The end of the file was reached while element '" + myElementStack[myDepth - 1] + "' is still open.");
+            }
+            if (!mySeenRoot) {
+                error("The file does not contain a root element.");
+            }
+            return TOKEN_EOF;
+        }
+        if (myBuffer[myPos] != '<') {
+            // character data up to the next markup or the end of the file
+            size_t end = myPos;
+            while (true) {
+                const char* const lt = (const char*)memchr(&myBuffer[end], '<', myEnd - end);
+                if (lt != 0) {
+                    end = lt - &myBuffer[0];
+                    break;
+                }
+                const size_t offset = myEnd - myPos;
+                if (!fill()) {
+                    end = myEnd;
+                    break;
+                }
+                end = myPos + offset;
+            }
+            const size_t begin = myPos;
+            countLines(begin, end);
+            myPos = end;
+            if (myDepth == 0) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (!isWhite(myBuffer[i])) {
+                        error("Character data is not allowed outside of the root element.");
+                    }
+                }
+                continue;
+            }
+            myCharacters = &myBuffer[begin];
+            myCharactersLength = (int)(decode(&myBuffer[begin], &myBuffer[end], false) - myCharacters);
+            return TOKEN_CHARACTERS;
+        }
+        size_t end = findMarkupEnd(myPos);
+        while (end == std::string::npos) {
+            const bool more = fill();
+            end = findMarkupEnd(myPos);
+            if (end == std::string::npos && !more) {
+                error("The end of the file was reached within markup.");
+            }
+        }
+        const size_t begin = myPos;
+        countLines(begin, end);
+        myPos = end;
+        char* const b = &myBuffer[begin];
+        if (b[1] == '!') {
+            if (strncmp(b, "<![CDATA[", 9) == 0) {
+                if (myDepth == 0) {
+                    error("CDATA sections are not allowed outside of the root element.");
+                }
+                // CDATA is delivered as is, only line ends are normalized
+                char* out = b + 9;
+                myCharacters = out;
+                char* const dataEnd = &myBuffer[end - 3];
+                for (char* in = out; in < dataEnd; ++in) {
+                    if (*in == '\r') {
+                        *out++ = '\n';
+                        if (in + 1 < dataEnd && in[1] == '\n') {
+                            ++in;
+                        }
+                    } else {
+                        *out++ = *in;
+                    }
+                }
+                myCharactersLength = (int)(out - myCharacters);
+                return TOKEN_CHARACTERS;
+            }
+            // comment or document type declaration
+            continue;
+        }
+        if (b[1] == '?') {
+            // processing instruction or xml declaration
+            continue;
+        }
+        if (b[1] == '/') {
+            char* const name = b + 2;
+            char* nameEnd = &myBuffer[end - 1];
+            while (nameEnd > name && isWhite(nameEnd[-1])) {
+                --nameEnd;
+            }
+            *nameEnd = 0;
+            if (myDepth == 0) {
+                error("Found end of element '" + std::string(name) + "' without matching start.");
+            }
+            if (myElementStack[myDepth - 1] != name) {
+                error("Expected end of element '" + myElementStack[myDepth - 1] + "' but found '" + std::string(name) + "'.");
+            }
+            myEndName.swap(myElementStack[--myDepth]);
+            myName = myEndName.c_str();
+            return TOKEN_END;
+        }
+        if (myDepth == 0 && mySeenRoot) {
+            error("Only one root element is allowed.");
+        }
+        const bool isEmpty = myBuffer[end - 2] == '/';
+        parseTag(begin + 1, isEmpty ? end - 2 : end - 1);
+        mySeenRoot = true;
+        if (myDepth == (int)myElementStack.size()) {
+            myElementStack.push_back(myName);
+        } else {
+            myElementStack[myDepth].assign(myName);
+        }
+        myDepth++;
+        myPendingEnd = isEmpty;
+        return TOKEN_START;
+    }
+}
+
+
+bool
+PlainXMLReader::fill() {
+    if (!myStream.good()) {
+        return false;
+    }
+    if (myPos > 0) {
+        memmove(&myBuffer[0], &myBuffer[myPos], myEnd - myPos);
+        myEnd -= myPos;
+        myPos = 0;
+    }
+    if (myEnd == myBuffer.size() - 1) {
+        myBuffer.resize(2 * (myBuffer.size() - 1) + 1);
+    }
+    myStream.read(&myBuffer[myEnd], myBuffer.size() - 1 - myEnd);
+    const size_t read = (size_t)myStream.gcount();
+    myEnd += read;
+    myBuffer[myEnd] = 0;
+    return read > 0;
+}
+
+
+size_t
+PlainXMLReader::findMarkupEnd(size_t pos) const {
+    if (myEnd - pos < 9 && myStream.good()) {
+        // too short to decide what kind of markup this is
+        return std::string::npos;
+    }
+    const char* const b = &myBuffer[0];
+    if (strncmp(b + pos, "<!--", 4) == 0) {
+        return findAfter("-->", pos + 4);
+    }
+    if (strncmp(b + pos, "<![CDATA[", 9) == 0) {
+        return findAfter("]]>", pos + 9);
+    }
+    if (b[pos + 1] == '?') {
+        return findAfter("?>", pos + 2);
+    }
+    if (b[pos + 1] == '!') {
+        // document type declaration, the internal subset may contain '>'
+        bool inSubset = false;
+        for (size_t i = pos + 2; i < myEnd; ++i) {
+            if (b[i] == '[') {
+                inSubset = true;
+            } else if (b[i] == ']') {
+                inSubset = false;
+            } else if (b[i] == '>' && !inSubset) {
+                return i + 1;
+            }
+        }
+        return std::string::npos;
+    }
+    // a tag, attribute values may contain '>'
+    char quote = 0;
+    for (size_t i = pos + 1; i < myEnd; ++i) {
+        const char c = b[i];
+        if (quote != 0) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '>') {
+            return i + 1;
+        }
+    }
+    return std::string::npos;
+}
+
+
+size_t
+PlainXMLReader::findAfter(const char* what, size_t pos) const {
+    const char* const b = &myBuffer[0];
+    const size_t length = strlen(what);
+    const char* const found = std::search(b + pos, b + myEnd, what, what + length);
+    if (found == b + myEnd) {
+        return std::string::npos;
+    }
+    return found - b + length;
+}
+
+
+void
+PlainXMLReader::parseTag(size_t begin, size_t end) {
+    char* p = &myBuffer[begin];
+    char* const e = &myBuffer[end];
+    myName = p;
+    while (p < e && !isWhite(*p)) {
+        ++p;
+    }
+    if (p == myName) {
+        error("Missing element name.");
+    }
+    myAttrNames.clear();
+    myAttrValues.clear();
+    if (p == e) {
+        *p = 0;
+        return;
+    }
+    *p++ = 0;
+    while (true) {
+        while (p < e && isWhite(*p)) {
+            ++p;
+        }
+        if (p == e) {
+            return;
+        }
+        char* const name = p;
+        while (p < e && *p != '=' && !isWhite(*p)) {
+            ++p;
+        }
+        char* const nameEnd = p;
+        while (p < e && isWhite(*p)) {
+            ++p;
+        }
+        if (p == e || *p != '=') {
+            error("Expected '=' after attribute '" + std::string(name, nameEnd) + "' of element '" + std::string(myName) + "'.");
+        }
+        ++p;
+        *nameEnd = 0;
+        while (p < e && isWhite(*p)) {
+            ++p;
+        }
+        if (p == e || (*p != '"' && *p != '\'')) {
+            error("Expected a quoted value for attribute '" + std::string(name) + "' of element '" + std::string(myName) + "'.");
+        }
+        const char quote = *p++;
+        char* const value = p;
+        while (p < e && *p != quote) {
+            ++p;
+        }
+        if (p == e) {
+            error("Unterminated value for attribute '" + std::string(name) + "' of element '" + std::string(myName) + "'.");
+        }
+        *decode(value, p, true) = 0;
+        ++p;
+        for (std::vector<const char*>::const_iterator i = myAttrNames.begin(); i != myAttrNames.end(); ++i) {
+            if (strcmp(*i, name) == 0) {
+                error("Attribute '" + std::string(name) + "' is already specified for element '" + std::string(myName) + "'.");
+            }
+        }
+        myAttrNames.push_back(name);
+        myAttrValues.push_back(value);
+    }
+}
+
+
+char*
+PlainXMLReader::decode(char* begin, char* end, const bool isAttribute) {
+    // skip the (usually complete) part which needs no decoding
+    char* in = begin;
+    while (in < end && *in != '&' && *in != '\r' && !(isAttribute && (*in == '\n' || *in == '\t'))) {
+        ++in;
+    }
+    char* out = in;
+    while (in < end) {
+        const char c = *in;
+        if (c == '&') {
+            const char* const semi = (const char*)memchr(in, ';', end - in);
+            if (semi == 0) {
+                error("Unterminated entity reference.");
+            }
+            const char* const ref = in + 1;
+            const size_t length = semi - ref;
+            if (length == 2 && strncmp(ref, "lt", 2) == 0) {
+                *out++ = '<';
+            } else if (length == 2 && strncmp(ref, "gt", 2) == 0) {
+                *out++ = '>';
+            } else if (length == 3 && strncmp(ref, "amp", 3) == 0) {
+                *out++ = '&';
+            } else if (length == 4 && strncmp(ref, "quot", 4) == 0) {
+                *out++ = '"';
+            } else if (length == 4 && strncmp(ref, "apos", 4) == 0) {
+                *out++ = '\'';
+            } else if (length > 1 && ref[0] == '#') {
+                // character reference, the UTF-8 encoding is never longer than the reference
+                const bool hex = ref[1] == 'x';
+                const char* digit = hex ? ref + 2 : ref + 1;
+                bool valid = digit < semi;
+                unsigned long codePoint = 0;
+                for (; digit < semi && valid && codePoint <= 0x10FFFF; ++digit) {
+                    const char d = *digit;
+                    if (d >= '0' && d <= '9') {
+                        codePoint = codePoint * (hex ? 16 : 10) + (d - '0');
+                    } else if (hex && d >= 'a' && d <= 'f') {
+                        codePoint = codePoint * 16 + (d - 'a' + 10);
+                    } else if (hex && d >= 'A' && d <= 'F') {
+                        codePoint = codePoint * 16 + (d - 'A' + 10);
+                    } else {
+                        valid = false;
+                    }
+                }
+                if (!valid || codePoint == 0 || codePoint > 0x10FFFF) {
+                    error("Invalid character reference '&" + std::string(ref, length) + ";'.");
+                }
+                out = appendUTF8(out, codePoint);
+            } else {
+                error("Unknown entity '&" + std::string(ref, length) + ";'.");
+            }
+            in = (char*)semi + 1;
+        } else if (c == '\r') {
+            *out++ = isAttribute ? ' ' : '\n';
+            if (in + 1 < end && in[1] == '\n') {
+                ++in;
+            }
+            ++in;
+        } else if (isAttribute && (c == '\n' || c == '\t')) {
+            *out++ = ' ';
+            ++in;
+        } else {
+            *out++ = c;
+            ++in;
+        }
+    }
+    return out;
+}
+
+
+char*
+PlainXMLReader::appendUTF8(char* out, unsigned long codePoint) {
+    if (codePoint < 0x80) {
+        *out++ = (char)codePoint;
+    } else if (codePoint < 0x800) {
+        *out++ = (char)(0xC0 | (codePoint >> 6));
+        *out++ = (char)(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+        *out++ = (char)(0xE0 | (codePoint >> 12));
+        *out++ = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = (char)(0x80 | (codePoint & 0x3F));
+    } else {
+        *out++ = (char)(0xF0 | (codePoint >> 18));
+        *out++ = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+        *out++ = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = (char)(0x80 | (codePoint & 0x3F));
+    }
+    return out;
+}
+
+
+void
+PlainXMLReader::countLines(size_t begin, size_t end) {
+    myLine += (int)std::count(myBuffer.begin() + begin, myBuffer.begin() + end, '\n');
+}
+
+
+void
+PlainXMLReader::error(const std::string& message) const {
+    std::ostringstream buf;
+    buf << message << std::endl;
+    buf << " In file '" << myFile << "'" << std::endl;
+    buf << " At line " << myLine << "." << std::endl;
+    throw ProcessError(buf.str());
+}
+
+
+/****************************************************************************/
+
@@ -0,0 +1,257 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    PlainXMLReader.h
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// A fast non-validating streaming tokenizer for UTF-8 encoded XML files
+/****************************************************************************/
+#ifndef PlainXMLReader_h
+#define PlainXMLReader_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <fstream>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class PlainXMLReader
+ * @brief A fast non-validating streaming tokenizer for UTF-8 encoded XML files
+ *
+ * The file is read in large chunks into a buffer which is tokenized in place:
+ *  names and attribute values are terminated and entities are decoded
+ *  within the buffer, so reading an element does not allocate memory. The
+ *  pointers returned by the access methods are only valid until the next
+ *  call of next().
+ *
+ * Comments, processing instructions and the document type declaration are
+ *  skipped, there is neither validation nor support for entity definitions.
+ *  Files which are not encoded in UTF-8 (or ASCII) are not supported (see
+ *  isSupported), they have to be read using xerces.
+ */
+class PlainXMLReader {
+public:
+    /// @brief The types of tokens
+    enum TokenType {
+        /// @brief an opening tag (an empty element is returned as opening and closing tag)
+        TOKEN_START,
+        /// @brief a closing tag
+        TOKEN_END,
+        /// @brief character data (text or CDATA) within an element
+        TOKEN_CHARACTERS,
+        /// @brief the end of the file
+        TOKEN_EOF
+    };
+
+    /** @brief Constructor, opens the file and reads the first chunk
+     *
+     * @param[in] file The name of the file to read
+     */
+    PlainXMLReader(const std::string& file);
+
+
+    /// @brief Destructor
+    ~PlainXMLReader();
+
+
+    /** @brief Returns whether the file could be opened and its encoding can be read
+     *
+     * @return Whether the file can be parsed by this reader
+     */
+    bool isSupported() const;
+
+
+    /** @brief Reads the next token
+     *
+     * @return The type of the token read
+     * @exception ProcessError If the file is not well formed
+     */
+    TokenType next();
+
+
+    /// @brief Returns the name of the current opening or closing tag
+    const char* getName() const {
+        return myName;
+    }
+
+
+    /// @brief Returns the number of attributes of the current opening tag
+    int getNumAttributes() const {
+        return (int)myAttrNames.size();
+    }
+
+
+    /// @brief Returns the name of the i-th attribute of the current opening tag
+    const char* getAttributeName(int i) const {
+        return myAttrNames[i];
+    }
+
+
+    /// @brief Returns the (decoded) value of the i-th attribute of the current opening tag
+    const char* getAttributeValue(int i) const {
+        return myAttrValues[i];
+    }
+
+
+    /// @brief Returns the names of the attributes of the current opening tag
+    const std::vector<const char*>& getAttributeNames() const {
+        return myAttrNames;
+    }
+
+
+    /// @brief Returns the values of the attributes of the current opening tag
+    const std::vector<const char*>& getAttributeValues() const {
+        return myAttrValues;
+    }
+
+
+    /// @brief Returns the current (decoded) character data, it is not 0-terminated
+    const char* getCharacters() const {
+        return myCharacters;
+    }
+
+
+    /// @brief Returns the length of the current character data
+    int getCharactersLength() const {
+        return myCharactersLength;
+    }
+
+
+private:
+    /** @brief Moves the unprocessed data to the front of the buffer and appends data from the file
+     *
+     * The buffer is enlarged if it is completely filled with unprocessed data.
+     * @return Whether more data could be read
+     */
+    bool fill();
+
+
+    /** @brief Searches the end of the markup starting at the given buffer position
+     *
+     * @param[in] pos The position of the '<'
+     * @return The position after the markup, std::string::npos if it is not completely within the buffer
+     */
+    size_t findMarkupEnd(size_t pos) const;
+
+
+    /** @brief Searches the given string in the buffer
+     *
+     * @param[in] what The string to search
+     * @param[in] pos The position to start from
+     * @return The position after the string, std::string::npos if it is not within the buffer
+     */
+    size_t findAfter(const char* what, size_t pos) const;
+
+
+    /** @brief Splits the tag in the buffer range into name and attributes
+     *
+     * @param[in] begin The position after the '<'
+     * @param[in] end The position of the final '>' or "/>"
+     */
+    void parseTag(size_t begin, size_t end);
+
+
+    /** @brief Decodes entity and character references and normalizes line ends in place
+     *
+     * @param[in] begin The beginning of the data
+     * @param[in] end The end of the data
+     * @param[in] isAttribute Whether white space shall be normalized as for attribute values
+     * @return The end of the decoded data
+     */
+    char* decode(char* begin, char* end, const bool isAttribute);
+
+
+    /// @brief Appends the given code point in UTF-8 encoding
+    static char* appendUTF8(char* out, unsigned long codePoint);
+
+
+    /// @brief Counts the line ends in the given buffer range
+    void countLines(size_t begin, size_t end);
+
+
+    /// @brief Throws a ProcessError for the current position
+    void error(const std::string& message) const;
+
+
+private:
+    /// @brief The size of the chunks read from the file
+    static const size_t CHUNK_SIZE;
+
+    /// @brief The name of the file
+    const std::string myFile;
+
+    /// @brief The stream the data is read from
+    std::ifstream myStream;
+
+    /// @brief The buffer holding the read data, followed by a 0
+    std::vector<char> myBuffer;
+
+    /// @brief The position of the first unprocessed and the end of the valid data in the buffer
+    size_t myPos, myEnd;
+
+    /// @brief Whether the encoding of the file is supported
+    bool myAmSupported;
+
+    /// @brief The current line
+    int myLine;
+
+    /// @brief Whether the root element has been read
+    bool mySeenRoot;
+
+    /// @brief Whether the current opening tag closes the element as well
+    bool myPendingEnd;
+
+    /// @brief The names of the currently open elements (the strings are reused, see myDepth)
+    std::vector<std::string> myElementStack;
+
+    /// @brief The number of currently open elements
+    int myDepth;
+
+    /// @brief The name of the last closed element
+    std::string myEndName;
+
+    /// @brief The name of the current tag
+    const char* myName;
+
+    /// @brief The names and values of the attributes of the current tag
+    std::vector<const char*> myAttrNames, myAttrValues;
+
+    /// @brief The current character data
+    const char* myCharacters;
+    int myCharactersLength;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    PlainXMLReader(const PlainXMLReader&);
+
+    /// @brief Invalidated assignment operator.
+    PlainXMLReader& operator=(const PlainXMLReader&);
+
+};
+
+
+#endif
+
+/****************************************************************************/
@@ -34,10 +34,10 @@
 // ===========================================================================
 // method definitions
 // ===========================================================================
-SUMORouteLoader::SUMORouteLoader(SUMORouteHandler* handler)
+SUMORouteLoader::SUMORouteLoader(SUMORouteHandler* handler, const bool readAhead)
     : myParser(0), myMoreAvailable(true), myHandler(handler) {
     myParser = XMLSubSys::getSAXReader(*myHandler);
-    if (!myParser->parseFirst(myHandler->getFileName())) {
+    if (!myParser->parseFirst(myHandler->getFileName(), readAhead)) {
         throw ProcessError("Can not read XML-file '" + myHandler->getFileName() + "'.");
     }
 }
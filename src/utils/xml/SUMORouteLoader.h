@@ -46,8 +46,12 @@ class SUMOSAXReader;
  */
 class SUMORouteLoader {
 public:
-    /// constructor
-    SUMORouteLoader(SUMORouteHandler* handler);
+    /** @brief constructor
+     *
+     * @param[in] handler The handler to give the parsed vehicles and routes to
+     * @param[in] readAhead Whether the file shall be parsed ahead in a background thread
+     */
+    SUMORouteLoader(SUMORouteHandler* handler, const bool readAhead = false);
 
     /// destructor
     ~SUMORouteLoader();
@@ -49,6 +49,8 @@ SUMOSAXAttributesImpl_Binary::SUMOSAXAttributesImpl_Binary(
     while (in->peek() == BinaryFormatter::BF_XML_ATTRIBUTE) {
         int attr;
         unsigned char attrByte;
+        // the markers are followed by plain values, replace them by the type of the value to read
+        in->retype(BinaryFormatter::BF_BYTE);
         *in >> attrByte;
         attr = attrByte;
         if (version > 1) {
@@ -73,6 +75,7 @@ SUMOSAXAttributesImpl_Binary::SUMOSAXAttributesImpl_Binary(
                 break;
             case BinaryFormatter::BF_LIST: {
                 int size;
+                in->retype(BinaryFormatter::BF_INTEGER);
                 *in >> size;
                 while (size > 0) {
                     const int type = in->peek();
@@ -89,9 +92,11 @@ SUMOSAXAttributesImpl_Binary::SUMOSAXAttributesImpl_Binary(
                 break;
             }
             case BinaryFormatter::BF_EDGE:
+                in->retype(BinaryFormatter::BF_INTEGER);
                 *in >> myIntValues[attr];
                 break;
             case BinaryFormatter::BF_LANE:
+                in->retype(BinaryFormatter::BF_INTEGER);
                 *in >> myIntValues[attr];
                 in->putback(BinaryFormatter::BF_BYTE);
                 *in >> myCharValues[attr];
@@ -107,6 +112,7 @@ SUMOSAXAttributesImpl_Binary::SUMOSAXAttributesImpl_Binary(
             }
             case BinaryFormatter::BF_BOUNDARY: {
                 Position p;
+                in->retype(BinaryFormatter::BF_POSITION_2D);
                 *in >> p;
                 myPositionVectors[attr].push_back(p);
                 in->putback(BinaryFormatter::BF_POSITION_2D);
@@ -115,17 +121,21 @@ SUMOSAXAttributesImpl_Binary::SUMOSAXAttributesImpl_Binary(
                 break;
             }
             case BinaryFormatter::BF_COLOR:
+                in->retype(BinaryFormatter::BF_INTEGER);
                 *in >> myIntValues[attr];
                 break;
             case BinaryFormatter::BF_NODE_TYPE:
+                in->retype(BinaryFormatter::BF_BYTE);
                 *in >> myCharValues[attr];
                 break;
             case BinaryFormatter::BF_EDGE_FUNCTION:
+                in->retype(BinaryFormatter::BF_BYTE);
                 *in >> myCharValues[attr];
                 break;
             case BinaryFormatter::BF_ROUTE: {
                 std::ostringstream into(std::ios::binary);
                 int size;
+                in->retype(BinaryFormatter::BF_INTEGER);
                 *in >> size;
                 FileHelpers::writeByte(into, BinaryFormatter::BF_ROUTE);
                 FileHelpers::writeInt(into, size);
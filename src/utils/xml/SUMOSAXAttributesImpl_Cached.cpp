@@ -87,15 +87,16 @@ SUMOSAXAttributesImpl_Cached::getLong(int id) const {
 
 std::string
 SUMOSAXAttributesImpl_Cached::getString(int id) const {
-    return getAttributeValueSecure(id);
+    const char* const value = getAttributeValueSecure(id);
+    return value == 0 ? "" : value;
 }
 
 
 std::string
 SUMOSAXAttributesImpl_Cached::getStringSecure(int id,
         const std::string& str) const {
-    std::string result = getAttributeValueSecure(id);
-    return result.size() == 0 ? str : result;
+    const char* const value = getAttributeValueSecure(id);
+    return value == 0 || value[0] == 0 ? str : value;
 }
 
 
@@ -109,13 +110,18 @@ const char*
 SUMOSAXAttributesImpl_Cached::getAttributeValueSecure(int id) const {
     std::map<int, std::string>::const_iterator i = myPredefinedTagsMML.find(id);
     assert(i != myPredefinedTagsMML.end());
-    return myAttrs.find((*i).second)->second.c_str();
+    std::map<std::string, std::string>::const_iterator it = myAttrs.find((*i).second);
+    if (it == myAttrs.end()) {
+        return 0;
+    }
+    return it->second.c_str();
 }
 
 
 double
 SUMOSAXAttributesImpl_Cached::getFloat(const std::string& id) const {
-    return TplConvert::_2double(myAttrs.find(id)->second.c_str());
+    std::map<std::string, std::string>::const_iterator it = myAttrs.find(id);
+    return TplConvert::_2double(it == myAttrs.end() ? (const char*)0 : it->second.c_str());
 }
 
 
@@ -284,11 +284,11 @@ public:
     SUMOSAXAttributes* clone() const;
 
 private:
-    /** @brief Returns Xerces-value of the named attribute
+    /** @brief Returns the value of the named attribute
      *
-     * It is assumed that this attribute is within the stored attributes.
+     * It is assumed that this attribute is a known (predefined) attribute.
      * @param[in] id The id of the attribute to retrieve the vale of
-     * @return The xerces-value of the attribute
+     * @return The value of the attribute, 0 if it is not set (as for the xerces attributes)
      */
     const char* getAttributeValueSecure(int id) const;
 
@@ -0,0 +1,253 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    SUMOSAXAttributesImpl_Plain.cpp
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// Encapsulated xml-attributes pointing into the buffer of the PlainXMLReader
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cstring>
+#include <utils/common/RGBColor.h>
+#include <utils/common/StringTokenizer.h>
+#include <utils/common/TplConvert.h>
+#include <utils/common/StringBijection.h>
+#include <utils/geom/Boundary.h>
+#include <utils/geom/PositionVector.h>
+#include "SUMOSAXAttributesImpl_Cached.h"
+#include "SUMOSAXAttributesImpl_Plain.h"
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+SUMOSAXAttributesImpl_Plain::SUMOSAXAttributesImpl_Plain(
+    const std::vector<const char*>& names,
+    const std::vector<const char*>& values,
+    const std::vector<int>& ids,
+    const std::map<int, std::string>& predefinedTagsMML,
+    const std::string& objectType) :
+    SUMOSAXAttributes(objectType),
+    myNames(names),
+    myValues(values),
+    myIDs(ids),
+    myPredefinedTagsMML(predefinedTagsMML) { }
+
+
+SUMOSAXAttributesImpl_Plain::~SUMOSAXAttributesImpl_Plain() {
+}
+
+
+bool
+SUMOSAXAttributesImpl_Plain::hasAttribute(int id) const {
+    return getAttributeValueSecure(id) != 0;
+}
+
+
+bool
+SUMOSAXAttributesImpl_Plain::getBool(int id) const {
+    return TplConvert::_2bool(getAttributeValueSecure(id));
+}
+
+
+int
+SUMOSAXAttributesImpl_Plain::getInt(int id) const {
+    return TplConvert::_2int(getAttributeValueSecure(id));
+}
+
+
+long long int
+SUMOSAXAttributesImpl_Plain::getLong(int id) const {
+    return TplConvert::_2long(getAttributeValueSecure(id));
+}
+
+
+std::string
+SUMOSAXAttributesImpl_Plain::getString(int id) const {
+    const char* const value = getAttributeValueSecure(id);
+    return value == 0 ? "" : value;
+}
+
+
+std::string
+SUMOSAXAttributesImpl_Plain::getStringSecure(int id,
+        const std::string& str) const {
+    // an empty value is returned as it is (like SUMOSAXAttributesImpl_Xerces does)
+    const char* const value = getAttributeValueSecure(id);
+    return value == 0 ? str : value;
+}
+
+
+double
+SUMOSAXAttributesImpl_Plain::getFloat(int id) const {
+    return TplConvert::_2double(getAttributeValueSecure(id));
+}
+
+
+const char*
+SUMOSAXAttributesImpl_Plain::getAttributeValueSecure(int id) const {
+    for (int i = 0; i < (int)myIDs.size(); ++i) {
+        if (myIDs[i] == id) {
+            return myValues[i];
+        }
+    }
+    return 0;
+}
+
+
+const char*
+SUMOSAXAttributesImpl_Plain::getAttributeValue(const std::string& name) const {
+    for (int i = 0; i < (int)myNames.size(); ++i) {
+        if (strcmp(myNames[i], name.c_str()) == 0) {
+            return myValues[i];
+        }
+    }
+    return 0;
+}
+
+
+double
+SUMOSAXAttributesImpl_Plain::getFloat(const std::string& id) const {
+    return TplConvert::_2double(getAttributeValue(id));
+}
+
+
+bool
+SUMOSAXAttributesImpl_Plain::hasAttribute(const std::string& id) const {
+    return getAttributeValue(id) != 0;
+}
+
+
+std::string
+SUMOSAXAttributesImpl_Plain::getStringSecure(const std::string& id,
+        const std::string& str) const {
+    const char* const value = getAttributeValue(id);
+    return value == 0 || value[0] == 0 ? str : value;
+}
+
+
+SumoXMLEdgeFunc
+SUMOSAXAttributesImpl_Plain::getEdgeFunc(bool& ok) const {
+    if (hasAttribute(SUMO_ATTR_FUNCTION)) {
+        std::string funcString = getString(SUMO_ATTR_FUNCTION);
+        if (SUMOXMLDefinitions::EdgeFunctions.hasString(funcString)) {
+            return SUMOXMLDefinitions::EdgeFunctions.get(funcString);
+        }
+        ok = false;
+    }
+    return EDGEFUNC_NORMAL;
+}
+
+
+SumoXMLNodeType
+SUMOSAXAttributesImpl_Plain::getNodeType(bool& ok) const {
+    if (hasAttribute(SUMO_ATTR_TYPE)) {
+        std::string typeString = getString(SUMO_ATTR_TYPE);
+        if (SUMOXMLDefinitions::NodeTypes.hasString(typeString)) {
+            return SUMOXMLDefinitions::NodeTypes.get(typeString);
+        }
+        ok = false;
+    }
+    return NODETYPE_UNKNOWN;
+}
+
+
+RGBColor
+SUMOSAXAttributesImpl_Plain::getColor() const {
+    return RGBColor::parseColor(getString(SUMO_ATTR_COLOR));
+}
+
+
+PositionVector
+SUMOSAXAttributesImpl_Plain::getShape(int attr) const {
+    StringTokenizer st(getString(attr));
+    PositionVector shape;
+    while (st.hasNext()) {
+        StringTokenizer pos(st.next(), ",");
+        if (pos.size() != 2 && pos.size() != 3) {
+            throw FormatException("shape format");
+        }
+        double x = TplConvert::_2double(pos.next().c_str());
+        double y = TplConvert::_2double(pos.next().c_str());
+        if (pos.size() == 2) {
+            shape.push_back(Position(x, y));
+        } else {
+            double z = TplConvert::_2double(pos.next().c_str());
+            shape.push_back(Position(x, y, z));
+        }
+    }
+    return shape;
+}
+
+
+Boundary
+SUMOSAXAttributesImpl_Plain::getBoundary(int attr) const {
+    std::string def = getString(attr);
+    StringTokenizer st(def, ",");
+    if (st.size() != 4) {
+        throw FormatException("boundary format");
+    }
+    const double xmin = TplConvert::_2double(st.next().c_str());
+    const double ymin = TplConvert::_2double(st.next().c_str());
+    const double xmax = TplConvert::_2double(st.next().c_str());
+    const double ymax = TplConvert::_2double(st.next().c_str());
+    return Boundary(xmin, ymin, xmax, ymax);
+}
+
+
+std::vector<std::string>
+SUMOSAXAttributesImpl_Plain::getStringVector(int attr) const {
+    std::string def = getString(attr);
+    std::vector<std::string> ret;
+    parseStringVector(def, ret);
+    return ret;
+}
+
+
+std::string
+SUMOSAXAttributesImpl_Plain::getName(int attr) const {
+    if (myPredefinedTagsMML.find(attr) == myPredefinedTagsMML.end()) {
+        return "?";
+    }
+    return myPredefinedTagsMML.find(attr)->second;
+}
+
+
+void
+SUMOSAXAttributesImpl_Plain::serialize(std::ostream& os) const {
+    for (int i = 0; i < (int)myNames.size(); ++i) {
+        os << " " << myNames[i];
+        os << "=\"" << myValues[i] << "\"";
+    }
+}
+
+
+SUMOSAXAttributes*
+SUMOSAXAttributesImpl_Plain::clone() const {
+    std::map<std::string, std::string> attrs;
+    for (int i = 0; i < (int)myNames.size(); ++i) {
+        attrs[myNames[i]] = myValues[i];
+    }
+    return new SUMOSAXAttributesImpl_Cached(attrs, myPredefinedTagsMML, getObjectType());
+}
+
+/****************************************************************************/
+
@@ -0,0 +1,288 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    SUMOSAXAttributesImpl_Plain.h
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// Encapsulated xml-attributes pointing into the buffer of the PlainXMLReader
+/****************************************************************************/
+#ifndef SUMOSAXAttributesImpl_Plain_h
+#define SUMOSAXAttributesImpl_Plain_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <map>
+#include <vector>
+#include <iostream>
+#include "SUMOSAXAttributes.h"
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class SUMOSAXAttributesImpl_Plain
+ * @brief Encapsulated attributes of an element read by the PlainXMLReader
+ *
+ * Names and values are 0-terminated UTF-8 strings within the buffer of the
+ *  reader and the attribute ids are resolved once per element, so the
+ *  lookups do not allocate or transcode. Like the xerces attributes the
+ *  object is only valid during the startElement callback, use clone to
+ *  keep the attributes.
+ *
+ * @see SUMOSAXAttributes
+ */
+class SUMOSAXAttributesImpl_Plain : public SUMOSAXAttributes {
+public:
+    /** @brief Constructor
+     *
+     * @param[in] names The attribute names
+     * @param[in] values The attribute values (same index as the names)
+     * @param[in] ids The attribute ids (same index as the names, SUMO_ATTR_NOTHING for unknown attributes)
+     * @param[in] predefinedTagsMML Map of attribute ids to their (readable) string-representation
+     * @param[in] objectType The name of the element
+     */
+    SUMOSAXAttributesImpl_Plain(const std::vector<const char*>& names,
+                                const std::vector<const char*>& values,
+                                const std::vector<int>& ids,
+                                const std::map<int, std::string>& predefinedTagsMML,
+                                const std::string& objectType);
+
+
+    /// @brief Destructor
+    virtual ~SUMOSAXAttributesImpl_Plain();
+
+
+
+    /// @name methods for retrieving attribute values
+    /// @{
+
+    /** @brief Returns the information whether the named (by its enum-value) attribute is within the current list
+     *
+     * @param[in] id The id of the searched attribute
+     * @return Whether the attribute is within the attributes
+     */
+    bool hasAttribute(int id) const;
+
+
+    /**
+     * @brief Returns the bool-value of the named (by its enum-value) attribute
+     *
+     * @param[in] id The id of the attribute to return the value of
+     * @return The attribute's value as a bool, if it could be read and parsed
+     * @exception EmptyData If the attribute is not known or the attribute value is an empty string
+     * @exception BoolFormatException If the attribute value can not be parsed to a bool
+     */
+    bool getBool(int id) const;
+
+
+    /**
+     * @brief Returns the int-value of the named (by its enum-value) attribute
+     *
+     * @param[in] id The id of the attribute to return the value of
+     * @return The attribute's value as an int, if it could be read and parsed
+     * @exception EmptyData If the attribute is not known or the attribute value is an empty string
+     * @exception NumberFormatException If the attribute value can not be parsed to an int
+     */
+    int getInt(int id) const;
+
+
+    /**
+     * @brief Returns the long-value of the named (by its enum-value) attribute
+     *
+     * @param[in] id The id of the attribute to return the value of
+     * @return The attribute's value as a long, if it could be read and parsed
+     * @exception EmptyData If the attribute is not known or the attribute value is an empty string
+     * @exception NumberFormatException If the attribute value can not be parsed to a long
+     */
+    long long int getLong(int id) const;
+
+
+    /**
+     * @brief Returns the string-value of the named (by its enum-value) attribute
+     *
+     * @param[in] id The id of the attribute to return the value of
+     * @return The attribute's value as a string, "" if it is not given
+     */
+    std::string getString(int id) const;
+
+
+    /**
+     * @brief Returns the string-value of the named (by its enum-value) attribute
+     *
+     * @param[in] id The id of the attribute to return the value of
+     * @param[in] def The default value to return if the attribute is not given or empty
+     * @return The attribute's value as a string or the default
+     */
+    std::string getStringSecure(int id,
+                                const std::string& def) const;
+
+
+    /**
+     * @brief Returns the double-value of the named (by its enum-value) attribute
+     *
+     * @param[in] id The id of the attribute to return the value of
+     * @return The attribute's value as a float, if it could be read and parsed
+     * @exception EmptyData If the attribute is not known or the attribute value is an empty string
+     * @exception NumberFormatException If the attribute value can not be parsed to an double
+     */
+    double getFloat(int id) const;
+
+
+    /**
+     * @brief Returns the information whether the named attribute is within the current list
+     */
+    bool hasAttribute(const std::string& id) const;
+
+
+    /**
+     * @brief Returns the double-value of the named attribute
+     *
+     * @param[in] id The name of the attribute to return the value of
+     * @return The attribute's value as a float, if it could be read and parsed
+     * @exception EmptyData If the attribute is not known or the attribute value is an empty string
+     * @exception NumberFormatException If the attribute value can not be parsed to an double
+     */
+    double getFloat(const std::string& id) const;
+
+
+    /**
+     * @brief Returns the string-value of the named attribute
+     *
+     * @param[in] id The name of the attribute to return the value of
+     * @param[in] def The default value to return if the attribute is not given or empty
+     * @return The attribute's value as a string or the default
+     */
+    std::string getStringSecure(const std::string& id,
+                                const std::string& def) const;
+    //}
+
+
+    /**
+     * @brief Returns the value of the named attribute
+     *
+     * @return The attribute's value as a SumoXMLEdgeFunc, if it could be read and parsed
+     */
+    SumoXMLEdgeFunc getEdgeFunc(bool& ok) const;
+
+
+    /**
+     * @brief Returns the value of the named attribute
+     *
+     * @return The attribute's value as a SumoXMLNodeType, if it could be read and parsed
+     */
+    SumoXMLNodeType getNodeType(bool& ok) const;
+
+
+    /**
+     * @brief Returns the value of the named attribute
+     *
+     * @return The attribute's value as a RGBColor, if it could be read and parsed
+     */
+    RGBColor getColor() const;
+
+
+    /** @brief Tries to read given attribute assuming it is a PositionVector
+     *
+     * @param[in] attr The id of the attribute to read
+     * @return The read value if given and not empty; "" if an error occured
+     */
+    PositionVector getShape(int attr) const;
+
+
+    /** @brief Tries to read given attribute assuming it is a Boundary
+     *
+     * @param[in] attr The id of the attribute to read
+     * @return The read value if given and not empty; "" if an error occured
+     */
+    Boundary getBoundary(int attr) const;
+
+
+    /** @brief Tries to read given attribute assuming it is a string vector
+     *
+     * @param[in] attr The id of the attribute to read
+     * @return The read value if given and not empty; empty vector if an error occured
+     */
+    std::vector<std::string> getStringVector(int attr) const;
+
+
+    /** @brief Converts the given attribute id into a man readable string
+     *
+     * Returns a "?" if the attribute is not known.
+     *
+     * @param[in] attr The id of the attribute to return the name of
+     * @return The name of the described attribute
+     */
+    std::string getName(int attr) const;
+
+
+    /** @brief Prints all attribute names and values into the given stream
+     *
+     * @param[in] os The stream to use
+     */
+    void serialize(std::ostream& os) const;
+
+    /// @brief return a new deep-copy attributes object
+    SUMOSAXAttributes* clone() const;
+
+private:
+    /** @brief Returns the value of the attribute with the given id
+     *
+     * @param[in] id The id of the attribute to retrieve the value of
+     * @return The value of the attribute, 0 if it is not set (as for the xerces attributes)
+     */
+    const char* getAttributeValueSecure(int id) const;
+
+
+    /** @brief Returns the value of the attribute with the given name
+     *
+     * @param[in] name The name of the attribute to retrieve the value of
+     * @return The value of the attribute, 0 if it is not set
+     */
+    const char* getAttributeValue(const std::string& name) const;
+
+
+private:
+    /// @brief The attribute names and values
+    const std::vector<const char*>& myNames;
+    const std::vector<const char*>& myValues;
+
+    /// @brief The attribute ids
+    const std::vector<int>& myIDs;
+
+    /// @brief Map of attribute ids to their (readable) string-representation
+    const std::map<int, std::string>& myPredefinedTagsMML;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    SUMOSAXAttributesImpl_Plain(const SUMOSAXAttributesImpl_Plain& src);
+
+    /// @brief Invalidated assignment operator.
+    SUMOSAXAttributesImpl_Plain& operator=(const SUMOSAXAttributesImpl_Plain& src);
+
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
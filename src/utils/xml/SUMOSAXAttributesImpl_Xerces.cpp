@@ -34,6 +34,7 @@
 #include <xercesc/util/TransService.hpp>
 #include <xercesc/util/TranscodingException.hpp>
 #include <utils/common/RGBColor.h>
+#include <utils/common/StdDefs.h>
 #include <utils/common/StringTokenizer.h>
 #include <utils/common/TplConvert.h>
 #include <utils/geom/Boundary.h>
@@ -89,49 +90,22 @@ SUMOSAXAttributesImpl_Xerces::getLong(int id) const {
 
 std::string
 SUMOSAXAttributesImpl_Xerces::getString(int id) const {
-    const XMLCh* utf16 = getAttributeValueSecure(id);
-#if _XERCES_VERSION < 30100
-    char* t = XERCES_CPP_NAMESPACE::XMLString::transcode(utf16);
-    std::string result(t);
-    XERCES_CPP_NAMESPACE::XMLString::release(&t);
-    return result;
-#else
-    if (XERCES_CPP_NAMESPACE::XMLString::stringLen(utf16) == 0) {
-        // TranscodeToStr and debug_new interact badly in this case;
-        return "";
-    } else {
-        try {
-            XERCES_CPP_NAMESPACE::TranscodeToStr utf8(utf16, "UTF-8");
-            return TplConvert::_2str(utf8.str(), (unsigned)utf8.length());
-        } catch (XERCES_CPP_NAMESPACE::TranscodingException e) {
-            return "?";
-        }
-    }
-#endif
+    return toUTF8(getAttributeValueSecure(id));
 }
 
 
 std::string
 SUMOSAXAttributesImpl_Xerces::getStringSecure(int id,
         const std::string& str) const {
-    const XMLCh* utf16 = getAttributeValueSecure(id);
 #if _XERCES_VERSION < 30100
-    char* t = XERCES_CPP_NAMESPACE::XMLString::transcode(utf16);
+    char* t = XERCES_CPP_NAMESPACE::XMLString::transcode(getAttributeValueSecure(id));
     std::string result(TplConvert::_2strSec(t, str));
     XERCES_CPP_NAMESPACE::XMLString::release(&t);
     return result;
 #else
-    if (XERCES_CPP_NAMESPACE::XMLString::stringLen(utf16) == 0) {
-        // TranscodeToStr and debug_new interact badly in this case;
-        return "";
-    } else {
-        try {
-            XERCES_CPP_NAMESPACE::TranscodeToStr utf8(utf16, "UTF-8");
-            return TplConvert::_2strSec(utf8.str(), (unsigned)utf8.length(), str);
-        } catch (XERCES_CPP_NAMESPACE::TranscodingException e) {
-            return "?";
-        }
-    }
+    // unlike the transcoding variant (which uses _2strSec) this returns an empty string for empty values
+    UNUSED_PARAMETER(str);
+    return toUTF8(getAttributeValueSecure(id));
 #endif
 }
 
@@ -150,31 +124,69 @@ SUMOSAXAttributesImpl_Xerces::getAttributeValueSecure(int id) const {
 }
 
 
+const XMLCh*
+SUMOSAXAttributesImpl_Xerces::getAttributeValue(const std::string& name) const {
+    // compare the names in place instead of transcoding the name for each call
+    const int length = (int)name.length();
+    for (int i = 0; i < (int)myAttrs.getLength(); ++i) {
+        const XMLCh* const qname = myAttrs.getQName(i);
+        int j = 0;
+        while (j < length && qname[j] == (XMLCh)(unsigned char)name[j]) {
+            j++;
+        }
+        if (j == length && qname[j] == 0) {
+            return myAttrs.getValue(i);
+        }
+    }
+    return 0;
+}
+
+
+std::string
+SUMOSAXAttributesImpl_Xerces::toUTF8(const XMLCh* const data) {
+    if (data == 0) {
+        return "";
+    }
+    // most values are plain ASCII which can be copied without a transcoder
+    int length = 0;
+    while (data[length] != 0) {
+        if (data[length] > 127) {
+#if _XERCES_VERSION < 30100
+            char* t = XERCES_CPP_NAMESPACE::XMLString::transcode(data);
+            std::string result(t);
+            XERCES_CPP_NAMESPACE::XMLString::release(&t);
+            return result;
+#else
+            try {
+                XERCES_CPP_NAMESPACE::TranscodeToStr utf8(data, "UTF-8");
+                return TplConvert::_2str(utf8.str(), (unsigned)utf8.length());
+            } catch (XERCES_CPP_NAMESPACE::TranscodingException e) {
+                return "?";
+            }
+#endif
+        }
+        length++;
+    }
+    return TplConvert::_2str(data, length);
+}
+
+
 double
 SUMOSAXAttributesImpl_Xerces::getFloat(const std::string& id) const {
-    XMLCh* t = XERCES_CPP_NAMESPACE::XMLString::transcode(id.c_str());
-    double result = TplConvert::_2double(myAttrs.getValue(t));
-    XERCES_CPP_NAMESPACE::XMLString::release(&t);
-    return result;
+    return TplConvert::_2double(getAttributeValue(id));
 }
 
 
 bool
 SUMOSAXAttributesImpl_Xerces::hasAttribute(const std::string& id) const {
-    XMLCh* t = XERCES_CPP_NAMESPACE::XMLString::transcode(id.c_str());
-    bool result = myAttrs.getIndex(t) >= 0;
-    XERCES_CPP_NAMESPACE::XMLString::release(&t);
-    return result;
+    return getAttributeValue(id) != 0;
 }
 
 
 std::string
 SUMOSAXAttributesImpl_Xerces::getStringSecure(const std::string& id,
         const std::string& str) const {
-    XMLCh* t = XERCES_CPP_NAMESPACE::XMLString::transcode(id.c_str());
-    std::string result = TplConvert::_2strSec(myAttrs.getValue(t), str);
-    XERCES_CPP_NAMESPACE::XMLString::release(&t);
-    return result;
+    return TplConvert::_2strSec(getAttributeValue(id), str);
 }
 
 
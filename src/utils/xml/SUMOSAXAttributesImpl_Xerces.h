@@ -296,6 +296,25 @@ private:
     const XMLCh* getAttributeValueSecure(int id) const;
 
 
+    /** @brief Returns Xerces-value of the attribute with the given name
+     *
+     * @param[in] name The name of the attribute to retrieve the value of
+     * @return The xerces-value of the attribute, 0 if it is not within the stored attributes
+     */
+    const XMLCh* getAttributeValue(const std::string& name) const;
+
+
+    /** @brief Converts the given xerces-value into UTF-8
+     *
+     * ASCII values (the vast majority) are copied directly, only other values
+     *  are given to the xerces transcoder.
+     *
+     * @param[in] data The value to convert
+     * @return The UTF-8 representation, an empty string if the value is 0
+     */
+    static std::string toUTF8(const XMLCh* const data);
+
+
 private:
     /// @brief The encapsulated attributes
     const XERCES_CPP_NAMESPACE::Attributes& myAttrs;
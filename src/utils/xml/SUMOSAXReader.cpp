@@ -28,32 +28,302 @@
 #endif
 
 #include <string>
+#include <map>
+#include <vector>
 #include <iostream>
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #include <xercesc/framework/LocalFileInputSource.hpp>
 #include <xercesc/framework/MemBufInputSource.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+#include <xercesc/util/XercesVersion.hpp>
+#include <xercesc/util/XMLException.hpp>
+#include <xercesc/util/TransService.hpp>
+#include <xercesc/util/TranscodingException.hpp>
 
+#ifdef HAVE_FOX
+#include <deque>
+#include <fx.h>
+#include <FXThread.h>
+#endif
+
+#include <utils/common/StdDefs.h>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/ToString.h>
 #include <utils/common/TplConvert.h>
 #include <utils/iodevices/BinaryFormatter.h>
 #include <utils/iodevices/BinaryInputDevice.h>
 #include "SUMOSAXAttributesImpl_Binary.h"
+#include "SUMOSAXAttributesImpl_Cached.h"
+#include "SUMOSAXAttributesImpl_Plain.h"
+#include "PlainXMLReader.h"
 #include "GenericSAXHandler.h"
+#include "SUMOXMLDefinitions.h"
 #include "SUMOSAXReader.h"
 
 
+// ===========================================================================
+// class definitions
+// ===========================================================================
+#ifdef HAVE_FOX
+/**
+ * @class SUMOSAXReader::ReadAheadThread
+ * @brief A thread parsing a file with its own xerces reader and recording the SAX events
+ *
+ * Tokenizing the file and transcoding names, attributes and characters is done
+ *  in this thread. The recorded events are collected in chunks and handed over
+ *  through a bounded queue to the thread calling parseNext which replays them
+ *  to the (not thread safe) handler. Parsing warnings and errors are recorded as
+ *  well and reported when they are replayed.
+ */
+class SUMOSAXReader::ReadAheadThread : public FXThread, public XERCES_CPP_NAMESPACE::DefaultHandler {
+public:
+    /// @brief The types of recorded events
+    enum EventType {
+        EVENT_START,
+        EVENT_CHARACTERS,
+        EVENT_END,
+        EVENT_WARNING,
+        EVENT_ERROR
+    };
+
+    /// @brief A recorded event, text is the element name, the characters or the message
+    struct Event {
+        EventType type;
+        std::string text;
+        std::map<std::string, std::string> attrs;
+    };
+
+    /** @brief Constructor, takes ownership of the reader and starts parsing
+     *
+     * @param[in] reader The xerces reader to use (exclusively) in the background thread
+     * @param[in] systemID The name of the file to parse
+     */
+    ReadAheadThread(XERCES_CPP_NAMESPACE::SAX2XMLReader* reader, const std::string& systemID)
+        : FXThread(), myReader(reader), mySystemID(systemID),
+          myFinished(false), myStopped(false), myNextEvent(0) {
+        myReader->setContentHandler(this);
+        myReader->setErrorHandler(this);
+        start();
+    }
+
+    /// @brief Destructor, stops parsing and waits for the thread to end
+    ~ReadAheadThread() {
+        myMutex.lock();
+        myStopped = true;
+        myCondition.signal();
+        myMutex.unlock();
+        join();
+        delete myReader;
+    }
+
+    /// @brief Main execution method of this thread, parses the complete file
+    FXint run() {
+        try {
+            myReader->parse(mySystemID.c_str());
+        } catch (ParsingStopped&) {
+            // either stopped from the outside or the error has been recorded
+        } catch (ProcessError& e) {
+            record(EVENT_ERROR, e.what());
+        } catch (const XERCES_CPP_NAMESPACE::XMLException& e) {
+            record(EVENT_ERROR, "Error occurred: " + transcode(e.getMessage()) + " while parsing '" + mySystemID + "'");
+        } catch (const std::exception& e) {
+            record(EVENT_ERROR, "Error occurred: " + std::string(e.what()) + " while parsing '" + mySystemID + "'");
+        } catch (...) {
+            record(EVENT_ERROR, "Unspecified error occured wile parsing '" + mySystemID + "'");
+        }
+        myMutex.lock();
+        if (!myChunk.empty()) {
+            myQueue.push_back(EventChunk());
+            myQueue.back().swap(myChunk);
+        }
+        myFinished = true;
+        myCondition.signal();
+        myMutex.unlock();
+        return 0;
+    }
+
+    /** @brief Returns the next recorded event (blocking until it is available)
+     *
+     * The event stays valid until the next call. This is to be called by the consumer only.
+     *
+     * @return The next event, 0 if the file has been read completely
+     */
+    const Event* next() {
+        if (myNextEvent == (int)myCurrent.size()) {
+            myCurrent.clear();
+            myNextEvent = 0;
+            myMutex.lock();
+            while (myQueue.empty() && !myFinished) {
+                myCondition.wait(myMutex);
+            }
+            if (myQueue.empty()) {
+                myMutex.unlock();
+                return 0;
+            }
+            myCurrent.swap(myQueue.front());
+            myQueue.pop_front();
+            myCondition.signal();
+            myMutex.unlock();
+        }
+        return &myCurrent[myNextEvent++];
+    }
+
+    /// @name SAX callbacks (called in the background thread)
+    //@{
+    void startElement(const XMLCh* const /*uri*/, const XMLCh* const /*localname*/,
+                      const XMLCh* const qname, const XERCES_CPP_NAMESPACE::Attributes& attrs) {
+        myChunk.push_back(Event());
+        Event& e = myChunk.back();
+        e.type = EVENT_START;
+        e.text = TplConvert::_2str(qname);
+        for (int i = 0; i < (int)attrs.getLength(); ++i) {
+            e.attrs[TplConvert::_2str(attrs.getQName(i))] = transcode(attrs.getValue(i));
+        }
+        checkChunk();
+    }
+
+    void characters(const XMLCh* const chars, const XERCES3_SIZE_t length) {
+        record(EVENT_CHARACTERS, TplConvert::_2str(chars, (int)length));
+        checkChunk();
+    }
+
+    void endElement(const XMLCh* const /*uri*/, const XMLCh* const /*localname*/, const XMLCh* const qname) {
+        record(EVENT_END, TplConvert::_2str(qname));
+        checkChunk();
+    }
+
+    void warning(const XERCES_CPP_NAMESPACE::SAXParseException& exception) {
+        record(EVENT_WARNING, GenericSAXHandler::buildErrorMessage(exception, mySystemID));
+        checkChunk();
+    }
+
+    void error(const XERCES_CPP_NAMESPACE::SAXParseException& exception) {
+        record(EVENT_ERROR, GenericSAXHandler::buildErrorMessage(exception, mySystemID));
+        throw ParsingStopped();
+    }
+
+    void fatalError(const XERCES_CPP_NAMESPACE::SAXParseException& exception) {
+        record(EVENT_ERROR, GenericSAXHandler::buildErrorMessage(exception, mySystemID));
+        throw ParsingStopped();
+    }
+    //@}
+
+private:
+    /// @brief Thrown in the background thread to end parsing
+    class ParsingStopped {};
+
+    typedef std::vector<Event> EventChunk;
+
+    /// @brief Appends an event without attributes to the current chunk
+    void record(const EventType type, const std::string& text) {
+        myChunk.push_back(Event());
+        myChunk.back().type = type;
+        myChunk.back().text = text;
+    }
+
+    /// @brief Hands the current chunk over if it is full, waiting while the queue is full
+    void checkChunk() {
+        if ((int)myChunk.size() < CHUNK_SIZE) {
+            return;
+        }
+        myMutex.lock();
+        while (!myStopped && (int)myQueue.size() >= MAX_CHUNKS) {
+            myCondition.wait(myMutex);
+        }
+        if (myStopped) {
+            myMutex.unlock();
+            throw ParsingStopped();
+        }
+        myQueue.push_back(EventChunk());
+        myQueue.back().swap(myChunk);
+        myCondition.signal();
+        myMutex.unlock();
+    }
+
+    /// @brief Converts a xerces string into UTF-8 (as SUMOSAXAttributesImpl_Xerces::getString does)
+    static std::string transcode(const XMLCh* const data) {
+#if _XERCES_VERSION < 30100
+        char* t = XERCES_CPP_NAMESPACE::XMLString::transcode(data);
+        std::string result(t);
+        XERCES_CPP_NAMESPACE::XMLString::release(&t);
+        return result;
+#else
+        if (XERCES_CPP_NAMESPACE::XMLString::stringLen(data) == 0) {
+            // TranscodeToStr and debug_new interact badly in this case;
+            return "";
+        }
+        try {
+            XERCES_CPP_NAMESPACE::TranscodeToStr utf8(data, "UTF-8");
+            return TplConvert::_2str(utf8.str(), (unsigned)utf8.length());
+        } catch (XERCES_CPP_NAMESPACE::TranscodingException&) {
+            return "?";
+        }
+#endif
+    }
+
+private:
+    /// @brief The number of events handed over at once
+    static const int CHUNK_SIZE = 256;
+
+    /// @brief The maximum number of chunks parsed ahead
+    static const int MAX_CHUNKS = 64;
+
+    /// @brief The reader used in the background thread
+    XERCES_CPP_NAMESPACE::SAX2XMLReader* const myReader;
+
+    /// @brief The name of the parsed file
+    const std::string mySystemID;
+
+    /// @brief The mutex and condition guarding the queue and the flags
+    FXMutex myMutex;
+    FXCondition myCondition;
+
+    /// @brief The chunks ready for replay
+    std::deque<EventChunk> myQueue;
+
+    /// @brief Whether the background thread has finished parsing
+    bool myFinished;
+
+    /// @brief Whether parsing shall be stopped
+    bool myStopped;
+
+    /// @brief The chunk currently filled by the background thread
+    EventChunk myChunk;
+
+    /// @brief The chunk currently replayed and the index of its next event
+    EventChunk myCurrent;
+    int myNextEvent;
+
+private:
+    /// @brief Invalidated copy constructor.
+    ReadAheadThread(const ReadAheadThread&);
+
+    /// @brief Invalidated assignment operator.
+    ReadAheadThread& operator=(const ReadAheadThread&);
+};
+#endif
+
+
 // ===========================================================================
 // method definitions
 // ===========================================================================
-SUMOSAXReader::SUMOSAXReader(GenericSAXHandler& handler, const XERCES_CPP_NAMESPACE::SAX2XMLReader::ValSchemes validationScheme)
+SUMOSAXReader::SUMOSAXReader(GenericSAXHandler& handler, const XERCES_CPP_NAMESPACE::SAX2XMLReader::ValSchemes validationScheme,
+                             const bool usePlainParser)
     : myHandler(&handler), myValidationScheme(validationScheme),
-      myXMLReader(0), myBinaryInput(0)  {}
+      myXMLReader(0), myBinaryInput(0), myUsePlainParser(usePlainParser), myPlainInput(0)  {
+#ifdef HAVE_FOX
+    myReadAhead = 0;
+#endif
+}
 
 
 SUMOSAXReader::~SUMOSAXReader() {
+#ifdef HAVE_FOX
+    delete myReadAhead;
+#endif
     delete myXMLReader;
     delete myBinaryInput;
+    delete myPlainInput;
 }
 
 
@@ -85,9 +355,16 @@ SUMOSAXReader::setValidation(const XERCES_CPP_NAMESPACE::SAX2XMLReader::ValSchem
 }
 
 
+void
+SUMOSAXReader::setPlainParser(const bool usePlainParser) {
+    myUsePlainParser = usePlainParser;
+}
+
+
 void
 SUMOSAXReader::parse(std::string systemID) {
-    if (systemID.length() >= 4 && systemID.substr(systemID.length() - 4) == ".sbx") {
+    if ((systemID.length() >= 4 && systemID.substr(systemID.length() - 4) == ".sbx") ||
+            (myUsePlainParser && myValidationScheme == XERCES_CPP_NAMESPACE::SAX2XMLReader::Val_Never)) {
         if (parseFirst(systemID)) {
             while (parseNext());
         }
@@ -111,7 +388,13 @@ SUMOSAXReader::parseString(std::string content) {
 
 
 bool
-SUMOSAXReader::parseFirst(std::string systemID) {
+SUMOSAXReader::parseFirst(std::string systemID, const bool readAhead) {
+#ifdef HAVE_FOX
+    delete myReadAhead;
+    myReadAhead = 0;
+#endif
+    delete myPlainInput;
+    myPlainInput = 0;
     if (systemID.substr(systemID.length() - 4) == ".sbx") {
         myBinaryInput = new BinaryInputDevice(systemID, true, myValidationScheme == XERCES_CPP_NAMESPACE::SAX2XMLReader::Val_Always);
         *myBinaryInput >> mySbxVersion;
@@ -120,26 +403,35 @@ SUMOSAXReader::parseFirst(std::string systemID) {
         }
         std::string sumoVer;
         *myBinaryInput >> sumoVer;
+        checkBinaryHeaderList(systemID, "elements", SUMOXMLDefinitions::Tags.getStrings());
+        checkBinaryHeaderList(systemID, "attributes", SUMOXMLDefinitions::Attrs.getStrings());
+        checkBinaryHeaderList(systemID, "node types", SUMOXMLDefinitions::NodeTypes.getStrings());
+        checkBinaryHeaderList(systemID, "edge functions", SUMOXMLDefinitions::EdgeFunctions.getStrings());
         std::vector<std::string> elems;
         *myBinaryInput >> elems;
-        // !!! check elems here
-        elems.clear();
-        *myBinaryInput >> elems;
-        // !!! check attrs here
-        elems.clear();
-        *myBinaryInput >> elems;
-        // !!! check node types here
-        elems.clear();
-        *myBinaryInput >> elems;
-        // !!! check edge types here
-        elems.clear();
-        *myBinaryInput >> elems;
         // !!! check edges here
         std::vector< std::vector<int> > followers;
         *myBinaryInput >> followers;
         // !!! check followers here
         return parseNext();
     } else {
+        if (myUsePlainParser && myValidationScheme == XERCES_CPP_NAMESPACE::SAX2XMLReader::Val_Never) {
+            myPlainInput = new PlainXMLReader(systemID);
+            if (myPlainInput->isSupported()) {
+                return true;
+            }
+            // let xerces handle other encodings and report missing files
+            delete myPlainInput;
+            myPlainInput = 0;
+        }
+#ifdef HAVE_FOX
+        if (readAhead) {
+            myReadAhead = new ReadAheadThread(getSAXReader(), systemID);
+            return true;
+        }
+#else
+        UNUSED_PARAMETER(readAhead);
+#endif
         if (myXMLReader == 0) {
             myXMLReader = getSAXReader();
         }
@@ -151,6 +443,63 @@ SUMOSAXReader::parseFirst(std::string systemID) {
 
 bool
 SUMOSAXReader::parseNext() {
+    if (myPlainInput != 0) {
+        switch (myPlainInput->next()) {
+            case PlainXMLReader::TOKEN_START: {
+                myPlainName = myPlainInput->getName();
+                const std::vector<const char*>& names = myPlainInput->getAttributeNames();
+                myPlainAttrIDs.clear();
+                for (std::vector<const char*>::const_iterator i = names.begin(); i != names.end(); ++i) {
+                    myPlainAttrIDs.push_back(myHandler->convertAttr(*i));
+                }
+                SUMOSAXAttributesImpl_Plain attrs(names, myPlainInput->getAttributeValues(), myPlainAttrIDs,
+                                                  myHandler->myPredefinedTagsMML, myPlainName);
+                myHandler->processStartElement(myHandler->convertTag(myPlainName), attrs);
+                break;
+            }
+            case PlainXMLReader::TOKEN_END:
+                myPlainName = myPlainInput->getName();
+                myHandler->processEndElement(myHandler->convertTag(myPlainName));
+                break;
+            case PlainXMLReader::TOKEN_CHARACTERS:
+                myHandler->myCharactersVector.push_back(std::string(myPlainInput->getCharacters(), myPlainInput->getCharactersLength()));
+                break;
+            case PlainXMLReader::TOKEN_EOF:
+                delete myPlainInput;
+                myPlainInput = 0;
+                return false;
+        }
+        return true;
+    }
+#ifdef HAVE_FOX
+    if (myReadAhead != 0) {
+        const ReadAheadThread::Event* const e = myReadAhead->next();
+        if (e == 0) {
+            delete myReadAhead;
+            myReadAhead = 0;
+            return false;
+        }
+        switch (e->type) {
+            case ReadAheadThread::EVENT_START: {
+                SUMOSAXAttributesImpl_Cached attrs(e->attrs, myHandler->myPredefinedTagsMML, e->text);
+                myHandler->processStartElement(myHandler->convertTag(e->text), attrs);
+                break;
+            }
+            case ReadAheadThread::EVENT_CHARACTERS:
+                myHandler->myCharactersVector.push_back(e->text);
+                break;
+            case ReadAheadThread::EVENT_END:
+                myHandler->processEndElement(myHandler->convertTag(e->text));
+                break;
+            case ReadAheadThread::EVENT_WARNING:
+                WRITE_WARNING(e->text);
+                break;
+            case ReadAheadThread::EVENT_ERROR:
+                throw ProcessError(e->text);
+        }
+        return true;
+    }
+#endif
     if (myBinaryInput != 0) {
         int next = myBinaryInput->peek();
         switch (next) {
@@ -161,6 +510,7 @@ SUMOSAXReader::parseNext() {
             case BinaryFormatter::BF_XML_TAG_START: {
                 int tag;
                 unsigned char tagByte;
+                myBinaryInput->retype(BinaryFormatter::BF_BYTE);
                 *myBinaryInput >> tagByte;
                 tag = tagByte;
                 if (mySbxVersion > 1) {
@@ -195,6 +545,16 @@ SUMOSAXReader::parseNext() {
 }
 
 
+void
+SUMOSAXReader::checkBinaryHeaderList(const std::string& systemID, const std::string& what, const std::vector<std::string>& expected) {
+    std::vector<std::string> elems;
+    *myBinaryInput >> elems;
+    if (elems != expected) {
+        throw ProcessError("The binary file '" + systemID + "' was written with an incompatible version (the " + what + " differ), please regenerate it.");
+    }
+}
+
+
 XERCES_CPP_NAMESPACE::SAX2XMLReader*
 SUMOSAXReader::getSAXReader() {
     XERCES_CPP_NAMESPACE::SAX2XMLReader* reader = XERCES_CPP_NAMESPACE::XMLReaderFactory::createXMLReader();
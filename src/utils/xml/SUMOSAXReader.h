@@ -39,6 +39,7 @@
 // ===========================================================================
 class GenericSAXHandler;
 class BinaryInputDevice;
+class PlainXMLReader;
 
 
 // ===========================================================================
@@ -51,15 +52,22 @@ class BinaryInputDevice;
  * This class generates on demand either a SAX2XMLReader or parses the SUMO
  * binary xml. The interface is inspired by but not identical to
  * SAX2XMLReader.
+ *
+ * If the plain parser is enabled, files which are not validated are read
+ * by a PlainXMLReader instead of xerces (falling back to xerces if the
+ * encoding of the file is not supported).
  */
 class SUMOSAXReader {
 public:
     /**
      * @brief Constructor
      *
-     * @param[in] file The name of the processed file
+     * @param[in] handler The handler for the parsed files
+     * @param[in] validationScheme Whether files shall be validated
+     * @param[in] usePlainParser Whether files which are not validated shall be read using the PlainXMLReader
      */
-    SUMOSAXReader(GenericSAXHandler& handler, const XERCES_CPP_NAMESPACE::SAX2XMLReader::ValSchemes validationScheme);
+    SUMOSAXReader(GenericSAXHandler& handler, const XERCES_CPP_NAMESPACE::SAX2XMLReader::ValSchemes validationScheme,
+                  const bool usePlainParser = false);
 
     /// Destructor
     ~SUMOSAXReader();
@@ -73,15 +81,36 @@ public:
 
     void setValidation(const XERCES_CPP_NAMESPACE::SAX2XMLReader::ValSchemes validationScheme);
 
+    /// @brief Sets whether files which are not validated shall be read using the PlainXMLReader
+    void setPlainParser(const bool usePlainParser);
+
     void parse(std::string systemID);
 
     void parseString(std::string content);
 
-    bool parseFirst(std::string systemID);
+    /**
+     * @brief Starts a progressive parse of the given file
+     *
+     * If readAhead is set (and SUMO was built with FOX), a plain XML file is
+     *  tokenized in a background thread which keeps a bounded number of parsed
+     *  events ahead. The events are handed to the handler by parseNext in the
+     *  calling thread so the handler does not need to be thread safe.
+     *  Binary files are always read directly and the plain parser (if enabled
+     *  and applicable) takes precedence over reading ahead.
+     *
+     * @param[in] systemID The name of the file to parse
+     * @param[in] readAhead Whether the file shall be parsed in a background thread
+     * @return Whether the parse could be started
+     */
+    bool parseFirst(std::string systemID, const bool readAhead = false);
 
     bool parseNext();
 
 private:
+#ifdef HAVE_FOX
+    class ReadAheadThread;
+#endif
+
     class LocalSchemaResolver : public XERCES_CPP_NAMESPACE::EntityResolver {
     public:
         XERCES_CPP_NAMESPACE::InputSource* resolveEntity(const XMLCh* const publicId, const XMLCh* const systemId);
@@ -100,6 +129,19 @@ private:
      */
     XERCES_CPP_NAMESPACE::SAX2XMLReader* getSAXReader();
 
+    /** @brief Compares a string list from the header of a binary file with the current definitions
+     *
+     * The binary format stores tags, attributes, node types and edge functions
+     *  as indices into these lists, so a file written by a different SUMO
+     *  version cannot be read safely if they differ.
+     *
+     * @param[in] systemID The name of the file (for the error message)
+     * @param[in] what The description of the list (for the error message)
+     * @param[in] expected The list of the current version
+     * @exception ProcessError If the list in the file differs
+     */
+    void checkBinaryHeaderList(const std::string& systemID, const std::string& what, const std::vector<std::string>& expected);
+
 
 private:
     GenericSAXHandler* myHandler;
@@ -113,6 +155,21 @@ private:
 
     BinaryInputDevice* myBinaryInput;
 
+    /// @brief Whether files which are not validated shall be read using the PlainXMLReader
+    bool myUsePlainParser;
+
+    /// @brief The plain reader if the current file is read without xerces
+    PlainXMLReader* myPlainInput;
+
+    /// @brief The name of the current element and the ids of its attributes (reused for the plain reader)
+    std::string myPlainName;
+    std::vector<int> myPlainAttrIDs;
+
+#ifdef HAVE_FOX
+    /// @brief The background parser if the current file is read ahead
+    ReadAheadThread* myReadAhead;
+#endif
+
     char mySbxVersion;
 
     /// @brief The stack of begun xml elements
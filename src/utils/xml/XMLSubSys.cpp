@@ -42,6 +42,7 @@ std::vector<SUMOSAXReader*> XMLSubSys::myReaders;
 int XMLSubSys::myNextFreeReader;
 XERCES_CPP_NAMESPACE::SAX2XMLReader::ValSchemes XMLSubSys::myValidationScheme = XERCES_CPP_NAMESPACE::SAX2XMLReader::Val_Auto;
 XERCES_CPP_NAMESPACE::SAX2XMLReader::ValSchemes XMLSubSys::myNetValidationScheme = XERCES_CPP_NAMESPACE::SAX2XMLReader::Val_Auto;
+bool XMLSubSys::myUsePlainParser = false;
 
 
 // ===========================================================================
@@ -59,7 +60,8 @@ XMLSubSys::init() {
 
 
 void
-XMLSubSys::setValidation(const std::string& validationScheme, const std::string& netValidationScheme) {
+XMLSubSys::setValidation(const std::string& validationScheme, const std::string& netValidationScheme,
+                         const std::string& parser) {
     if (validationScheme == "never") {
         myValidationScheme = XERCES_CPP_NAMESPACE::SAX2XMLReader::Val_Never;
     } else if (validationScheme == "auto") {
@@ -78,6 +80,13 @@ XMLSubSys::setValidation(const std::string& validationScheme, const std::string&
     } else {
         throw ProcessError("Unknown network validation scheme + '" + netValidationScheme + "'.");
     }
+    if (parser == "xerces") {
+        myUsePlainParser = false;
+    } else if (parser == "plain") {
+        myUsePlainParser = true;
+    } else {
+        throw ProcessError("Unknown xml parser '" + parser + "'.");
+    }
 }
 
 
@@ -93,7 +102,7 @@ XMLSubSys::close() {
 
 SUMOSAXReader*
 XMLSubSys::getSAXReader(SUMOSAXHandler& handler) {
-    return new SUMOSAXReader(handler, myValidationScheme);
+    return new SUMOSAXReader(handler, myValidationScheme, myUsePlainParser);
 }
 
 
@@ -109,9 +118,10 @@ XMLSubSys::runParser(GenericSAXHandler& handler,
     try {
         XERCES_CPP_NAMESPACE::SAX2XMLReader::ValSchemes validationScheme = isNet ? myNetValidationScheme : myValidationScheme;
         if (myNextFreeReader == (int)myReaders.size()) {
-            myReaders.push_back(new SUMOSAXReader(handler, validationScheme));
+            myReaders.push_back(new SUMOSAXReader(handler, validationScheme, myUsePlainParser));
         } else {
             myReaders[myNextFreeReader]->setValidation(validationScheme);
+            myReaders[myNextFreeReader]->setPlainParser(myUsePlainParser);
             myReaders[myNextFreeReader]->setHandler(handler);
         }
         myNextFreeReader++;
@@ -81,14 +81,17 @@ public:
 
 
     /**
-     * @brief Enables or disables validation.
+     * @brief Enables or disables validation and selects the parser for files which are not validated.
      *
      * The setting is only valid for parsers created after the call. Existing parsers are not adapted.
      *
      * @param[in] validationScheme Whether validation of XML-documents against schemata shall be enabled
      * @param[in] netValidationScheme Whether validation of SUMO networks against schemata shall be enabled
+     * @param[in] parser The parser for files which are not validated ("xerces" or "plain")
+     * @exception ProcessError If one of the values is not known
      */
-    static void setValidation(const std::string& validationScheme, const std::string& netValidationScheme);
+    static void setValidation(const std::string& validationScheme, const std::string& netValidationScheme,
+                              const std::string& parser = "xerces");
 
 
     /**
@@ -158,6 +161,9 @@ private:
     /// @brief Information whether built reader/parser shall validate SUMO networks against schemata
     static XERCES_CPP_NAMESPACE::SAX2XMLReader::ValSchemes myNetValidationScheme;
 
+    /// @brief Information whether files which are not validated shall be read using the PlainXMLReader
+    static bool myUsePlainParser;
+
 };
 
 
@@ -0,0 +1,72 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-19
+# @version $Id$
+
+"""
+build a grid network with more edges and junctions than fit into one
+writing chunk (256) and check that writing it in parallel gives the same
+network file as writing it with a single thread
+"""
+from __future__ import absolute_import
+from __future__ import print_function
+
+
+import sys
+import os
+import subprocess
+sys.path.append(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', "tools"))
+from sumolib import checkBinary  # noqa
+
+SIZE = 20
+netconvert = checkBinary('netconvert')
+
+with open('grid.nod.xml', 'w') as nodes:
+    print('<nodes>', file=nodes)
+    for x in range(SIZE):
+        for y in range(SIZE):
+            # a traffic light every third junction so the junctions differ
+            print('    <node id="%s_%s" x="%s" y="%s" type="%s"/>' % (
+                x, y, 100 * x, 100 * y, "traffic_light" if (x + y) % 3 == 0 else "priority"), file=nodes)
+    print('</nodes>', file=nodes)
+
+with open('grid.edg.xml', 'w') as edges:
+    print('<edges>', file=edges)
+    for x in range(SIZE):
+        for y in range(SIZE):
+            for dx, dy in ((1, 0), (0, 1)):
+                if x + dx < SIZE and y + dy < SIZE:
+                    a = "%s_%s" % (x, y)
+                    b = "%s_%s" % (x + dx, y + dy)
+                    numLanes = 1 + (x + y) % 2
+                    print('    <edge id="%sto%s" from="%s" to="%s" numLanes="%s"/>' % (a, b, a, b, numLanes), file=edges)
+                    print('    <edge id="%sto%s" from="%s" to="%s" numLanes="%s"/>' % (b, a, b, a, numLanes), file=edges)
+    print('</edges>', file=edges)
+
+
+def build(threads):
+    output = "threads%s.net.xml" % threads
+    subprocess.call([netconvert, '-n', 'grid.nod.xml', '-e', 'grid.edg.xml', '-o', output,
+                     '--threads', str(threads)], stdout=sys.stdout, stderr=sys.stderr)
+    sys.stdout.flush()
+    with open(output) as net:
+        # skip the header which contains the options
+        return net.read().split("-->", 1)[1]
+
+
+serial = build(1)
+print("edges: %s, junctions: %s" % (serial.count('<edge id="') - serial.count('<edge id=":'),
+                                    serial.count('<junction id="') - serial.count('<junction id=":')))
+for threads in (2, 4):
+    print("%s threads give an identical network: %s" % (threads, build(threads) == serial))
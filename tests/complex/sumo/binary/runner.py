@@ -43,3 +43,8 @@ sys.stdout.flush()
 print(">>> Running Simulation with binary input")
 subprocess.call(
     [sumoBinary, "-c", "sumo.sumocfg"], stdout=sys.stdout, stderr=sys.stderr)
+sys.stdout.flush()
+print(">>> Running Simulation with binary input and validation")
+sys.stdout.flush()
+subprocess.call(
+    [sumoBinary, "-c", "sumo.sumocfg", "--xml-validation", "always"], stdout=sys.stdout, stderr=sys.stderr)
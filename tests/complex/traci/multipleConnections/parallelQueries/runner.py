@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-19
+# @version $Id$
+
+from __future__ import absolute_import
+from __future__ import print_function
+
+import os
+import subprocess
+import sys
+import time
+from multiprocessing import Event, Process, Queue, freeze_support
+
+sumoHome = os.path.abspath(
+    os.path.join(os.path.dirname(sys.argv[0]), '..', '..', '..', '..', '..'))
+sys.path.append(os.path.join(sumoHome, "tools"))
+import sumolib  # noqa
+import traci
+
+PORT = sumolib.miscutils.getFreeSocketPort()
+STEPS = 50
+# the step in which the first client holds its turn until the second one got an answer
+HOLD_STEP = 10
+HOLD_TIMEOUT = 10
+
+if sys.argv[1] == "sumo":
+    sumoBinary = os.environ.get(
+        "SUMO_BINARY", os.path.join(sumoHome, 'bin', 'sumo'))
+    addOption = "--remote-port %s" % PORT
+else:
+    sumoBinary = os.environ.get(
+        "GUISIM_BINARY", os.path.join(sumoHome, 'bin', 'sumo-gui'))
+    addOption = "-S -Q --remote-port %s" % PORT
+
+
+def traciLoop(port, i, results, answered):
+    time.sleep(0.25 * i)  # assure ordering of connections
+    traci.init(port)
+    traci.setOrder(i)
+    for step in range(STEPS):
+        traci.simulationStep()
+        if step == HOLD_STEP:
+            if i == 1:
+                # it is our turn, the server has to answer the other client meanwhile
+                results.put((i, "answered while holding the turn", answered.wait(HOLD_TIMEOUT)))
+            else:
+                results.put((i, "query time", traci.simulation.getCurrentTime()))
+                answered.set()
+        # only read-only requests, so both clients have to see the same state
+        state = [traci.simulation.getCurrentTime()]
+        for vehID in traci.vehicle.getIDList():
+            state.append((vehID, traci.vehicle.getRoadID(vehID), traci.vehicle.getLanePosition(vehID),
+                          traci.vehicle.getSpeed(vehID)))
+        results.put((i, step, state))
+    traci.close()
+
+
+def runSingle(numClients, parallelQueries):
+    print(" Testing with%s parallel queries..." % ("" if parallelQueries else "out"))
+    sys.stdout.flush()
+    sumoProcess = subprocess.Popen(
+        "%s --num-clients %s %s -c sumo.sumocfg %s" % (
+            sumoBinary, numClients, "--parallel-queries" if parallelQueries else "", addOption),
+        shell=True, stdout=sys.stdout)
+    results = Queue()
+    answered = Event()
+    procs = [Process(target=traciLoop, args=(PORT, (i + 1), results, answered)) for i in range(numClients)]
+    for p in procs:
+        p.start()
+    states = {}
+    for _ in range(numClients * (STEPS + 1)):
+        client, step, state = results.get()
+        if step in ("answered while holding the turn", "query time"):
+            print("client %s %s: %s" % (client, step, state))
+        else:
+            states.setdefault(step, {})[client] = state
+    for p in procs:
+        p.join()
+    sumoProcess.wait()
+    equal = [step for step, s in states.items() if all(v == s[1] for v in s.values())]
+    print("steps with equal results for all clients: %s of %s" % (len(equal), len(states)))
+    print("vehicle seen: %s" % any(len(s[1]) > 1 for s in states.values()))
+    sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    freeze_support()
+    print(" Testing queries of multiple clients...")
+    # without parallel queries the second client is only answered after the first one ended its turn
+    runSingle(2, False)
+    runSingle(2, True)
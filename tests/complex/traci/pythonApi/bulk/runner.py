@@ -0,0 +1,54 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-19
+# @version $Id$
+
+
+from __future__ import print_function
+from __future__ import absolute_import
+import os
+import subprocess
+import sys
+sys.path.append(os.path.join(
+    os.path.dirname(sys.argv[0]), "..", "..", "..", "..", "..", "tools"))
+import traci
+import traci.constants as tc
+import sumolib  # noqa
+
+sumoBinary = sumolib.checkBinary('sumo')
+
+PORT = sumolib.miscutils.getFreeSocketPort()
+sumoProcess = subprocess.Popen(
+    "%s -c sumo.sumocfg --remote-port %s" % (sumoBinary, PORT), shell=True, stdout=sys.stdout)
+traci.init(PORT)
+for step in range(3):
+    print("step", step)
+    traci.simulationStep()
+junctions = traci.junction.getIDList()
+positions = traci.junction.getBulk(tc.VAR_POSITION, junctions)
+for junctionID in junctions:
+    print("pos", junctionID, positions[junctionID])
+    if positions[junctionID] != traci.junction.getPosition(junctionID):
+        print("bulk result differs for", junctionID)
+print("empty", traci.junction.getBulk(tc.VAR_POSITION, []))
+try:
+    traci.junction.getBulk(tc.VAR_POSITION, ["0", "unknown"])
+except traci.TraCIException as e:
+    print("error", e)
+try:
+    # only get commands may be used in a bulk request
+    traci.junction._connection._getBulk(tc.CMD_SET_VEHICLE_VARIABLE, tc.VAR_SPEED, ["0"])
+except traci.TraCIException as e:
+    print("error", e)
+traci.close()
+sumoProcess.wait()
@@ -0,0 +1,52 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+# Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+# This program and the accompanying materials
+# are made available under the terms of the Eclipse Public License v2.0
+# which accompanies this distribution, and is available at
+# http://www.eclipse.org/legal/epl-v20.html
+# SPDX-License-Identifier: EPL-2.0
+
+# @file    runner.py
+# @author  agent
+# @date    2026-10-19
+# @version $Id$
+
+
+from __future__ import print_function
+from __future__ import absolute_import
+import os
+import subprocess
+import sys
+sys.path.append(os.path.join(
+    os.path.dirname(sys.argv[0]), "..", "..", "..", "..", "..", "tools"))
+import traci
+import traci.constants as tc
+import sumolib  # noqa
+
+sumoBinary = sumolib.checkBinary('sumo')
+
+PORT = sumolib.miscutils.getFreeSocketPort()
+sumoProcess = subprocess.Popen(
+    "%s -c sumo.sumocfg --remote-port %s" % (sumoBinary, PORT), shell=True, stdout=sys.stdout)
+traci.init(PORT)
+variables = [tc.VAR_LENGTH, tc.VAR_MAXSPEED, tc.LANE_EDGE_ID]
+traci.junction.subscribeContext("0", tc.CMD_GET_LANE_VARIABLE, 50, variables)
+traci.junction.subscribeColumnarContext("0", tc.CMD_GET_LANE_VARIABLE, 50, variables)
+for step in range(2):
+    print("step", step)
+    traci.simulationStep()
+    ids, columns = traci.junction.getColumnarContextSubscriptionResults("0")
+    print("ids", ids)
+    print("length", list(columns[tc.VAR_LENGTH]))
+    print("maxspeed", list(columns[tc.VAR_MAXSPEED]))
+    print("edge", columns[tc.LANE_EDGE_ID])
+    rows = traci.junction.getContextSubscriptionResults("0")
+    print("consistent", sorted(rows.keys()) == ids and
+          all([rows[laneID][v] == columns[v][i] for i, laneID in enumerate(ids) for v in variables]))
+traci.junction.unsubscribeContext("0", tc.CMD_GET_LANE_VARIABLE, 50)
+traci.simulationStep()
+print("after unsubscribe", traci.junction.getColumnarContextSubscriptionResults("0"))
+traci.close()
+sumoProcess.wait()
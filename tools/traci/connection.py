@@ -162,11 +162,26 @@ class Connection:
         result.read("!B")     # Return type of the variable
         return result
 
+    def _getBulk(self, cmdID, varID, objIDs):
+        self._queue.append(tc.CMD_GET_BULK_VARIABLE)
+        length = 1 + 4 + 1 + 1 + 1 + 1 + 4 + sum([4 + len(o) for o in objIDs])
+        self._string += struct.pack("!BiBBB", 0, length, tc.CMD_GET_BULK_VARIABLE, cmdID, varID)
+        self._packStringList(objIDs)
+        result = self._sendExact()
+        result.readLength()
+        response, retCmdID, retVarID, objectNo = result.read("!BBBi")
+        if response != tc.RESPONSE_GET_BULK_VARIABLE or retCmdID != cmdID or retVarID != varID or objectNo != len(objIDs):
+            raise FatalTraCIError("Received answer %s,%s,%s for bulk command %s,%s."
+                                  % (response, retCmdID, retVarID, cmdID, varID))
+        return result
+
     def _readSubscription(self, result):
         # to enable this you also need to set _DEBUG to True in storage.py
         # result.printDebug()
         result.readLength()
         response = result.read("!B")[0]
+        if response == tc.RESPONSE_SUBSCRIBE_COLUMNAR_CONTEXT:
+            return self._readColumnarSubscription(result)
         isVariableSubscription = response >= tc.RESPONSE_SUBSCRIBE_INDUCTIONLOOP_VARIABLE and response <= tc.RESPONSE_SUBSCRIBE_PERSON_VARIABLE
         objectID = result.readString()
         if not isVariableSubscription:
@@ -205,6 +220,25 @@ class Connection:
                             "Cannot handle subscription response %02x for %s." % (response, objectID))
         return objectID, response
 
+    def _readColumnarSubscription(self, result):
+        response = result.read("!B")[0]
+        objectID = result.readString()
+        domain, numVars = result.read("!BB")
+        objIDs = result.readStringList()
+        results = self._subscriptionMapping[response]
+        results.addColumnar(objectID, objIDs)
+        if objIDs:
+            for v in range(numVars):
+                varID, status, varType = result.read("!BBB")
+                if status:
+                    print("Error!", result.readString())
+                elif varType == tc.TYPE_DOUBLE:
+                    results.addColumnar(objectID, objIDs, varID, result.readDoubleArray(len(objIDs)))
+                else:
+                    domainResults = self._subscriptionMapping[domain]
+                    results.addColumnar(objectID, objIDs, varID, [domainResults._parse(varID, result) for o in objIDs])
+        return objectID, response
+
     def _subscribe(self, cmdID, begin, end, objID, varIDs, parameters=None):
         self._queue.append(cmdID)
         length = 1 + 1 + 4 + 4 + 4 + len(objID) + 1 + len(varIDs)
@@ -233,13 +267,19 @@ class Connection:
     def _getSubscriptionResults(self, cmdID):
         return self._subscriptionMapping[cmdID]
 
-    def _subscribeContext(self, cmdID, begin, end, objID, domain, dist, varIDs):
-        self._queue.append(cmdID)
+    def _subscribeContext(self, cmdID, begin, end, objID, domain, dist, varIDs, columnar=False):
         length = 1 + 1 + 4 + 4 + 4 + len(objID) + 1 + 8 + 1 + len(varIDs)
+        if columnar:
+            self._queue.append(tc.CMD_SUBSCRIBE_COLUMNAR_CONTEXT)
+            length += 1
+        else:
+            self._queue.append(cmdID)
         if length <= 255:
             self._string += struct.pack("!B", length)
         else:
             self._string += struct.pack("!Bi", 0, length + 4)
+        if columnar:
+            self._string += struct.pack("!B", tc.CMD_SUBSCRIBE_COLUMNAR_CONTEXT)
         self._string += struct.pack("!Biii",
                                     cmdID, begin, end, len(objID)) + objID.encode("latin1")
         self._string += struct.pack("!BdB", domain, dist, len(varIDs))
@@ -54,6 +54,18 @@ CMD_CHANGESUBLANE = 0x15
 #  command: change target
 CMD_CHANGETARGET = 0x31
 
+#  command: get a variable for a list of objects
+CMD_GET_BULK_VARIABLE = 0x60
+
+#  response: get a variable for a list of objects
+RESPONSE_GET_BULK_VARIABLE = 0x70
+
+#  command: subscribe context with the results ordered by variable
+CMD_SUBSCRIBE_COLUMNAR_CONTEXT = 0x61
+
+#  response: subscribe context with the results ordered by variable
+RESPONSE_SUBSCRIBE_COLUMNAR_CONTEXT = 0x71
+
 #  command: close sumo
 CMD_CLOSE = 0x7F
 
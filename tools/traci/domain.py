@@ -25,7 +25,7 @@ import warnings
 import traci
 from . import constants as tc
 from .storage import Storage
-from .exceptions import FatalTraCIError
+from .exceptions import FatalTraCIError, TraCIException
 
 _defaultDomains = []
 
@@ -35,6 +35,7 @@ class SubscriptionResults:
     def __init__(self, valueFunc):
         self._results = {}
         self._contextResults = {}
+        self._columnarResults = {}
         self._valueFunc = valueFunc
 
     def _parse(self, varID, data):
@@ -45,6 +46,7 @@ class SubscriptionResults:
     def reset(self):
         self._results.clear()
         self._contextResults.clear()
+        self._columnarResults.clear()
 
     def add(self, refID, varID, data):
         if refID not in self._results:
@@ -70,6 +72,17 @@ class SubscriptionResults:
             return self._contextResults
         return self._contextResults.get(refID, None)
 
+    def addColumnar(self, refID, objIDs, varID=None, values=None):
+        if refID not in self._columnarResults:
+            self._columnarResults[refID] = (objIDs, {})
+        if varID is not None:
+            self._columnarResults[refID][1][varID] = values
+
+    def getColumnar(self, refID=None):
+        if refID is None:
+            return self._columnarResults
+        return self._columnarResults.get(refID, None)
+
     def __repr__(self):
         return "<%s, %s>" % (self._results, self._contextResults)
 
@@ -129,6 +142,21 @@ class Domain:
         """
         return self._getUniversal(tc.ID_COUNT, "")
 
+    def getBulk(self, varID, objectIDs):
+        """getBulk(integer, list(string)) -> dict(string: <value_type>)
+
+        Returns the value of the given variable for all given objects using a single request.
+        """
+        result = self._connection._getBulk(self._cmdGetID, varID, objectIDs)
+        values = {}
+        for objectID in objectIDs:
+            result.read("!B")     # variable
+            status, varType = result.read("!BB")
+            if status:
+                raise TraCIException(tc.CMD_GET_BULK_VARIABLE, "Error", result.readString())
+            values[objectID] = self._retValFunc[varID](result)
+        return values
+
     def subscribe(self, objectID, varIDs=None, begin=0, end=2**31 - 1):
         """subscribe(string, list(integer), double, double) -> None
 
@@ -183,6 +211,24 @@ class Domain:
     def getContextSubscriptionResults(self, objectID=None):
         return self._connection._getSubscriptionResults(self._contextResponseID).getContext(objectID)
 
+    def subscribeColumnarContext(self, objectID, domain, dist, varIDs, begin=0, end=2**31 - 1):
+        """subscribeColumnarContext(string, int, double, list(integer), double, double) -> None
+
+        Subscribe to objects of the given domain like subscribeContext but retrieve the results
+        ordered by variable (see getColumnarContextSubscriptionResults).
+        Use unsubscribeContext to remove the subscription.
+        """
+        self._connection._subscribeContext(
+            self._contextID, begin, end, objectID, domain, dist, varIDs, True)
+
+    def getColumnarContextSubscriptionResults(self, objectID=None):
+        """getColumnarContextSubscriptionResults(string) -> (list(string), dict(integer: list(<value_type>)))
+
+        Returns the ids of the objects in the context and for each variable the values in the same order.
+        Double values are returned as array.array('d').
+        """
+        return self._connection._getSubscriptionResults(self._contextResponseID).getColumnar(objectID)
+
     def getParameter(self, objID, param):
         """getParameter(string, string) -> string
 
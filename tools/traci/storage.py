@@ -18,7 +18,9 @@
 
 from __future__ import print_function
 from __future__ import absolute_import
+import array
 import struct
+import sys
 
 _DEBUG = False
 
@@ -57,6 +59,13 @@ class Storage:
             list.append(self.readString())
         return list
 
+    def readDoubleArray(self, n):
+        values = array.array("d", self._content[self._pos:self._pos + 8 * n])
+        if sys.byteorder == "little":
+            values.byteswap()
+        self._pos += 8 * n
+        return values
+
     def readShape(self):
         length = self.read("!B")[0]
         return [self.read("!dd") for i in range(length)]
@@ -0,0 +1,179 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    SharedMemorySocketTest.cpp
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// Tests SharedMemorySocket class from <SUMO>/src/foreign/tcpip
+/****************************************************************************/
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#include <gtest/gtest.h>
+#include <foreign/tcpip/shmsocket.h>
+
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <algorithm>
+#include <sstream>
+
+
+// ===========================================================================
+// test helpers
+// ===========================================================================
+static std::string
+segmentName() {
+    std::ostringstream name;
+    name << "sumo_shmtest_" << getpid();
+    return name.str();
+}
+
+
+static tcpip::Storage
+message(const int size, const int round) {
+    tcpip::Storage msg;
+    for (int i = 0; i < size; i++) {
+        msg.writeUnsignedByte((i + round) % 256);
+    }
+    return msg;
+}
+
+
+/* Starts a server process waiting for a client and returns its pid as soon as the segment is set up. */
+static pid_t
+startWaitingServer(const std::string& name) {
+    const pid_t pid = fork();
+    if (pid == 0) {
+        tcpip::SharedMemorySocket server(name);
+        server.accept();
+        _exit(0);
+    }
+    const std::string path = "/" + name;
+    while (true) {
+        const int fd = shm_open(path.c_str(), O_RDONLY, 0);
+        if (fd >= 0) {
+            struct stat st;
+            const bool ready = fstat(fd, &st) == 0 && st.st_size > 0;
+            close(fd);
+            if (ready) {
+                return pid;
+            }
+        }
+        usleep(1000);
+    }
+}
+
+
+/* Connects the client, sends the messages and checks the echoed answers, returns the exit code of the client process. */
+static int
+runClient(tcpip::Socket& client, const int rounds, const int size) {
+    try {
+        // the server may not listen yet
+        for (int retry = 0; !client.has_client_connection(); retry++) {
+            try {
+                client.connect();
+            } catch (tcpip::SocketException&) {
+                if (retry == 100) {
+                    throw;
+                }
+                usleep(10000);
+            }
+        }
+        for (int round = 0; round < rounds; round++) {
+            client.sendExact(message(size, round));
+            tcpip::Storage answer;
+            client.receiveExact(answer);
+            const tcpip::Storage expected = message(size, round);
+            if (answer.size() != expected.size() || !std::equal(answer.begin(), answer.end(), expected.begin())) {
+                return 1;
+            }
+        }
+        client.close();
+        return 0;
+    } catch (tcpip::SocketException&) {
+        return 2;
+    }
+}
+
+
+/* Starts a client process and echoes its messages, returns whether the client received all answers. */
+static bool
+echo(tcpip::Socket& server, tcpip::Socket& client, const int rounds, const int size) {
+    const pid_t pid = fork();
+    if (pid == 0) {
+        _exit(runClient(client, rounds, size));
+    }
+    tcpip::Socket* connection = server.accept(true);
+    for (int round = 0; round < rounds; round++) {
+        tcpip::Storage msg;
+        connection->receiveExact(msg);
+        connection->sendExact(msg);
+    }
+    int status = -1;
+    waitpid(pid, &status, 0);
+    delete connection;
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests the exchange of small messages and of messages exceeding the ring size. */
+TEST(SharedMemorySocket, test_exchange) {
+    tcpip::SharedMemorySocket server(segmentName());
+    tcpip::SharedMemorySocket client(segmentName());
+    EXPECT_TRUE(echo(server, client, 100, 17));
+    EXPECT_TRUE(echo(server, client, 1, 0));
+    EXPECT_TRUE(echo(server, client, 3, 3 * tcpip::SharedMemorySocket::RING_SIZE + 5));
+}
+
+
+/* Tests that the connection fails if there is no server or the peer is gone. */
+TEST(SharedMemorySocket, test_errors) {
+    tcpip::SharedMemorySocket client(segmentName());
+    EXPECT_THROW(client.connect(), tcpip::SocketException);
+    tcpip::SharedMemorySocket server(segmentName());
+    tcpip::SharedMemorySocket child(segmentName());
+    const pid_t pid = fork();
+    if (pid == 0) {
+        child.connect();
+        // exit without closing the connection
+        _exit(0);
+    }
+    tcpip::Socket* connection = server.accept(true);
+    tcpip::Storage msg;
+    EXPECT_THROW(connection->receiveExact(msg), tcpip::SocketException);
+    waitpid(pid, 0, 0);
+    delete connection;
+}
+
+
+/* Tests that a segment of a waiting server is not taken over but the one of a killed server is. */
+TEST(SharedMemorySocket, test_segment_in_use) {
+    tcpip::SharedMemorySocket server(segmentName());
+    tcpip::SharedMemorySocket client(segmentName());
+    const pid_t pid = startWaitingServer(segmentName());
+    EXPECT_THROW(server.accept(true), tcpip::SocketException);
+    // the segment of the killed server stays behind
+    kill(pid, SIGKILL);
+    waitpid(pid, 0, 0);
+    EXPECT_TRUE(echo(server, client, 10, 17));
+}
+
+#endif
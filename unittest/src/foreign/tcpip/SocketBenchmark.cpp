@@ -0,0 +1,149 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    SocketBenchmark.cpp
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// Measures round trip time and throughput of the TCP and the shared memory TraCI transport
+/****************************************************************************/
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#include <foreign/tcpip/socket.h>
+#include <foreign/tcpip/shmsocket.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#ifndef WIN32
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <chrono>
+
+
+// ===========================================================================
+// helper methods
+// ===========================================================================
+/* Creates an unconnected socket of the given transport. */
+static tcpip::Socket*
+createSocket(const std::string& transport, const bool server, const int port) {
+    if (transport == "shm") {
+        std::ostringstream name;
+        name << "sumo_benchmark_" << port;
+        return new tcpip::SharedMemorySocket(name.str());
+    }
+    if (server) {
+        return new tcpip::Socket(port);
+    }
+    return new tcpip::Socket("localhost", port);
+}
+
+
+/* Connects to the server and sends the messages, receiving the echoed answers. */
+static int
+runClient(tcpip::Socket& client, const int rounds, const int size) {
+    tcpip::Storage msg;
+    for (int i = 0; i < size; i++) {
+        msg.writeUnsignedByte(i % 256);
+    }
+    try {
+        // the server may not listen yet
+        for (int retry = 0; !client.has_client_connection(); retry++) {
+            try {
+                client.connect();
+            } catch (tcpip::SocketException&) {
+                if (retry == 100) {
+                    throw;
+                }
+                // a failed TCP connect leaves an unconnected socket behind
+                client.close();
+                usleep(10000);
+            }
+        }
+        for (int round = 0; round < rounds; round++) {
+            client.sendExact(msg);
+            tcpip::Storage answer;
+            client.receiveExact(answer);
+            if (answer.size() != msg.size()) {
+                return 1;
+            }
+        }
+        client.close();
+        return 0;
+    } catch (tcpip::SocketException& e) {
+        std::cerr << "client: " << e.what() << std::endl;
+        return 2;
+    }
+}
+
+
+// ===========================================================================
+// main
+// ===========================================================================
+int
+main(int argc, char** argv) {
+    if (argc < 2 || (std::string(argv[1]) != "tcp" && std::string(argv[1]) != "shm")) {
+        std::cerr << "Usage: " << argv[0] << " tcp|shm [<rounds> [<message size> [<port>]]]" << std::endl;
+        return 1;
+    }
+    const std::string transport = argv[1];
+    const int rounds = argc > 2 ? atoi(argv[2]) : 10000;
+    const int size = argc > 3 ? atoi(argv[3]) : 16;
+    const int port = argc > 4 ? atoi(argv[4]) : 20000 + getpid() % 10000;
+    tcpip::Socket* const server = createSocket(transport, true, port);
+    tcpip::Socket* const client = createSocket(transport, false, port);
+    const pid_t pid = fork();
+    if (pid == 0) {
+        _exit(runClient(*client, rounds, size));
+    }
+    try {
+        tcpip::Socket* const connection = server->accept(true);
+        const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; round++) {
+            tcpip::Storage msg;
+            connection->receiveExact(msg);
+            connection->sendExact(msg);
+        }
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        delete connection;
+        int status = -1;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            std::cerr << "The client failed." << std::endl;
+            return 1;
+        }
+        const double seconds = std::chrono::duration<double>(end - begin).count();
+        std::cout << transport << ": " << rounds << " round trips with " << size << " bytes, "
+                  << seconds * 1e6 / rounds << "us per round trip, "
+                  << 2. * rounds * size / seconds / 1e6 << "MB/s" << std::endl;
+    } catch (tcpip::SocketException& e) {
+        std::cerr << "server: " << e.what() << std::endl;
+        waitpid(pid, 0, 0);
+        return 1;
+    }
+    delete client;
+    delete server;
+    return 0;
+}
+
+#else
+
+int
+main(int, char**) {
+    std::cerr << "The socket benchmark is not available on Windows." << std::endl;
+    return 1;
+}
+
+#endif
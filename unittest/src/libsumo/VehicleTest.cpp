@@ -0,0 +1,162 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    VehicleTest.cpp
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// Tests the vectorized value retrieval of the class libsumo::Vehicle
+/****************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <microsim/MSNet.h>
+#include <utils/common/SystemFrame.h>
+#include <libsumo/Simulation.h>
+#include <libsumo/Vehicle.h>
+
+
+class VehicleTest : public testing::Test {
+protected :
+
+    /// @brief loads a straight road with three vehicles departing one second apart (a new simulation for every test)
+    virtual void SetUp() {
+        std::ofstream net("libsumo_vehicle_test.net.xml");
+        net << "<net version=\"1.0\">\n"
+            << "    <location netOffset=\"0.00,0.00\" convBoundary=\"0.00,0.00,1000.00,0.00\" origBoundary=\"0.00,0.00,1000.00,0.00\" projParameter=\"!\"/>\n"
+            << "    <edge id=\"e\" from=\"A\" to=\"B\" priority=\"1\">\n"
+            << "        <lane id=\"e_0\" index=\"0\" speed=\"13.89\" length=\"1000.00\" shape=\"0.00,-1.60 1000.00,-1.60\"/>\n"
+            << "    </edge>\n"
+            << "    <junction id=\"A\" type=\"dead_end\" x=\"0.00\" y=\"0.00\" incLanes=\"\" intLanes=\"\" shape=\"0.00,0.00 0.00,-3.20\"/>\n"
+            << "    <junction id=\"B\" type=\"dead_end\" x=\"1000.00\" y=\"0.00\" incLanes=\"e_0\" intLanes=\"\" shape=\"1000.00,-3.20 1000.00,0.00\"/>\n"
+            << "</net>\n";
+        net.close();
+        std::ofstream routes("libsumo_vehicle_test.rou.xml");
+        routes << "<routes>\n"
+               << "    <route id=\"r\" edges=\"e\"/>\n"
+               << "    <vehicle id=\"v0\" route=\"r\" depart=\"0\" departSpeed=\"max\"/>\n"
+               << "    <vehicle id=\"v1\" route=\"r\" depart=\"1\" departSpeed=\"max\"/>\n"
+               << "    <vehicle id=\"v2\" route=\"r\" depart=\"2\" departSpeed=\"max\"/>\n"
+               << "</routes>\n";
+        routes.close();
+        std::vector<std::string> args;
+        args.push_back("-n");
+        args.push_back("libsumo_vehicle_test.net.xml");
+        args.push_back("-r");
+        args.push_back("libsumo_vehicle_test.rou.xml");
+        args.push_back("--no-step-log");
+        libsumo::Simulation::load(args);
+        // all three vehicles are running afterwards
+        libsumo::Simulation::simulationStep(TIME2STEPS(5));
+    }
+
+    virtual void TearDown() {
+        delete MSNet::getInstance();
+        SystemFrame::close();
+        std::remove("libsumo_vehicle_test.net.xml");
+        std::remove("libsumo_vehicle_test.rou.xml");
+    }
+
+    /// @brief the variables retrieved by the tests
+    static std::vector<int> variables() {
+        std::vector<int> result;
+        result.push_back(VAR_SPEED);
+        result.push_back(VAR_LANEPOSITION);
+        result.push_back(VAR_LANE_INDEX);
+        result.push_back(VAR_POSITION);
+        return result;
+    }
+
+    /// @brief checks the columns of the result against the single value getters
+    static void checkValues(const libsumo::TraCIColumnarResults& result, const std::vector<std::string>& ids) {
+        ASSERT_EQ(3, (int)result.scalars.size());
+        ASSERT_EQ(1, (int)result.positions.size());
+        EXPECT_TRUE(result.values.empty());
+        const std::vector<double>& speeds = result.scalars.find(VAR_SPEED)->second;
+        const std::vector<double>& lanePositions = result.scalars.find(VAR_LANEPOSITION)->second;
+        const std::vector<double>& laneIndices = result.scalars.find(VAR_LANE_INDEX)->second;
+        const std::vector<libsumo::TraCIPosition>& positions = result.positions.find(VAR_POSITION)->second;
+        ASSERT_EQ(ids.size(), speeds.size());
+        ASSERT_EQ(ids.size(), lanePositions.size());
+        ASSERT_EQ(ids.size(), laneIndices.size());
+        ASSERT_EQ(ids.size(), positions.size());
+        for (int i = 0; i < (int)ids.size(); i++) {
+            EXPECT_DOUBLE_EQ(libsumo::Vehicle::getSpeed(ids[i]), speeds[i]);
+            EXPECT_DOUBLE_EQ(libsumo::Vehicle::getLanePosition(ids[i]), lanePositions[i]);
+            EXPECT_DOUBLE_EQ(libsumo::Vehicle::getLaneIndex(ids[i]), laneIndices[i]);
+            const libsumo::TraCIPosition pos = libsumo::Vehicle::getPosition(ids[i]);
+            EXPECT_DOUBLE_EQ(pos.x, positions[i].x);
+            EXPECT_DOUBLE_EQ(pos.y, positions[i].y);
+        }
+    }
+};
+
+
+/* Test the method 'getAll'.*/
+TEST_F(VehicleTest, test_method_getAll) {
+    const libsumo::TraCIColumnarResults result = libsumo::Vehicle::getAll(variables());
+    EXPECT_EQ(libsumo::Vehicle::getIDList(), result.ids);
+    EXPECT_EQ(3, (int)result.ids.size());
+    checkValues(result, result.ids);
+}
+
+
+/* Test the method 'getValues'.*/
+TEST_F(VehicleTest, test_method_getValues) {
+    std::vector<std::string> ids;
+    ids.push_back("v2");
+    ids.push_back("v0");
+    const libsumo::TraCIColumnarResults result = libsumo::Vehicle::getValues(ids, variables());
+    EXPECT_EQ(ids, result.ids);
+    checkValues(result, ids);
+    ids.push_back("unknown");
+    EXPECT_THROW(libsumo::Vehicle::getValues(ids, variables()), libsumo::TraCIException);
+}
+
+
+/* Test the methods 'getHandle' and 'getHandles'.*/
+TEST_F(VehicleTest, test_method_getHandle) {
+    const int handle = libsumo::Vehicle::getHandle("v1");
+    EXPECT_EQ(handle, libsumo::Vehicle::getHandle("v1"));
+    EXPECT_NE(handle, libsumo::Vehicle::getHandle("v0"));
+    std::vector<std::string> ids;
+    ids.push_back("v0");
+    ids.push_back("v1");
+    const std::vector<int> handles = libsumo::Vehicle::getHandles(ids);
+    ASSERT_EQ(2, (int)handles.size());
+    EXPECT_EQ(libsumo::Vehicle::getHandle("v0"), handles[0]);
+    EXPECT_EQ(handle, handles[1]);
+    EXPECT_THROW(libsumo::Vehicle::getHandle("unknown"), libsumo::TraCIException);
+}
+
+
+/* Test the method 'getValuesByHandle'.*/
+TEST_F(VehicleTest, test_method_getValuesByHandle) {
+    std::vector<std::string> ids;
+    ids.push_back("v1");
+    ids.push_back("v2");
+    const libsumo::TraCIColumnarResults result = libsumo::Vehicle::getValuesByHandle(libsumo::Vehicle::getHandles(ids), variables());
+    EXPECT_TRUE(result.ids.empty());
+    checkValues(result, ids);
+    std::vector<int> invalid;
+    invalid.push_back(-1);
+    EXPECT_THROW(libsumo::Vehicle::getValuesByHandle(invalid, variables()), libsumo::TraCIException);
+}
+
+
+/* Test that handles become invalid when the vehicle arrives.*/
+TEST_F(VehicleTest, test_handle_after_arrival) {
+    std::vector<int> handles;
+    handles.push_back(libsumo::Vehicle::getHandle("v0"));
+    libsumo::Simulation::simulationStep(TIME2STEPS(200));
+    EXPECT_EQ(0, libsumo::Vehicle::getIDCount());
+    EXPECT_THROW(libsumo::Vehicle::getValuesByHandle(handles, variables()), libsumo::TraCIException);
+}
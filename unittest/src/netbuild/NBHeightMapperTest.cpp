@@ -18,9 +18,69 @@
 
 #include <gtest/gtest.h>
 #include <netbuild/NBHeightMapper.h>
+#include <utils/common/ToString.h>
+
+#ifdef HAVE_GDAL
+#if __GNUC__ > 3
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+#include <gdal_priv.h>
+#include <cpl_vsi.h>
+#if __GNUC__ > 3
+#pragma GCC diagnostic pop
+#endif
+#endif
 
 class NBHeightMapperTest : public testing::Test {
 protected :
+#ifdef HAVE_GDAL
+    /* Returns the height of the given pixel of a raster written by loadTiff. */
+    static int height(double left, int x, int y) {
+        return (int)left + x + 7 * y;
+    }
+
+    /* Writes a GeoTIFF (in memory) with square pixels of 1m whose top left corner is at the given position and loads it. */
+    static void loadTiff(const std::string& name, double left, double top, int xSize, int ySize) {
+        GDALAllRegister();
+        const std::string file = "/vsimem/" + name + ".tif";
+        GDALDataset* dataset = GetGDALDriverManager()->GetDriverByName("GTiff")->Create(file.c_str(), xSize, ySize, 1, GDT_Int16, 0);
+        double transform[6] = {left, 1., 0., top, 0., -1.};
+        dataset->SetGeoTransform(transform);
+        std::vector<int16_t> data(xSize * ySize);
+        for (int y = 0; y < ySize; y++) {
+            for (int x = 0; x < xSize; x++) {
+                data[y * xSize + x] = (int16_t)height(left, x, y);
+            }
+        }
+        dataset->GetRasterBand(1)->RasterIO(GF_Write, 0, 0, xSize, ySize, &data[0], xSize, ySize, GDT_Int16, 0, 0);
+        GDALClose(dataset);
+        NBHeightMapper::Singleton.loadTiff(file);
+        myFiles.push_back(file);
+    }
+
+    /* Returns the size (in pixels) of the square tiles. */
+    static int tileSize() {
+        return NBHeightMapper::TILE_SIZE;
+    }
+
+    /* Returns the maximum number of tiles in memory. */
+    static int maxCachedTiles() {
+        return NBHeightMapper::MAX_CACHED_TILES;
+    }
+
+    /* Returns the number of tiles in memory. */
+    static int cachedTiles() {
+        return (int)NBHeightMapper::Singleton.myTiles.size();
+    }
+
+    /* Returns whether the tile of the raster is in memory. */
+    static bool isCached(int raster, int tile) {
+        return NBHeightMapper::Singleton.myTileIndex.count(std::make_pair(raster, tile)) > 0;
+    }
+
+    static std::vector<std::string> myFiles;
+#endif
 
     virtual void SetUp(){
         NBHeightMapper &hm = NBHeightMapper::Singleton;
@@ -46,9 +106,19 @@ protected :
     virtual void TearDown(){
         NBHeightMapper &hm = NBHeightMapper::Singleton;
         hm.clearData();
+#ifdef HAVE_GDAL
+        for (std::vector<std::string>::const_iterator it = myFiles.begin(); it != myFiles.end(); ++it) {
+            VSIUnlink(it->c_str());
+        }
+        myFiles.clear();
+#endif
     }
 };
 
+#ifdef HAVE_GDAL
+std::vector<std::string> NBHeightMapperTest::myFiles;
+#endif
+
 /* Test the method 'getZ'*/
 TEST_F(NBHeightMapperTest, test_method_getZ) {
     const NBHeightMapper &hm = NBHeightMapper::get();
@@ -60,3 +130,67 @@ TEST_F(NBHeightMapperTest, test_method_getZ) {
 }
 
 
+#ifdef HAVE_GDAL
+/* Test that the least recently used tile is dropped when more than MAX_CACHED_TILES tiles are read */
+TEST_F(NBHeightMapperTest, test_method_getZ_tile_eviction) {
+    const NBHeightMapper &hm = NBHeightMapper::get();
+    // one small raster (and tile) per 4m, their heights differ by the left border
+    const int numRasters = maxCachedTiles() + 1;
+    for (int i = 0; i < numRasters; i++) {
+        loadTiff("eviction" + toString(i), 100. + 4 * i, 10., 4, 4);
+    }
+    for (int i = 0; i < numRasters; i++) {
+        EXPECT_DOUBLE_EQ(height(100. + 4 * i, 1, 2), hm.getZ(Position(100. + 4 * i + 1.5, 10. - 2.5)));
+    }
+    EXPECT_EQ(maxCachedTiles(), cachedTiles());
+    EXPECT_FALSE(isCached(0, 0));
+    EXPECT_TRUE(isCached(1, 0));
+    EXPECT_TRUE(isCached(numRasters - 1, 0));
+    // reading the first raster again drops the least recently used one
+    EXPECT_DOUBLE_EQ(height(108., 3, 0), hm.getZ(Position(108. + 3.5, 10. - 0.5)));
+    EXPECT_DOUBLE_EQ(height(100., 0, 3), hm.getZ(Position(100. + 0.5, 10. - 3.5)));
+    EXPECT_EQ(maxCachedTiles(), cachedTiles());
+    EXPECT_TRUE(isCached(0, 0));
+    EXPECT_FALSE(isCached(1, 0));
+    // the third raster was used recently, so reading the second one drops the fourth
+    EXPECT_DOUBLE_EQ(height(104., 2, 1), hm.getZ(Position(104. + 2.5, 10. - 1.5)));
+    EXPECT_EQ(maxCachedTiles(), cachedTiles());
+    EXPECT_TRUE(isCached(1, 0));
+    EXPECT_TRUE(isCached(2, 0));
+    EXPECT_FALSE(isCached(3, 0));
+}
+
+
+/* Test samples on the borders between the tiles of a raster and on the border of the raster */
+TEST_F(NBHeightMapperTest, test_method_getZ_tile_border) {
+    const NBHeightMapper &hm = NBHeightMapper::get();
+    const int size = tileSize() + 10;
+    loadTiff("border", 100., 1000., size, size);
+    const int last = tileSize() - 1;
+    // the pixel centers on both sides of the tile border and the border between them
+    EXPECT_DOUBLE_EQ(height(100., last, 5), hm.getZ(Position(100. + last + 0.5, 1000. - 5.5)));
+    EXPECT_DOUBLE_EQ(height(100., last + 1, 5), hm.getZ(Position(100. + last + 1.5, 1000. - 5.5)));
+    EXPECT_DOUBLE_EQ(height(100., last, 5) + 0.5, hm.getZ(Position(100. + last + 1., 1000. - 5.5)));
+    EXPECT_DOUBLE_EQ(height(100., last, last) + 0.5 + 3.5, hm.getZ(Position(100. + last + 1., 1000. - last - 1.)));
+    EXPECT_EQ(4, cachedTiles());
+    // the last pixel and the border of the raster (the pixels beyond the border repeat the last ones)
+    EXPECT_DOUBLE_EQ(height(100., size - 1, size - 1), hm.getZ(Position(100. + size - 0.5, 1000. - size + 0.5)));
+    EXPECT_DOUBLE_EQ(height(100., size - 1, 5), hm.getZ(Position(100. + size, 1000. - 5.5)));
+    EXPECT_DOUBLE_EQ(height(100., 0, 0), hm.getZ(Position(100., 1000.)));
+}
+
+
+/* Test the combination of several rasters and of rasters and triangles */
+TEST_F(NBHeightMapperTest, test_method_getZ_several_rasters) {
+    const NBHeightMapper &hm = NBHeightMapper::get();
+    loadTiff("west", 100., 20., 10, 10);
+    loadTiff("east", 110., 20., 10, 10);
+    EXPECT_DOUBLE_EQ(height(100., 2, 3), hm.getZ(Position(102.5, 16.5)));
+    EXPECT_DOUBLE_EQ(height(110., 2, 3), hm.getZ(Position(112.5, 16.5)));
+    // on the common border the first raster is used
+    EXPECT_DOUBLE_EQ(height(100., 9, 3), hm.getZ(Position(110., 16.5)));
+    // outside the rasters the triangles are used
+    EXPECT_DOUBLE_EQ(0., hm.getZ(Position(0.25, 0.25)));
+    EXPECT_DOUBLE_EQ(2., hm.getZ(Position(1.5, 0.5)));
+}
+#endif
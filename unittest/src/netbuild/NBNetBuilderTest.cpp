@@ -0,0 +1,177 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    NBNetBuilderTest.cpp
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// Tests the incremental computation of the class NBNetBuilder
+/****************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <gtest/gtest.h>
+#include <utils/common/SystemFrame.h>
+#include <utils/common/ToString.h>
+#include <utils/geom/GeoConvHelper.h>
+#include <utils/options/OptionsCont.h>
+#include <netbuild/NBEdge.h>
+#include <netbuild/NBEdgeCont.h>
+#include <netbuild/NBFrame.h>
+#include <netbuild/NBNetBuilder.h>
+#include <netbuild/NBNode.h>
+#include <netbuild/NBNodeCont.h>
+#include <netbuild/NBOwnTLDef.h>
+#include <netbuild/NBTrafficLightLogicCont.h>
+#include <netwrite/NWFrame.h>
+#include <netwrite/NWWriter_SUMO.h>
+
+
+class NBNetBuilderTest : public testing::Test {
+protected :
+
+    virtual void SetUp() {
+        OptionsCont& oc = OptionsCont::getOptions();
+        oc.clear();
+        oc.addOptionSubTopic("Output");
+        oc.addOptionSubTopic("TLS Building");
+        oc.addOptionSubTopic("Ramp Guessing");
+        oc.addOptionSubTopic("Edge Removal");
+        oc.addOptionSubTopic("Unregulated Nodes");
+        oc.addOptionSubTopic("Processing");
+        oc.addOptionSubTopic("Building Defaults");
+        SystemFrame::addReportOptions(oc);
+        GeoConvHelper::addProjectionOptions(oc);
+        NBFrame::fillOptions(false);
+        NWFrame::fillOptions(false);
+        GeoConvHelper::init("!", Position(), Boundary(), Boundary());
+    }
+
+    virtual void TearDown() {
+        OptionsCont::getOptions().clear();
+    }
+
+    /// @brief builds a 3x3 grid with a traffic light in the center and a one-way spur to a dead end
+    static void buildGrid(NBNetBuilder& nb) {
+        NBNodeCont& nc = nb.getNodeCont();
+        NBEdgeCont& ec = nb.getEdgeCont();
+        for (int x = 0; x < 3; x++) {
+            for (int y = 0; y < 3; y++) {
+                const SumoXMLNodeType type = x == 1 && y == 1 ? NODETYPE_TRAFFIC_LIGHT : NODETYPE_PRIORITY;
+                nc.insert(new NBNode(toString(x) + toString(y), Position(100. * x, 100. * y), type));
+            }
+        }
+        NBNode* const center = nc.retrieve("11");
+        nb.getTLLogicCont().insert(new NBOwnTLDef(center->getID(), center, 0, TLTYPE_STATIC));
+        for (int x = 0; x < 3; x++) {
+            for (int y = 0; y < 3; y++) {
+                NBNode* const from = nc.retrieve(toString(x) + toString(y));
+                if (x < 2) {
+                    NBNode* const to = nc.retrieve(toString(x + 1) + toString(y));
+                    ec.insert(new NBEdge(from->getID() + to->getID(), from, to, "", 13.89, 2, -1, NBEdge::UNSPECIFIED_WIDTH, NBEdge::UNSPECIFIED_OFFSET));
+                    ec.insert(new NBEdge(to->getID() + from->getID(), to, from, "", 13.89, 2, -1, NBEdge::UNSPECIFIED_WIDTH, NBEdge::UNSPECIFIED_OFFSET));
+                }
+                if (y < 2) {
+                    NBNode* const to = nc.retrieve(toString(x) + toString(y + 1));
+                    ec.insert(new NBEdge(from->getID() + to->getID(), from, to, "", 13.89, 1, -1, NBEdge::UNSPECIFIED_WIDTH, NBEdge::UNSPECIFIED_OFFSET));
+                    ec.insert(new NBEdge(to->getID() + from->getID(), to, from, "", 13.89, 1, -1, NBEdge::UNSPECIFIED_WIDTH, NBEdge::UNSPECIFIED_OFFSET));
+                }
+            }
+        }
+        nc.insert(new NBNode("30", Position(300., 0.), NODETYPE_PRIORITY));
+        nc.insert(new NBNode("31", Position(300., 100.), NODETYPE_PRIORITY));
+        ec.insert(new NBEdge("spur", nc.retrieve("20"), nc.retrieve("30"), "", 13.89, 1, -1, NBEdge::UNSPECIFIED_WIDTH, NBEdge::UNSPECIFIED_OFFSET));
+    }
+
+    /// @brief applies the typical modifications of netedit and marks the affected nodes like netedit does
+    static void edit(NBNetBuilder& nb) {
+        NBNodeCont& nc = nb.getNodeCont();
+        NBEdgeCont& ec = nb.getEdgeCont();
+        // move a junction (within the network boundary, moving the origin would recompute everything)
+        NBNode* const moved = nc.retrieve("00");
+        moved->reinit(Position(10., 10.), moved->getType(), true);
+        nc.markAsChanged(moved);
+        // change the type of a junction
+        NBNode* const retyped = nc.retrieve("20");
+        retyped->reinit(retyped->getPosition(), NODETYPE_RIGHT_BEFORE_LEFT);
+        nc.markAsChanged(retyped);
+        // add a lane to an edge leaving the traffic light
+        NBEdge* const widened = ec.retrieve("1121");
+        widened->incLaneNo(1);
+        nc.markAsChanged(widened->getFromNode());
+        nc.markAsChanged(widened->getToNode());
+        // change the destination of an edge, both the old and the new endpoints are affected
+        //  (the old one is not connected to any other changed junction afterwards)
+        NBEdge* const rerouted = ec.retrieve("spur");
+        NBNode* const newTo = nc.retrieve("31");
+        nc.markAsChanged(rerouted->getFromNode());
+        nc.markAsChanged(rerouted->getToNode());
+        nc.markAsChanged(newTo);
+        rerouted->reinitNodes(rerouted->getFromNode(), newTo);
+    }
+
+    /// @brief writes the network and returns the content following the xml header
+    static std::string write(NBNetBuilder& nb, const std::string& file) {
+        OptionsCont& oc = OptionsCont::getOptions();
+        oc.resetWritable();
+        oc.set("output-file", file);
+        NWWriter_SUMO::writeNetwork(oc, nb);
+        std::ifstream strm(file.c_str());
+        std::stringstream content;
+        content << strm.rdbuf();
+        strm.close();
+        std::remove(file.c_str());
+        const std::string result = content.str();
+        return result.substr(result.find("<net "));
+    }
+};
+
+
+/* Test that the incremental computation yields the same network as the full one */
+TEST_F(NBNetBuilderTest, test_method_compute_incremental) {
+    OptionsCont& oc = OptionsCont::getOptions();
+    NBNetBuilder full;
+    NBNetBuilder incremental;
+    buildGrid(full);
+    buildGrid(incremental);
+    // the first computation in netedit is always complete
+    full.compute(oc, std::set<std::string>(), false);
+    incremental.compute(oc, std::set<std::string>(), false);
+    EXPECT_EQ(write(full, "full_initial.net.xml"), write(incremental, "incremental_initial.net.xml"));
+
+    edit(full);
+    edit(incremental);
+    EXPECT_TRUE(incremental.getNodeCont().hasChanged());
+    full.compute(oc, std::set<std::string>(), false);
+    incremental.compute(oc, std::set<std::string>(), false, true);
+    EXPECT_FALSE(incremental.getNodeCont().hasChanged());
+    EXPECT_EQ(write(full, "full.net.xml"), write(incremental, "incremental.net.xml"));
+}
+
+
+/* Test that an incremental computation without marked nodes recomputes everything */
+TEST_F(NBNetBuilderTest, test_method_compute_incremental_unmarked) {
+    OptionsCont& oc = OptionsCont::getOptions();
+    NBNetBuilder full;
+    NBNetBuilder incremental;
+    buildGrid(full);
+    buildGrid(incremental);
+    full.compute(oc, std::set<std::string>(), false);
+    incremental.compute(oc, std::set<std::string>(), false);
+
+    // modify the network without telling which nodes are affected
+    full.getEdgeCont().retrieve("1121")->incLaneNo(1);
+    incremental.getEdgeCont().retrieve("1121")->incLaneNo(1);
+    EXPECT_FALSE(incremental.getNodeCont().hasChanged());
+    full.compute(oc, std::set<std::string>(), false);
+    incremental.compute(oc, std::set<std::string>(), false, true);
+    EXPECT_EQ(write(full, "full.net.xml"), write(incremental, "incremental.net.xml"));
+}
@@ -33,6 +33,16 @@
 // ===========================================================================
 // test definitions
 // ===========================================================================
+/* Test the method '_2str'.*/
+TEST(TplConvert, test_2str) {
+    const unsigned short wide[] = {'a', 'b', 0x00e4, 0x20ac, 'c', 0};
+    EXPECT_EQ("ab\xe4?c", TplConvert::_2str(wide));
+    EXPECT_EQ("ab", TplConvert::_2str(wide, 2));
+    EXPECT_EQ("", TplConvert::_2str(wide, 0));
+    EXPECT_EQ("abc", TplConvert::_2str("abcdef", 3));
+    EXPECT_THROW(TplConvert::_2str((const unsigned short*)0, 1), EmptyData);
+}
+
 /* Test the method '_2int'.*/
 TEST(TplConvert, test_2int) {
     EXPECT_EQ(0, TplConvert::_2int("0"));
@@ -94,4 +104,11 @@ TEST(TplConvert, test_2bool) {
     EXPECT_THROW(TplConvert::_2bool("1e0"), BoolFormatException);
     EXPECT_THROW(TplConvert::_2bool("Trari"), BoolFormatException);
     EXPECT_THROW(TplConvert::_2bool("yessir"), BoolFormatException);
+    const unsigned short wideTrue[] = {'T', 'r', 'U', 'e', 0};
+    const unsigned short wideFalse[] = {'f', 'A', 'l', 's', 'e', 0};
+    const unsigned short wideInvalid[] = {'n', 0x016f, 0};
+    EXPECT_EQ(true, TplConvert::_2bool(wideTrue));
+    EXPECT_FALSE(TplConvert::_2bool(wideFalse));
+    EXPECT_THROW(TplConvert::_2bool(wideInvalid), BoolFormatException);
+    EXPECT_THROW(TplConvert::_2bool("falsey"), BoolFormatException);
 }
@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 #include <utils/geom/GeoConvHelper.h>
+#include <utils/geom/PositionVector.h>
 
 /*
 Tests the class GeoConvHelper
@@ -36,3 +37,74 @@ TEST(GeoConvHelper, test_method_x2cartesian) {
 	EXPECT_DOUBLE_EQ(400235.50494557252, pos.x());
 	EXPECT_DOUBLE_EQ(5809666.826070101, pos.y());
 }
+
+
+/* Test the method 'x2cartesian' for many positions (fast UTM) against the conversion of single positions */
+TEST(GeoConvHelper, test_method_x2cartesian_vector) {
+    GeoConvHelper single("UTM", Position(-400000, -5800000), Boundary(), Boundary(), 1, false);
+    GeoConvHelper batch("UTM", Position(-400000, -5800000), Boundary(), Boundary(), 1, false);
+    PositionVector geo;
+    geo.push_back(Position(13.4, 52.5));
+    geo.push_back(Position(13.5326994, 52.428098100000007));
+    geo.push_back(Position(12.0, 0.5, 10.));
+    geo.push_back(Position(17.9, -33.9));
+    geo.push_back(Position(15.0, 70.0));
+    PositionVector converted = geo;
+    EXPECT_TRUE(batch.x2cartesian(converted));
+    ASSERT_EQ(geo.size(), converted.size());
+    for (int i = 0; i < (int)geo.size(); i++) {
+        Position pos = geo[i];
+        EXPECT_TRUE(single.x2cartesian(pos));
+        EXPECT_NEAR(pos.x(), converted[i].x(), 0.001);
+        EXPECT_NEAR(pos.y(), converted[i].y(), 0.001);
+        EXPECT_DOUBLE_EQ(pos.z(), converted[i].z());
+    }
+    // see test_method_x2cartesian
+    EXPECT_NEAR(400235.50494557252 - 400000, converted[1].x(), 0.00001);
+    EXPECT_NEAR(5809666.826070101 - 5800000, converted[1].y(), 0.00001);
+    EXPECT_DOUBLE_EQ(single.getOrigBoundary().xmin(), batch.getOrigBoundary().xmin());
+    EXPECT_DOUBLE_EQ(single.getOrigBoundary().ymax(), batch.getOrigBoundary().ymax());
+    EXPECT_NEAR(single.getConvBoundary().xmin(), batch.getConvBoundary().xmin(), 0.001);
+    EXPECT_NEAR(single.getConvBoundary().ymax(), batch.getConvBoundary().ymax(), 0.001);
+    // invalid coordinates are kept but the others are still converted
+    PositionVector invalid;
+    invalid.push_back(Position(13.4, 52.5));
+    invalid.push_back(Position(213.4, 52.5));
+    invalid.push_back(Position(13.4, 52.5));
+    EXPECT_FALSE(batch.x2cartesian(invalid));
+    EXPECT_DOUBLE_EQ(213.4, invalid[1].x());
+    EXPECT_DOUBLE_EQ(converted[0].x(), invalid[2].x());
+}
+
+
+/* Test the conversion of the simple projection and the copies for threads */
+TEST(GeoConvHelper, test_method_copyForThread) {
+    GeoConvHelper gch("-", Position(), Boundary(), Boundary(), 1, false);
+    PositionVector geo;
+    geo.push_back(Position(13.4, 52.5));
+    geo.push_back(Position(13.5, 52.4));
+    geo.push_back(Position(13.3, 52.6));
+    geo.push_back(Position(13.6, 52.3));
+    PositionVector converted = geo;
+    EXPECT_TRUE(gch.x2cartesian(converted));
+    GeoConvHelper parallel("-", Position(), Boundary(), Boundary(), 1, false);
+    PositionVector first(geo.begin(), geo.begin() + 2);
+    PositionVector second(geo.begin() + 2, geo.end());
+    EXPECT_TRUE(parallel.x2cartesian(first));
+    GeoConvHelper* copy = parallel.copyForThread();
+    EXPECT_TRUE(copy->x2cartesian(second));
+    EXPECT_FALSE(parallel.getConvBoundary().around(second[0]));
+    parallel.includeBoundaries(*copy);
+    delete copy;
+    for (int i = 0; i < 2; i++) {
+        EXPECT_DOUBLE_EQ(converted[i].x(), first[i].x());
+        EXPECT_DOUBLE_EQ(converted[i].y(), first[i].y());
+        EXPECT_DOUBLE_EQ(converted[i + 2].x(), second[i].x());
+        EXPECT_DOUBLE_EQ(converted[i + 2].y(), second[i].y());
+    }
+    EXPECT_DOUBLE_EQ(gch.getConvBoundary().xmin(), parallel.getConvBoundary().xmin());
+    EXPECT_DOUBLE_EQ(gch.getConvBoundary().xmax(), parallel.getConvBoundary().xmax());
+    EXPECT_DOUBLE_EQ(gch.getConvBoundary().ymin(), parallel.getConvBoundary().ymin());
+    EXPECT_DOUBLE_EQ(gch.getConvBoundary().ymax(), parallel.getConvBoundary().ymax());
+    EXPECT_DOUBLE_EQ(gch.getOrigBoundary().xmax(), parallel.getOrigBoundary().xmax());
+}
@@ -0,0 +1,110 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    NumberFormatterTest.cpp
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// Tests NumberFormatter class from <SUMO>/src/utils/iodevices
+/****************************************************************************/
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <utils/common/ToString.h>
+#include <utils/geom/PositionVector.h>
+#include <utils/iodevices/NumberFormatter.h>
+
+
+// ===========================================================================
+// test helpers
+// ===========================================================================
+static std::string
+format(const double v, const int precision) {
+    std::ostringstream oss;
+    NumberFormatter::write(oss, v, precision);
+    return oss.str();
+}
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests the output of doubles against the stream formatting (including the values which need the fallback). */
+TEST(NumberFormatter, test_method_write_double) {
+    const double values[] = {0., -0., 1., -1., 0.5, 2.5, 0.125, -0.375, 0.005, 1.005, 9.995, 0.001, -0.001,
+                             13.37, -4711.0815, 123456.785, 1e-300, 1e15, -1e300,
+                             std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()
+                            };
+    for (int precision = 0; precision <= NumberFormatter::MAX_PRECISION + 2; precision++) {
+        for (int i = 0; i < (int)(sizeof(values) / sizeof(double)); i++) {
+            EXPECT_EQ(toString(values[i], precision), format(values[i], precision));
+        }
+        for (int i = -100000; i <= 100000; i += 7) {
+            const double v = i / 1000. + 0.0005;
+            EXPECT_EQ(toString(v, precision), format(v, precision));
+        }
+    }
+    EXPECT_EQ(toString(std::nan(""), 2), format(std::nan(""), 2));
+}
+
+
+/* Tests the fast path and the cases where the stream has to be used. */
+TEST(NumberFormatter, test_method_format_double) {
+    char buffer[NumberFormatter::BUFFER_SIZE];
+    EXPECT_EQ(4, NumberFormatter::format(buffer, 1.234, 2));
+    EXPECT_EQ("1.23", std::string(buffer, 4));
+    EXPECT_EQ(5, NumberFormatter::format(buffer, -0.004, 2));
+    EXPECT_EQ("-0.00", std::string(buffer, 5));
+    EXPECT_EQ(1, NumberFormatter::format(buffer, 2.7, 0));
+    EXPECT_EQ("3", std::string(buffer, 1));
+    // exact ties are left to the stream
+    EXPECT_EQ(-1, NumberFormatter::format(buffer, 0.125, 2));
+    EXPECT_EQ(-1, NumberFormatter::format(buffer, 1e20, 2));
+    EXPECT_EQ(-1, NumberFormatter::format(buffer, 1., NumberFormatter::MAX_PRECISION + 1));
+}
+
+
+/* Tests the output of integers. */
+TEST(NumberFormatter, test_method_write_int) {
+    const long long int values[] = {0, 1, -1, 10, -4711, 2147483647LL, -2147483647LL - 1,
+                                    std::numeric_limits<long long int>::max(), std::numeric_limits<long long int>::min()
+                                   };
+    for (int i = 0; i < (int)(sizeof(values) / sizeof(long long int)); i++) {
+        std::ostringstream oss;
+        NumberFormatter::write(oss, values[i]);
+        EXPECT_EQ(toString(values[i]), oss.str());
+    }
+}
+
+
+/* Tests the output of positions and position vectors. */
+TEST(NumberFormatter, test_method_write_positions) {
+    PositionVector shape;
+    shape.push_back(Position(1.5, -2.25));
+    shape.push_back(Position(100.123456, 0.001, 3.5));
+    shape.push_back(Position(-0.004, 7, 0));
+    std::ostringstream oss;
+    NumberFormatter::write(oss, shape, 2);
+    EXPECT_EQ(toString(shape, 2), oss.str());
+    std::ostringstream oss2;
+    NumberFormatter::write(oss2, shape[1], 6);
+    EXPECT_EQ(toString(shape[1], 6), oss2.str());
+    std::ostringstream oss3;
+    NumberFormatter::write(oss3, PositionVector(), 2);
+    EXPECT_EQ("", oss3.str());
+}
+
+
+/****************************************************************************/
@@ -0,0 +1,183 @@
+/****************************************************************************/
+// Eclipse SUMO, Simulation of Urban MObility; see https://eclipse.org/sumo
+// Copyright (C) 2026-2026 German Aerospace Center (DLR) and others.
+// This program and the accompanying materials
+// are made available under the terms of the Eclipse Public License v2.0
+// which accompanies this distribution, and is available at
+// http://www.eclipse.org/legal/epl-v20.html
+// SPDX-License-Identifier: EPL-2.0
+/****************************************************************************/
+/// @file    PlainXMLReaderTest.cpp
+/// @author  agent
+/// @date    Mon, 19 Oct 2026
+/// @version $Id$
+///
+// Tests PlainXMLReader class from <SUMO>/src/utils/xml
+/****************************************************************************/
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <utils/common/UtilExceptions.h>
+#include <utils/xml/PlainXMLReader.h>
+#include <utils/xml/SUMOSAXAttributesImpl_Plain.h>
+#include <utils/xml/SUMOXMLDefinitions.h>
+
+
+// ===========================================================================
+// test helpers
+// ===========================================================================
+static const std::string TEST_FILE = "PlainXMLReaderTest.xml";
+
+static void
+writeTestFile(const std::string& content) {
+    std::ofstream out(TEST_FILE.c_str(), std::ios::binary);
+    out << content;
+}
+
+static std::string
+tokens(const std::string& content) {
+    writeTestFile(content);
+    PlainXMLReader reader(TEST_FILE);
+    std::string result;
+    while (true) {
+        switch (reader.next()) {
+            case PlainXMLReader::TOKEN_START:
+                result += "<" + std::string(reader.getName());
+                for (int i = 0; i < reader.getNumAttributes(); ++i) {
+                    result += " " + std::string(reader.getAttributeName(i)) + "=" + reader.getAttributeValue(i);
+                }
+                result += ">";
+                break;
+            case PlainXMLReader::TOKEN_END:
+                result += "</" + std::string(reader.getName()) + ">";
+                break;
+            case PlainXMLReader::TOKEN_CHARACTERS:
+                result += "[" + std::string(reader.getCharacters(), reader.getCharactersLength()) + "]";
+                break;
+            case PlainXMLReader::TOKEN_EOF:
+                remove(TEST_FILE.c_str());
+                return result;
+        }
+    }
+}
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests elements, attributes and empty elements. */
+TEST(PlainXMLReader, test_elements) {
+    EXPECT_EQ("<a x=1 y=two><b></b></a>", tokens("<a x=\"1\" y='two'><b/></a>"));
+    EXPECT_EQ("<a>[\n]<b z=></b>[\n]</a>", tokens("<?xml version=\"1.0\"?>\n<a >\n<b\tz = \"\" />\n</a >"));
+    EXPECT_EQ("<a x=>></a>", tokens("<a x=\">\"/>"));
+}
+
+
+/* Tests that comments, processing instructions and the doctype are skipped and whitespace outside the root is ignored. */
+TEST(PlainXMLReader, test_skipped) {
+    EXPECT_EQ("<a></a>", tokens("<!-- <b/> -->\n<!DOCTYPE a [<!ENTITY e \"x\">]>\n<a><?pi <b/>?></a>\n<!-- end -->\n"));
+}
+
+
+/* Tests the decoding of entities and character references as well as line end normalization. */
+TEST(PlainXMLReader, test_decode) {
+    EXPECT_EQ("<a x=<>&\"'>[ & ]</a>", tokens("<a x=\"&lt;&gt;&amp;&quot;&apos;\"> &amp; </a>"));
+    EXPECT_EQ("<a x=A\xC3\xA4\xE2\x82\xAC></a>", tokens("<a x=\"&#65;&#xe4;&#x20AC;\"/>"));
+    EXPECT_EQ("<a x=a b c>[\n\n]</a>", tokens("<a x=\"a\tb\nc\">\r\n\r</a>"));
+    EXPECT_EQ("<a>[&lt;<b/>]</a>", tokens("<a><![CDATA[&lt;<b/>]]></a>"));
+}
+
+
+/* Tests files exceeding the size of the read buffer with tokens crossing the chunk boundary. */
+TEST(PlainXMLReader, test_chunk_boundary) {
+    const std::string element = "<b id=\"12345678\" v=\"x&amp;y\"/>\n";
+    const int numElements = (1 << 24) / (int)element.size() + 10;
+    // shift the elements so that different parts of an element (name, value and entity) hit the boundary
+    for (int shift = 0; shift < (int)element.size(); shift += 7) {
+        {
+            std::ofstream out(TEST_FILE.c_str(), std::ios::binary);
+            out << "<a>" << std::string(shift, ' ');
+            for (int i = 0; i < numElements; ++i) {
+                out << element;
+            }
+            out << "</a>";
+        }
+        PlainXMLReader reader(TEST_FILE);
+        int elements = 0;
+        int wrong = 0;
+        PlainXMLReader::TokenType token;
+        while ((token = reader.next()) != PlainXMLReader::TOKEN_EOF) {
+            if (token == PlainXMLReader::TOKEN_START && std::string(reader.getName()) == "b") {
+                elements++;
+                if (reader.getNumAttributes() != 2 || std::string(reader.getAttributeValue(0)) != "12345678"
+                        || std::string(reader.getAttributeValue(1)) != "x&y") {
+                    wrong++;
+                }
+            }
+        }
+        EXPECT_EQ(numElements, elements);
+        EXPECT_EQ(0, wrong);
+    }
+    remove(TEST_FILE.c_str());
+}
+
+
+/* Tests the detection of supported encodings. */
+TEST(PlainXMLReader, test_isSupported) {
+    writeTestFile("<?xml version=\"1.0\" encoding=\"UTF-8\"?><a/>");
+    EXPECT_TRUE(PlainXMLReader(TEST_FILE).isSupported());
+    writeTestFile("\xEF\xBB\xBF<a/>");
+    EXPECT_TRUE(PlainXMLReader(TEST_FILE).isSupported());
+    writeTestFile("<?xml version=\"1.0\" encoding=\"iso-8859-1\"?><a/>");
+    EXPECT_FALSE(PlainXMLReader(TEST_FILE).isSupported());
+    writeTestFile(std::string("\xFF\xFE<\0a\0/\0>\0", 10));
+    EXPECT_FALSE(PlainXMLReader(TEST_FILE).isSupported());
+    writeTestFile("");
+    EXPECT_FALSE(PlainXMLReader(TEST_FILE).isSupported());
+    remove(TEST_FILE.c_str());
+    EXPECT_FALSE(PlainXMLReader(TEST_FILE).isSupported());
+}
+
+
+/* Tests that empty attribute values are returned like the xerces attributes do. */
+TEST(PlainXMLReader, test_empty_attribute) {
+    writeTestFile("<a id=\"\" speed=\"1\"/>");
+    PlainXMLReader reader(TEST_FILE);
+    ASSERT_EQ(PlainXMLReader::TOKEN_START, reader.next());
+    std::vector<const char*> names;
+    std::vector<const char*> values;
+    std::vector<int> ids;
+    for (int i = 0; i < reader.getNumAttributes(); ++i) {
+        names.push_back(reader.getAttributeName(i));
+        values.push_back(reader.getAttributeValue(i));
+        ids.push_back(SUMOXMLDefinitions::Attrs.get(reader.getAttributeName(i)));
+    }
+    const std::map<int, std::string> predefinedTagsMML;
+    SUMOSAXAttributesImpl_Plain attrs(names, values, ids, predefinedTagsMML, "a");
+    EXPECT_EQ("", attrs.getStringSecure(SUMO_ATTR_ID, "default"));
+    EXPECT_EQ("1", attrs.getStringSecure(SUMO_ATTR_SPEED, "default"));
+    EXPECT_EQ("default", attrs.getStringSecure(SUMO_ATTR_NAME, "default"));
+    // the variant for arbitrary attribute names returns the default for empty values
+    EXPECT_EQ("default", attrs.getStringSecure("id", "default"));
+    remove(TEST_FILE.c_str());
+}
+
+
+/* Tests that malformed files are rejected. */
+TEST(PlainXMLReader, test_errors) {
+    EXPECT_THROW(tokens("<a></b>"), ProcessError);
+    EXPECT_THROW(tokens("<a><b></a>"), ProcessError);
+    EXPECT_THROW(tokens("<a>"), ProcessError);
+    EXPECT_THROW(tokens("<a/><b/>"), ProcessError);
+    EXPECT_THROW(tokens("text<a/>"), ProcessError);
+    EXPECT_THROW(tokens("<a x=\"1\" x=\"2\"/>"), ProcessError);
+    EXPECT_THROW(tokens("<a x=1/>"), ProcessError);
+    EXPECT_THROW(tokens("<a x=\"&unknown;\"/>"), ProcessError);
+    EXPECT_THROW(tokens("<a x=\"&#xZZ;\"/>"), ProcessError);
+    EXPECT_THROW(tokens("<!-- only a comment -->"), ProcessError);
+    remove(TEST_FILE.c_str());
+}